@@ -25,9 +25,11 @@
 // Global
 #include <cassert>
 #include <memory>
-#include <set>
 #include <vector>
 
+// External
+#include <robin_hood/robin_hood.hpp>
+
 // Local
 #include "grstapse/common/search/best_first_search_functors.hpp"
 #include "grstapse/common/search/best_first_search_node_base.hpp"
@@ -190,9 +192,9 @@ namespace grstapse {
         MutablePriorityQueue<unsigned int, float, SearchNode> m_open;  //!< key, priority, payload
 
         std::vector<std::shared_ptr<SearchNode>> m_closed;
-        std::set<unsigned int> m_closed_ids;
+        robin_hood::unordered_set<unsigned int> m_closed_ids;
 
         std::vector<std::shared_ptr<SearchNode>> m_pruned;
-        std::set<unsigned int> m_pruned_ids;
+        robin_hood::unordered_set<unsigned int> m_pruned_ids;
     };
 }  // namespace grstapse
\ No newline at end of file
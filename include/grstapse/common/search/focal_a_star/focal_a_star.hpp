@@ -2,7 +2,7 @@
  * Graphically Recursive Simultaneous Task Allocation, Planning,
  * Scheduling, and Execution
  *
- * Copyright (C) 2020-2021
+ * Copyright (C) 2020-2022
  *
  * Author: Andrew Messing
  * Author: Glen Neville
@@ -22,90 +22,107 @@
  */
 #pragma once
 
+// Global
+#include <cassert>
+#include <memory>
+#include <vector>
+
 // Local
 #include "grstapse/common/search/best_first_search_base.hpp"
 #include "grstapse/common/search/focal_a_star/focal_a_star_functors.hpp"
 #include "grstapse/common/search/focal_a_star/focal_a_star_parameters.hpp"
 #include "grstapse/common/search/focal_a_star/focal_a_star_search_node_base.hpp"
 #include "grstapse/common/search/focal_a_star/focal_wrapper.hpp"
+#include "grstapse/common/search/path_cost_base.hpp"
 
 namespace grstapse
 {
     /**
-     * Search algorithm to find the shortest path
-     * within a given suboptimality bound (also known as focal search)
+     * Search algorithm to find the shortest path within a given suboptimality bound (also known as focal search)
+     *
+     * The open set is ordered by f while the focal set contains every open node with f <= w * min_f and is ordered
+     * by a secondary (focal) heuristic. Nodes are always expanded from the focal set, so the returned solution costs
+     * at most w times the optimal one when the heuristic is admissible.
      *
-     * \tparam SearchNodeDeriv A derivative of FocalAStarSearchNodeBase
+     * \tparam SearchNode A derivative of FocalAStarSearchNodeBase
+     * \tparam SearchStatistics A derivative of SearchStatisticsBase
      *
      * \cite "Studies in Semi-Admissible Heuristics." IEEE Trans. Pattern Anal. Mach. Intell.
      *        4(4): 392-399 (1982)
      */
-    template <typename SearchNodeDeriv>
-    requires std::derived_from<SearchNodeDeriv, FocalAStarSearchNodeBase<SearchNodeDeriv>>
-    class FocalAStar : public BestFirstSearchBase<SearchNodeDeriv>
+    template <FocalAStarSearchNodeDeriv SearchNode, SearchStatisticsDeriv SearchStatistics = SearchStatisticsCommon>
+    class FocalAStar : public BestFirstSearchBase<SearchNode, SearchStatistics>
     {
-        using Base           = BestFirstSearchBase<SearchNodeDeriv>;
-        using PathCost       = PathCostBase<SearchNodeDeriv>;
-        using FocalHeuristic = FocalHeuristicBase<SearchNodeDeriv>;
+        using Base           = BestFirstSearchBase<SearchNode, SearchStatistics>;
+        using PathCost       = PathCostBase<SearchNode>;
+        using FocalHeuristic = FocalHeuristicBase<SearchNode>;
+        using Wrapper        = FocalWrapper<SearchNode>;
 
        public:
         /**!
          * Constructor
          *
          * \param parameters
-         * \param heuristic A derivative of HeuristicBase
-         * \param path_cost A derivative of PathCostBase
-         * \param focal_heuristic A derivative of FocalHeuristicBase
-         * \param node_expander A derivative of SuccessorGenerator
-         * \param goal_check A derivative of GoalCheckBase
-         * \param memoization A derivative of MemoizationBase
-         * \param pruning_method A derivative of PruningMethodBase
+         * \param functors
          */
-        FocalAStar(std::shared_ptr<const FocalAStarParameters> parameters,
-                   const FocalAStarFunctors<SearchNodeDeriv>& functors)
+        FocalAStar(const std::shared_ptr<const FocalAStarParameters>& parameters,
+                   const FocalAStarFunctors<SearchNode>& functors)
             : Base(parameters, functors)
             , m_path_cost(functors.path_cost)
             , m_focal_heuristic(functors.focal_heuristic)
+            , m_lower_bound(0.0f)
         {}
 
-        SearchResults<SearchNodeDeriv> searchFromNode(std::shared_ptr<SearchNodeDeriv> root) override
+        //! \copydoc BestFirstSearchBase
+        SearchResults<SearchNode, SearchStatistics> searchFromNode(const std::shared_ptr<SearchNode>& root) override
         {
             assert(root);
-            Base::m_timer.start();
             Base::m_statistics->incrementNodesGenerated();
 
-            MutablePriorityQueue<unsigned int, float, FocalWrapper<SearchNodeDeriv>> focal;
+            auto parameters           = std::dynamic_pointer_cast<const FocalAStarParameters>(Base::m_parameters);
+            const bool has_prepruning  = Base::m_prepruning_method != nullptr;
+            const bool has_postpruning = Base::m_postpruning_method != nullptr;
 
-            Base::m_open.push(Base::m_memoization->operator()(root), root);
-            Base::m_focal.push(Base::m_memoization->operator()(root), root);
-            float best_f = root->f();
-
-            const float w          = std::dynamic_pointer_cast<FocalAStarParameters>(Base::m_parameters)->w();
-            const bool rebuild     = std::dynamic_pointer_cast<FocalAStarParameters>(Base::m_parameters)->rebuild();
-            const bool has_timeout = Base::m_parameters->hasTimeout();
-            const float timeout    = Base::m_parameters->timeout();
-            const bool pruning_before_eval = Base::m_parameters->pruneBeforeEval();
+            {
+                const unsigned int id = Base::m_memoization->operator()(root);
+                Base::m_open.push(id, root);
+                m_focal.push(id, std::make_shared<Wrapper>(root));
+                m_lower_bound = root->f();
+            }
 
-            // Continue through open set until it is empty or timeout
+            // Continue through the open set until it is empty or timeout
             // Only check timeout if parameter is set
-            while(!focal.empty() && (!has_timeout || Base::m_timer.get() < timeout))
+            while(!Base::m_open.empty() &&
+                  (!parameters->has_timeout ||
+                   TimeKeeper::instance().time(parameters->timer_name) < parameters->timeout))
             {
-                std::shared_ptr<SearchNodeDeriv> base = focal.pop()->internal();
-                Base::m_open.erase(Base::m_memoization->operator()(base));
+                if(m_focal.empty())
+                {
+                    // The open node with the minimum f always fits the bound, so this only happens when w < 1
+                    m_lower_bound = Base::m_open.top()->f();
+                    fillFocal(-1.0f, m_lower_bound * parameters->w);
+                }
 
-                if(Base::m_goal_check->operator()(base))
+                std::shared_ptr<SearchNode> base = m_focal.pop()->internal();
+                const unsigned int base_id       = Base::m_memoization->operator()(base);
+                Base::m_open.erase(base_id);
+
+                // Close node before the goal check for future anytime/repair
+                if(parameters->save_closed_nodes)
                 {
-                    Base::m_timer.stop();
-                    Base::m_statistics->setTotalTime(Base::m_timer.get());
-                    return SearchResults<SearchNodeDeriv>(base, Base::m_statistics);
+                    Base::m_closed.push_back(base);
                 }
-                // TODO(Andrew): Should this be before the goal check? (Only matters for anytime/repair)
-                Base::m_closed.push_back(base);
-                Base::m_closed_ids.insert(Base::m_memoization->operator()(base));
+                Base::m_closed_ids.insert(base_id);
                 base->setStatus(SearchNodeStatus::e_closed);
 
-                // Expand
-                std::vector<std::shared_ptr<SearchNodeDeriv>> children = Base::m_successor_generator->operator()(base);
+                // Check if goal node
+                if(Base::m_goal_check->operator()(base))
+                {
+                    return SearchResults<SearchNode, SearchStatistics>(base, Base::m_statistics);
+                }
+
+                // Generate successors
+                std::vector<std::shared_ptr<SearchNode>> children = Base::m_successor_generator->operator()(base);
                 Base::m_statistics->incrementNodesExpanded();
 
                 if(children.empty())
@@ -118,22 +135,22 @@ namespace grstapse
                     Base::m_statistics->incrementNodesGenerated(children.size());
                 }
 
-                for(std::shared_ptr<SearchNodeDeriv> child: children)
+                const float focal_bound = m_lower_bound * parameters->w;
+                for(std::shared_ptr<SearchNode> child: children)
                 {
                     const unsigned int id = Base::m_memoization->operator()(child);
 
-                    // Ignore if this node has already been expanded
-                    if(Base::m_closed_ids.find(id) != Base::m_closed_ids.end())
+                    // Ignore if this node has already been closed or pruned
+                    if(Base::m_closed_ids.find(id) != Base::m_closed_ids.end() ||
+                       Base::m_pruned_ids.find(id) != Base::m_pruned_ids.end())
                     {
                         continue;
                     }
 
                     // Check if the child should be pruned before evaluation
-                    if(pruning_before_eval && Base::m_pruning_method->operator()(child))
+                    if(has_prepruning && Base::m_prepruning_method->operator()(child))
                     {
-                        child->setStatus(SearchNodeStatus::e_pruned);
-                        Base::m_statistics->incrementNodesPruned();
-                        Base::m_pruned.push_back(child);
+                        prune(id, child, parameters->save_pruned_nodes);
                         continue;
                     }
 
@@ -141,77 +158,106 @@ namespace grstapse
                     evaluateNode(child);
                     Base::m_statistics->incrementNodesEvaluated();
 
-                    // Check if child should be pruned
-                    if(!pruning_before_eval && Base::m_pruning_method->operator()(child))
+                    // Check if child should be pruned after evaluation
+                    if(has_postpruning && Base::m_postpruning_method->operator()(child))
                     {
-                        child->setStatus(SearchNodeStatus::e_pruned);
-                        Base::m_statistics->incrementNodesPruned();
-                        Base::m_pruned.push_back(child);
+                        prune(id, child, parameters->save_pruned_nodes);
                         continue;
                     }
 
-                    // Add child to open set
+                    // Add child to the open set (and the focal set if it is within the suboptimality bound)
                     child->setStatus(SearchNodeStatus::e_open);
                     Base::m_open.push(id, child);
+                    if(child->f() <= focal_bound)
+                    {
+                        m_focal.push(id, std::make_shared<Wrapper>(child));
+                    }
                 }
 
-                if(rebuild)
+                if(Base::m_open.empty())
                 {
-                    focal.clear();
-                    best_f = Base::m_open.top()->f();
-                    for(auto it = Base::m_open.ordered_begin(), end = Base::m_open.ordered_end(); it != end; ++it)
-                    {
-                        std::shared_ptr<SearchNodeDeriv> node = *it;
-                        float value                           = node->f();
-                        if(value <= best_f * w)
-                        {
-                            focal.push(Base::m_memoization->operator()(node),
-                                       std::make_shared<FocalWrapper<SearchNodeDeriv>>(node));
-                        }
-                        else
-                        {
-                            break;
-                        }
-                    }
+                    break;
                 }
-                else
+
+                // Update the focal set with the nodes that fall within the bound once the lower bound increases
+                const float previous_lower_bound = m_lower_bound;
+                m_lower_bound                    = Base::m_open.top()->f();
+                if(parameters->rebuild)
                 {
-                    float previous_best_f = best_f;
-                    best_f                = Base::m_open.top()->f();
-                    if(best_f > previous_best_f)
-                    {
-                        for(auto it = Base::m_open.ordered_begin(), end = Base::m_open.ordered_end(); it != end; ++it)
-                        {
-                            std::shared_ptr<SearchNodeDeriv> node = *it;
-                            float value                           = node->f();
-                            if(value > previous_best_f * w && value <= best_f * w)
-                            {
-                                focal.push(Base::m_memoization->operator()(node),
-                                           std::make_shared<FocalWrapper<SearchNodeDeriv>>(node));
-                            }
-                            if(value > best_f * w)
-                            {
-                                break;
-                            }
-                        }
-                    }
+                    m_focal.clear();
+                    fillFocal(-1.0f, m_lower_bound * parameters->w);
+                }
+                else if(m_lower_bound > previous_lower_bound)
+                {
+                    fillFocal(previous_lower_bound * parameters->w, m_lower_bound * parameters->w);
                 }
             }
-            Base::m_timer.stop();
-            Base::m_statistics->setTotalTime(Base::m_timer.get());
-            return SearchResults<SearchNodeDeriv>(nullptr, Base::m_statistics);
+            return SearchResults<SearchNode, SearchStatistics>(nullptr, Base::m_statistics);
+        }
+
+        //! \returns The minimum f value in the open set when the search stopped (a lower bound on the optimal cost)
+        [[nodiscard]] inline float lowerBound() const
+        {
+            return m_lower_bound;
         }
 
        protected:
-        //! Compute the path cost and heuristic value of a node
-        virtual void evaluateNode(std::shared_ptr<SearchNodeDeriv> node) override
+        //! Compute the path cost, heuristic, and focal heuristic value of a node
+        void evaluateNode(const std::shared_ptr<SearchNode>& node) final override
+        {
+            // Path Cost
+            {
+                TimerRunner timer_runner(Base::m_parameters->timer_name + "_pathcost");
+                node->setG(m_path_cost->operator()(node));
+            }
+
+            // Heuristic
+            {
+                TimerRunner timer_runner(Base::m_parameters->timer_name + "_heuristic");
+                node->setH(Base::m_heuristic->operator()(node));
+            }
+
+            // Focal Heuristic
+            {
+                TimerRunner timer_runner(Base::m_parameters->timer_name + "_focal_heuristic");
+                node->setFocalH(m_focal_heuristic->operator()(node));
+            }
+        }
+
+        //! Marks \p node as pruned
+        void prune(const unsigned int id, const std::shared_ptr<SearchNode>& node, const bool save)
         {
-            node->setG(m_path_cost->operator()(node));
-            node->setH(Base::m_heuristic->operator()(node));
-            node->setFocalH(m_focal_heuristic->operator()(node));
+            node->setStatus(SearchNodeStatus::e_pruned);
+            Base::m_statistics->incrementNodesPruned();
+            Base::m_pruned_ids.insert(id);
+            if(save)
+            {
+                Base::m_pruned.push_back(node);
+            }
+        }
+
+        //! Adds the open nodes with \p lower < f <= \p upper to the focal set
+        void fillFocal(const float lower, const float upper)
+        {
+            for(auto it = Base::m_open.ordered_begin(), end = Base::m_open.ordered_end(); it != end; ++it)
+            {
+                const std::shared_ptr<SearchNode> node = it->payload();
+                const float f                          = node->f();
+                if(f > upper)
+                {
+                    break;
+                }
+                if(f > lower)
+                {
+                    m_focal.push(it->key(), std::make_shared<Wrapper>(node));
+                }
+            }
         }
 
-        std::unique_ptr<const PathCost> m_path_cost;
-        std::unique_ptr<const FocalHeuristic> m_focal_heuristic;
+        std::shared_ptr<const PathCost> m_path_cost;
+        std::shared_ptr<const FocalHeuristic> m_focal_heuristic;
+
+        MutablePriorityQueue<unsigned int, std::pair<float, float>, Wrapper> m_focal;  //!< key, priority, payload
+        float m_lower_bound;
     };
 }  // namespace grstapse
\ No newline at end of file
@@ -2,7 +2,7 @@
  * Graphically Recursive Simultaneous Task Allocation, Planning,
  * Scheduling, and Execution
  *
- * Copyright (C) 2020-2021
+ * Copyright (C) 2020-2022
  *
  * Author: Andrew Messing
  * Author: Glen Neville
@@ -22,6 +22,9 @@
  */
 #pragma once
 
+// Global
+#include <memory>
+
 // Local
 #include "grstapse/common/search/a_star/a_star_functors.hpp"
 #include "grstapse/common/search/focal_a_star/focal_a_star_search_node_base.hpp"
@@ -29,31 +32,49 @@
 
 namespace grstapse
 {
-    template <typename SearchNodeDeriv>
-    requires std::derived_from<SearchNodeDeriv, FocalAStarSearchNodeBase<SearchNodeDeriv>>
-    struct FocalAStarFunctors : public AStarFunctors<SearchNodeDeriv>
+    /**!
+     * A container for functors used by focal search
+     *
+     * \tparam SearchNode A derivative of FocalAStarSearchNodeBase
+     */
+    template <FocalAStarSearchNodeDeriv SearchNode>
+    class FocalAStarFunctors : public AStarFunctors<SearchNode>
     {
-       private:
-        using Base = AStarFunctors<SearchNodeDeriv>;
+        using Base = AStarFunctors<SearchNode>;
 
        public:
-        using FocalHeuristic = FocalHeuristicBase<SearchNodeDeriv>;
+        using FocalHeuristic = FocalHeuristicBase<SearchNode>;
 
-        FocalAStarFunctors(std::shared_ptr<const typename Base::PathCost> path_cost,
-                           std::shared_ptr<const typename Base::Heuristic> heuristic,
-                           std::shared_ptr<const FocalHeuristic> focal_heuristic,
-                           std::shared_ptr<const typename Base::SuccessorGenerator> successor_generator,
-                           std::shared_ptr<const typename Base::GoalCheck> goal_check,
-                           std::shared_ptr<const typename Base::Memoization> memoization =
-                               std::make_shared<const NullMemoization<SearchNodeDeriv>>(),
-                           std::shared_ptr<const typename Base::PruningMethod> pruning_method =
-                               std::make_shared<const NullPruningMethod<SearchNodeDeriv>>())
-            : Base{.heuristic           = heuristic,
-                   .path_cost           = path_cost,
-                   .successor_generator = successor_generator,
-                   .goal_check          = goal_check,
-                   .memoization         = memoization,
-                   .pruning_method      = pruning_method}
+        /**!
+         * Constructor
+         *
+         * \param path_cost
+         * \param heuristic
+         * \param focal_heuristic
+         * \param successor_generator
+         * \param goal_check
+         * \param memoization
+         * \param prepruning_method
+         * \param postpruning_method
+         */
+        FocalAStarFunctors(const std::shared_ptr<const typename Base::PathCost>& path_cost,
+                           const std::shared_ptr<const typename Base::Heuristic>& heuristic,
+                           const std::shared_ptr<const FocalHeuristic>& focal_heuristic,
+                           const std::shared_ptr<const typename Base::SuccessorGenerator>& successor_generator,
+                           const std::shared_ptr<const typename Base::GoalCheck>& goal_check,
+                           const std::shared_ptr<const typename Base::Memoization>& memoization =
+                               std::make_shared<const NullMemoization<SearchNode>>(),
+                           const std::shared_ptr<const typename Base::PruningMethod>& prepruning_method =
+                               std::make_shared<const NullPruningMethod<SearchNode>>(),
+                           const std::shared_ptr<const typename Base::PruningMethod>& postpruning_method =
+                               std::make_shared<const NullPruningMethod<SearchNode>>())
+            : Base(path_cost,
+                   heuristic,
+                   successor_generator,
+                   goal_check,
+                   memoization,
+                   prepruning_method,
+                   postpruning_method)
             , focal_heuristic(focal_heuristic)
         {}
 
@@ -22,17 +22,20 @@
  */
 #pragma once
 
+// Global
+#include <limits>
+#include <string>
+
 // Local
 #include "grstapse/common/search/best_first_search_parameters.hpp"
 
 namespace grstapse
 {
     /**!
-     * \brief Container for parameters for A* Epsilon
+     * \brief Container for parameters for focal search
      */
     struct FocalAStarParameters : public BestFirstSearchParameters
     {
-       public:
         /**!
          * Constructor
          *
@@ -45,18 +48,14 @@ namespace grstapse
          * \param save_pruned_nodes
          * \param save_closed_nodes
          */
-        FocalAStarParameters(const std::string& timer_name,
-                             float w                = 1.1,
-                             bool rebuild           = false,
-                             bool has_timeout       = false,
-                             float timeout          = std::numeric_limits<float>::max(),
-                             bool save_pruned_nodes = false,
-                             bool save_closed_nodes = false)
-            : BestFirstSearchParameters{.has_timeout       = has_timeout,
-                                        .timeout           = timeout,
-                                        .timer_name        = timer_name,
-                                        .save_pruned_nodes = save_pruned_nodes,
-                                        .save_closed_nodes = save_closed_nodes}
+        explicit FocalAStarParameters(const std::string& timer_name,
+                                      float w                = 1.1f,
+                                      bool rebuild           = false,
+                                      bool has_timeout       = false,
+                                      float timeout          = std::numeric_limits<float>::max(),
+                                      bool save_pruned_nodes = false,
+                                      bool save_closed_nodes = false)
+            : BestFirstSearchParameters(has_timeout, timeout, timer_name, save_pruned_nodes, save_closed_nodes)
             , w(w)
             , rebuild(rebuild)
         {}
@@ -2,7 +2,7 @@
  * Graphically Recursive Simultaneous Task Allocation, Planning,
  * Scheduling, and Execution
  *
- * Copyright (C) 2020-2021
+ * Copyright (C) 2020-2022
  *
  * Author: Andrew Messing
  * Author: Glen Neville
@@ -22,13 +22,18 @@
  */
 #pragma once
 
+// Global
+#include <cmath>
+#include <concepts>
+#include <memory>
+
 // Local
 #include "grstapse/common/search/a_star/a_star_search_node_base.hpp"
 
 namespace grstapse
 {
     /**!
-     * A base class for search nodes for A* epsilon
+     * A base class for search nodes for focal search
      *
      * \tparam SearchNodeDeriv A derivative of FocalAStarSearchNodeBase
      */
@@ -44,19 +49,32 @@ namespace grstapse
             m_focal_h = h;
         }
 
-        //! \returns The heuristic value representing the computation cost for the node
+        //! \returns The secondary heuristic value used to order the focal list
         [[nodiscard]] inline float focalH() const
         {
             return m_focal_h;
         }
 
        protected:
-        FocalAStarSearchNodeBase(std::shared_ptr<SearchNodeDeriv> parent, unsigned int id)
-            : Base(parent, id)
+        /**!
+         * \brief Constructor
+         *
+         * \param id A unique identifier for this node
+         * \param parent The parent of this SearchNodeDeriv
+         */
+        FocalAStarSearchNodeBase(const unsigned int id, const std::shared_ptr<const SearchNodeDeriv>& parent = nullptr)
+            : Base(id, parent)
             , m_focal_h(std::nanf(""))
         {}
 
         float m_focal_h;
     };
 
+    /**!
+     * Concept to force a type to derive from FocalAStarSearchNodeBase
+     *
+     * \tparam T
+     */
+    template <typename T>
+    concept FocalAStarSearchNodeDeriv = std::derived_from<T, FocalAStarSearchNodeBase<T>>;
 }  // namespace grstapse
\ No newline at end of file
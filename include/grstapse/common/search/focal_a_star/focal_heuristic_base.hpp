@@ -2,7 +2,7 @@
  * Graphically Recursive Simultaneous Task Allocation, Planning,
  * Scheduling, and Execution
  *
- * Copyright (C) 2020-2021
+ * Copyright (C) 2020-2022
  *
  * Author: Andrew Messing
  * Author: Glen Neville
@@ -22,33 +22,36 @@
  */
 #pragma once
 
+// Global
+#include <memory>
+
 // Local
+#include "grstapse/common/search/focal_a_star/focal_a_star_search_node_base.hpp"
 #include "grstapse/common/search/heuristic_base.hpp"
 
 namespace grstapse
 {
     /**!
-     * Interface for computing the heuristic value of a node
+     * Interface for computing the secondary heuristic value of a node that orders the focal list
      *
      * \tparam SearchNodeDeriv A derivative of FocalAStarSearchNodeBase
      */
-    template <typename SearchNodeDeriv>
-    requires std::derived_from<SearchNodeDeriv, FocalAStarSearchNodeBase<SearchNodeDeriv>>
+    template <FocalAStarSearchNodeDeriv SearchNodeDeriv>
     class FocalHeuristicBase : public HeuristicBase<SearchNodeDeriv>
     {
        public:
         //! Computes the focal heuristic value for a node
-        [[nodiscard]] float operator()(std::shared_ptr<SearchNodeDeriv> node) const final override
+        [[nodiscard]] float operator()(const std::shared_ptr<SearchNodeDeriv>& node) const final override
         {
             return computeStateHeuristic(node) + computeTransitionHeuristic(node);
         }
 
        protected:
         //! Computes the focal heuristic value for a node's state
-        [[nodiscard]] float computeStateHeuristic(std::shared_ptr<SearchNodeDeriv> node) const = 0;
+        [[nodiscard]] virtual float computeStateHeuristic(const std::shared_ptr<SearchNodeDeriv>& node) const = 0;
 
         //! Computes the focal heuristic value for transitioning from a node's parent to the node
-        [[nodiscard]] float computeTransitionHeuristic(std::shared_ptr<SearchNodeDeriv> node) const = 0;
+        [[nodiscard]] virtual float computeTransitionHeuristic(const std::shared_ptr<SearchNodeDeriv>& node) const = 0;
     };
 
 }  // namespace grstapse
\ No newline at end of file
@@ -2,7 +2,7 @@
  * Graphically Recursive Simultaneous Task Allocation, Planning,
  * Scheduling, and Execution
  *
- * Copyright (C) 2020-2021
+ * Copyright (C) 2020-2022
  *
  * Author: Andrew Messing
  * Author: Glen Neville
@@ -23,7 +23,8 @@
 #pragma once
 
 // Global
-#include <concepts>
+#include <memory>
+#include <utility>
 
 // Local
 #include "grstapse/common/search/focal_a_star/focal_a_star_search_node_base.hpp"
@@ -32,16 +33,15 @@
 namespace grstapse
 {
     /**!
-     * \brief Wraps a A* epsilon search node for the focal search
+     * \brief Wraps a focal search node so that the focal list orders it by its focal heuristic (ties broken by f)
      *
-     * \tparam SearchNodeDerive
+     * \tparam SearchNodeDeriv A derivative of FocalAStarSearchNodeBase
      */
-    template <typename SearchNodeDeriv>
-    requires std::derived_from<SearchNodeDeriv, FocalAStarSearchNodeBase<SearchNodeDeriv>>
-    class FocalWrapper : public MutablePriorityQueueable<float>
+    template <FocalAStarSearchNodeDeriv SearchNodeDeriv>
+    class FocalWrapper : public MutablePriorityQueueable<std::pair<float, float>>
     {
        public:
-        FocalWrapper(const std::shared_ptr<SearchNodeDeriv>& internal)
+        explicit FocalWrapper(const std::shared_ptr<SearchNodeDeriv>& internal)
             : m_internal(internal)
         {}
 
@@ -50,9 +50,9 @@ namespace grstapse
             return m_internal;
         }
 
-        [[nodiscard]] float priority() const override
+        [[nodiscard]] std::pair<float, float> priority() const override
         {
-            return m_internal->focalH();
+            return {m_internal->focalH(), m_internal->f()};
         }
 
        private:
@@ -66,7 +66,8 @@ namespace grstapse
         }
 
         //! \returns A list of the successors of a node
-        [[nodiscard]] std::vector<std::shared_ptr<SearchNode>> operator()(const std::shared_ptr<SearchNode>& base) const
+        [[nodiscard]] virtual std::vector<std::shared_ptr<SearchNode>> operator()(
+            const std::shared_ptr<SearchNode>& base) const
         {
             std::vector<std::shared_ptr<SearchNode>> rv;
             std::shared_ptr<SearchNode> node;
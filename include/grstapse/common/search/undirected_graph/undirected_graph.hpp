@@ -45,6 +45,8 @@ namespace grstapse
     class UndirectedGraph
     {
        public:
+        using Payload = VertexPayload;
+
         class Edge;
 
         /**!
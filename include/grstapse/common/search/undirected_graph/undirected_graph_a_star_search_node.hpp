@@ -53,5 +53,20 @@ namespace grstapse
             const std::shared_ptr<const UndirectedGraphAStarSearchNode>& parent = nullptr)
             : Base(vertex, last_edge, parent)
         {}
+
+        /**!
+         * Constructor for a search node generated from a CSR layout
+         *
+         * \param csr A CSR layout of an undirected graph (must outlive the search node)
+         * \param index The dense index of the vertex in \p csr
+         * \param entry The entry in \p csr of the edge connecting the previous vertex in the search to the vertex
+         * \param parent The previous vertex in the search
+         */
+        UndirectedGraphAStarSearchNode(const typename Base::Csr& csr,
+                                       const unsigned int index,
+                                       const unsigned int entry,
+                                       const std::shared_ptr<const UndirectedGraphAStarSearchNode>& parent)
+            : Base(csr, index, entry, parent)
+        {}
     };
 }  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,184 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <memory>
+#include <vector>
+// External
+#include <fmt/format.h>
+#include <robin_hood/robin_hood.hpp>
+// Local
+#include "grstapse/common/search/undirected_graph/undirected_graph.hpp"
+#include "grstapse/common/utilities/error.hpp"
+
+namespace grstapse
+{
+    /**!
+     * A frozen compressed sparse row (CSR) layout of an undirected graph
+     *
+     * Vertices are given dense indices and the neighbors of the vertex with index i are the entries
+     * [offsets[i], offsets[i + 1]) of the neighbor, cost, and edge arrays. Edges are also given dense indices (both
+     * entries of an edge share its index) so that per edge data can be stored in flat arrays. Built once the graph is
+     * done loading; changes to the graph afterwards are not reflected.
+     *
+     * \tparam VertexPayload A payload type for each vertex in the undirected graph
+     */
+    template <typename VertexPayload = DummyPayload>
+    class UndirectedGraphCsr
+    {
+       public:
+        using Graph  = UndirectedGraph<VertexPayload>;
+        using Vertex = typename Graph::Vertex;
+        using Edge   = typename Graph::Edge;
+
+        //! Constructor
+        explicit UndirectedGraphCsr(const Graph& graph)
+        {
+            const unsigned int num_vertices = graph.numVertices();
+            m_vertices.reserve(num_vertices);
+            m_vertex_indices.reserve(num_vertices);
+            for(const auto& [id, vertex]: graph.vertices())
+            {
+                m_vertex_indices[id] = m_vertices.size();
+                m_vertices.push_back(vertex);
+            }
+
+            // Note: built from the edges of the graph rather than those of the vertices as vertices could be shared
+            //       between graphs
+            std::vector<unsigned int> degrees(num_vertices, 0);
+            for(const auto& [key, edge]: graph.edges())
+            {
+                ++degrees[m_vertex_indices[edge->nodeA()->id()]];
+                ++degrees[m_vertex_indices[edge->nodeB()->id()]];
+            }
+            m_offsets.resize(num_vertices + 1, 0);
+            for(unsigned int i = 0; i < num_vertices; ++i)
+            {
+                m_offsets[i + 1] = m_offsets[i] + degrees[i];
+            }
+
+            const unsigned int num_entries = m_offsets.back();
+            m_neighbors.resize(num_entries);
+            m_costs.resize(num_entries);
+            m_edges.resize(num_entries);
+            m_edge_indices.resize(num_entries);
+            std::vector<unsigned int> next(m_offsets.begin(), m_offsets.end() - 1);
+            for(const auto& [key, edge]: graph.edges())
+            {
+                const unsigned int a = m_vertex_indices[edge->nodeA()->id()];
+                const unsigned int b = m_vertex_indices[edge->nodeB()->id()];
+                for(const auto [from, to]: {std::pair(a, b), std::pair(b, a)})
+                {
+                    const unsigned int entry = next[from]++;
+                    m_neighbors[entry]       = to;
+                    m_costs[entry]           = edge->cost();
+                    m_edges[entry]           = edge;
+                    m_edge_indices[entry]    = m_num_edges;
+                }
+                ++m_num_edges;
+            }
+        }
+
+        //! \returns The number of vertices
+        [[nodiscard]] inline unsigned int numVertices() const
+        {
+            return m_vertices.size();
+        }
+
+        //! \returns The number of edges
+        [[nodiscard]] inline unsigned int numEdges() const
+        {
+            return m_num_edges;
+        }
+
+        //! \returns The dense index of the vertex with \p id
+        [[nodiscard]] inline unsigned int index(const unsigned int id) const
+        {
+            auto iter = m_vertex_indices.find(id);
+            if(iter == m_vertex_indices.end())
+            {
+                throw createLogicError(fmt::format("Vertex with id '{0:d}' does not exist", id));
+            }
+            return iter->second;
+        }
+
+        //! \returns Whether the graph has a vertex with \p id
+        [[nodiscard]] inline bool contains(const unsigned int id) const
+        {
+            return m_vertex_indices.contains(id);
+        }
+
+        //! \returns The vertex with dense index \p index
+        [[nodiscard]] inline const std::shared_ptr<Vertex>& vertex(const unsigned int index) const
+        {
+            return m_vertices[index];
+        }
+
+        //! \returns The first entry for the neighbors of the vertex with dense index \p index
+        [[nodiscard]] inline unsigned int begin(const unsigned int index) const
+        {
+            return m_offsets[index];
+        }
+
+        //! \returns One past the last entry for the neighbors of the vertex with dense index \p index
+        [[nodiscard]] inline unsigned int end(const unsigned int index) const
+        {
+            return m_offsets[index + 1];
+        }
+
+        //! \returns The dense index of the neighbor for \p entry
+        [[nodiscard]] inline unsigned int neighbor(const unsigned int entry) const
+        {
+            return m_neighbors[entry];
+        }
+
+        //! \returns The cost of the edge for \p entry
+        [[nodiscard]] inline float cost(const unsigned int entry) const
+        {
+            return m_costs[entry];
+        }
+
+        //! \returns The edge for \p entry
+        [[nodiscard]] inline const std::shared_ptr<Edge>& edge(const unsigned int entry) const
+        {
+            return m_edges[entry];
+        }
+
+        //! \returns The dense index of the edge for \p entry
+        [[nodiscard]] inline unsigned int edgeIndex(const unsigned int entry) const
+        {
+            return m_edge_indices[entry];
+        }
+
+       private:
+        std::vector<std::shared_ptr<Vertex>> m_vertices;
+        robin_hood::unordered_map<unsigned int, unsigned int> m_vertex_indices;
+        std::vector<unsigned int> m_offsets;
+        std::vector<unsigned int> m_neighbors;
+        std::vector<float> m_costs;
+        std::vector<std::shared_ptr<Edge>> m_edges;
+        std::vector<unsigned int> m_edge_indices;
+        unsigned int m_num_edges = 0;
+    };
+}  // namespace grstapse
\ No newline at end of file
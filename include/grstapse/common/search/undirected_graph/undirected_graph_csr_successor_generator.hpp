@@ -0,0 +1,76 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <memory>
+#include <vector>
+// Local
+#include "grstapse/common/search/successor_generator_base.hpp"
+#include "grstapse/common/search/undirected_graph/undirected_graph_csr.hpp"
+
+namespace grstapse
+{
+    /**!
+     * Generates the successors for a node by iterating the neighbors of its vertex in a frozen CSR layout of the graph
+     *
+     * \tparam UndirectedGraphSearchNodeDeriv A derivative of UndirectedGraphSearchNodeBase
+     */
+    template <typename UndirectedGraphSearchNodeDeriv>
+    class UndirectedGraphCsrSuccessorGenerator : public SuccessorGeneratorBase<UndirectedGraphSearchNodeDeriv>
+    {
+       public:
+        using Csr = UndirectedGraphCsr<typename UndirectedGraphSearchNodeDeriv::Graph::Payload>;
+
+        //! Constructor
+        explicit UndirectedGraphCsrSuccessorGenerator(const std::shared_ptr<const Csr>& csr)
+            : m_csr(csr)
+        {}
+
+        //! \copydoc SuccessorGeneratorBase
+        [[nodiscard]] std::vector<std::shared_ptr<UndirectedGraphSearchNodeDeriv>> operator()(
+            const std::shared_ptr<UndirectedGraphSearchNodeDeriv>& base) const final override
+        {
+            // Only nodes that were not generated by this layout (i.e. the root) need their index looked up
+            const unsigned int index =
+                base->csr() == m_csr.get() ? base->csrIndex() : m_csr->index(base->vertex()->id());
+            std::vector<std::shared_ptr<UndirectedGraphSearchNodeDeriv>> rv;
+            rv.reserve(m_csr->end(index) - m_csr->begin(index));
+            for(unsigned int entry = m_csr->begin(index), end = m_csr->end(index); entry < end; ++entry)
+            {
+                rv.push_back(
+                    std::make_shared<UndirectedGraphSearchNodeDeriv>(*m_csr, m_csr->neighbor(entry), entry, base));
+            }
+            return rv;
+        }
+
+       protected:
+        //! \copydoc SuccessorGeneratorBase
+        bool isValidNode(const std::shared_ptr<const UndirectedGraphSearchNodeDeriv>& node) const final override
+        {
+            return true;
+        }
+
+        std::shared_ptr<const Csr> m_csr;
+    };
+}  // namespace grstapse
\ No newline at end of file
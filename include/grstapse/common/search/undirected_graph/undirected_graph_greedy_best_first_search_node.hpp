@@ -56,5 +56,21 @@ namespace grstapse
             const std::shared_ptr<const UndirectedGraphGreedyBestFirstSearchNode>& parent = nullptr)
             : Base(vertex, last_edge, parent)
         {}
+
+        /**!
+         * Constructor for a search node generated from a CSR layout
+         *
+         * \param csr A CSR layout of an undirected graph (must outlive the search node)
+         * \param index The dense index of the vertex in \p csr
+         * \param entry The entry in \p csr of the edge connecting the previous vertex in the search to the vertex
+         * \param parent The previous vertex in the search
+         */
+        UndirectedGraphGreedyBestFirstSearchNode(
+            const typename Base::Csr& csr,
+            const unsigned int index,
+            const unsigned int entry,
+            const std::shared_ptr<const UndirectedGraphGreedyBestFirstSearchNode>& parent)
+            : Base(csr, index, entry, parent)
+        {}
     };
 }  // namespace grstapse
\ No newline at end of file
@@ -26,6 +26,7 @@
 #include <memory>
 // Local
 #include "grstapse/common/search/undirected_graph/undirected_graph.hpp"
+#include "grstapse/common/search/undirected_graph/undirected_graph_csr.hpp"
 
 namespace grstapse
 {
@@ -48,23 +49,36 @@ namespace grstapse
         using Graph  = UndirectedGraph<VertexPayload>;
         using Vertex = typename Graph::Vertex;
         using Edge   = typename Graph::Edge;
+        using Csr    = UndirectedGraphCsr<VertexPayload>;
 
         //! \returns The vertex this search node represents
         [[nodiscard]] inline const std::shared_ptr<Vertex>& vertex() const
         {
-            return m_vertex;
+            return m_csr != nullptr ? m_csr->vertex(m_csr_index) : m_vertex;
         }
 
         //! \returns The edge connecting the previous vertex in the search to the underlying vertex
         [[nodiscard]] inline const std::shared_ptr<Edge>& lastEdge() const
         {
-            return m_last_edge;
+            return m_csr != nullptr ? m_csr->edge(m_csr_entry) : m_last_edge;
+        }
+
+        //! \returns The CSR layout this search node was generated from (nullptr if it was not)
+        [[nodiscard]] inline const Csr* csr() const
+        {
+            return m_csr;
+        }
+
+        //! \returns The dense index of the underlying vertex in csr()
+        [[nodiscard]] inline unsigned int csrIndex() const
+        {
+            return m_csr_index;
         }
 
         //! \copydoc SearchNodeBase
         [[nodiscard]] virtual unsigned int hash() const final override
         {
-            return m_vertex->id();
+            return vertex()->id();
         }
 
        protected:
@@ -82,9 +96,38 @@ namespace grstapse
             : Base(vertex->id(), parent)
             , m_vertex(vertex)
             , m_last_edge(last_edge)
+            , m_csr(nullptr)
+            , m_csr_index(0)
+            , m_csr_entry(0)
+        {}
+
+        /**!
+         * Constructor for a search node generated from a CSR layout
+         *
+         * Only the indices into \p csr are stored so that generating a successor does not copy the vertex and edge
+         *
+         * \param csr A CSR layout of an undirected graph (must outlive the search node)
+         * \param index The dense index of the vertex in \p csr
+         * \param entry The entry in \p csr of the edge connecting the previous vertex in the search to the vertex
+         * \param parent The previous vertex in the search
+         */
+        UndirectedGraphSearchNodeBase(
+            const Csr& csr,
+            const unsigned int index,
+            const unsigned int entry,
+            const std::shared_ptr<const UndirectedGraphSearchNodeDeriv<VertexPayload>>& parent)
+            : Base(csr.vertex(index)->id(), parent)
+            , m_vertex(nullptr)
+            , m_last_edge(nullptr)
+            , m_csr(&csr)
+            , m_csr_index(index)
+            , m_csr_entry(entry)
         {}
 
         std::shared_ptr<Vertex> m_vertex;
         std::shared_ptr<Edge> m_last_edge;
+        const Csr* m_csr;  //!< Non-owning
+        unsigned int m_csr_index;
+        unsigned int m_csr_entry;
     };
 }  // namespace grstapse
\ No newline at end of file
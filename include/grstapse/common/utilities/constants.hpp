@@ -35,6 +35,7 @@ namespace grstapse::constants
     extern const char* k_connection_range;
     extern const char* k_convergence_epislon;
     extern const char* k_cost;
+    extern const char* k_decomposition_gap;
     extern const char* k_desired_traits;
     extern const char* k_domain_filepath;
     extern const char* k_dubins;
@@ -45,6 +46,7 @@ namespace grstapse::constants
     extern const char* k_execution_motion_plan;
     extern const char* k_fcpop_parameters;
     extern const char* k_finish_timepoint;
+    extern const char* k_geodesic_transition_heuristic;
     extern const char* k_goal_type;
     extern const char* k_graph_type;
     extern const char* k_heuristic_time;
@@ -91,9 +93,14 @@ namespace grstapse::constants
     extern const char* k_qy;
     extern const char* k_qz;
     extern const char* k_resolution;
+    extern const char* k_reuse_roadmap;
+    extern const char* k_roadmap_construction_time;
+    extern const char* k_roadmap_directory;
     extern const char* k_robot_traits_matrix_reduction;
     extern const char* k_robots;
     extern const char* k_rotation;
+    extern const char* k_scenario_threads;
+    extern const char* k_scenarios_per_iteration;
     extern const char* k_scheduler_parameters;
     extern const char* k_scheduler_type;
     extern const char* k_scheduling_time;
@@ -127,6 +134,7 @@ namespace grstapse::constants
     extern const char* k_vertex_a;
     extern const char* k_vertex_b;
     extern const char* k_vertices;
+    extern const char* k_voxel_filepath;
     extern const char* k_x;
     extern const char* k_y;
     extern const char* k_yaml_filepath;
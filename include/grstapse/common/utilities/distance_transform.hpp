@@ -0,0 +1,43 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace grstapse
+{
+    /**!
+     * Computes the squared euclidean distance (in cells) from the center of every cell of a grid to the center of the
+     * nearest obstacle cell with the separable transform of Felzenszwalb & Huttenlocher
+     *
+     * \param obstacles Nonzero for the obstacle cells (the first dimension varies fastest)
+     * \param dimensions The number of cells along each axis
+     *
+     * \returns The squared distance of each cell (infinity if there are no obstacles)
+     */
+    [[nodiscard]] std::vector<float> squaredDistanceTransform(std::span<const uint8_t> obstacles,
+                                                              std::span<const unsigned int> dimensions);
+}  // namespace grstapse
\ No newline at end of file
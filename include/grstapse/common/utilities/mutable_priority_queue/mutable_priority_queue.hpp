@@ -227,7 +227,7 @@ namespace grstapse
          */
         [[nodiscard]] inline ordered_iterator ordered_end() const
         {
-            return m_heap.ordered_begin();
+            return m_heap.ordered_end();
         }
 
        private:
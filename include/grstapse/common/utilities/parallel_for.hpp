@@ -0,0 +1,136 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace grstapse
+{
+    /**!
+     * \returns The number of worker threads to use when \p num_threads are requested (0 requests one per hardware
+     *          thread)
+     */
+    inline unsigned int numWorkerThreads(unsigned int num_threads = 0)
+    {
+        if(num_threads == 0)
+        {
+            num_threads = std::thread::hardware_concurrency();
+        }
+        return std::max(num_threads, 1u);
+    }
+
+    /**!
+     * Calls \p function for each index in [\p begin, \p end) using a group of worker threads
+     *
+     * Indices are handed out one at a time so that uneven workloads stay balanced. The calling thread takes part in
+     * the work. If \p function throws then the remaining indices are skipped and the first exception is rethrown on
+     * the calling thread once all the workers have joined.
+     *
+     * \param begin The first index
+     * \param end One past the last index
+     * \param function Callable with the signature void(unsigned int index) or void(unsigned int index, unsigned int
+     *                 worker) where worker is in [0, numWorkerThreads(\p num_threads)) and identifies the calling
+     *                 thread (e.g. to reuse a scratch buffer per thread)
+     * \param num_threads The maximum number of threads to use (0 uses one per hardware thread)
+     */
+    template <typename Function>
+    void parallelFor(const unsigned int begin,
+                     const unsigned int end,
+                     Function&& function,
+                     unsigned int num_threads = 0)
+    {
+        if(begin >= end)
+        {
+            return;
+        }
+
+        auto call = [&function](const unsigned int i, const unsigned int worker)
+        {
+            if constexpr(std::is_invocable_v<Function, unsigned int, unsigned int>)
+            {
+                function(i, worker);
+            }
+            else
+            {
+                function(i);
+            }
+        };
+
+        num_threads = std::min(numWorkerThreads(num_threads), end - begin);
+        if(num_threads == 1)
+        {
+            for(unsigned int i = begin; i < end; ++i)
+            {
+                call(i, 0);
+            }
+            return;
+        }
+
+        std::atomic<unsigned int> next(begin);
+        std::exception_ptr exception = nullptr;
+        std::mutex exception_mutex;
+        auto worker = [&](const unsigned int worker_nr)
+        {
+            for(unsigned int i = next.fetch_add(1); i < end; i = next.fetch_add(1))
+            {
+                try
+                {
+                    call(i, worker_nr);
+                }
+                catch(...)
+                {
+                    std::lock_guard<std::mutex> lock(exception_mutex);
+                    if(exception == nullptr)
+                    {
+                        exception = std::current_exception();
+                    }
+                    next.store(end);
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(num_threads - 1);
+        for(unsigned int i = 1; i < num_threads; ++i)
+        {
+            workers.emplace_back(worker, i);
+        }
+        worker(0);
+        for(std::thread& thread: workers)
+        {
+            thread.join();
+        }
+
+        if(exception != nullptr)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+}  // namespace grstapse
\ No newline at end of file
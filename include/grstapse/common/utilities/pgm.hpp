@@ -24,15 +24,24 @@
 
 // Global
 #include <cassert>
+#include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
+// Local
+#include "grstapse/common/utilities/noncopyable.hpp"
 
 namespace grstapse
 {
     /**!
      * Load and save pgm files
+     *
+     * Binary (P5) images are memory-mapped and the pixels are a read-only view into the mapping, so loading does not
+     * copy (or even read) the pixels up front. ASCII (P2) images are parsed into memory.
+     *
+     * \see PgmRegistry to share a single mapping between users of the same file
      */
-    class Pgm
+    class Pgm : public Noncopyable
     {
        public:
         //! Default Constructor
@@ -41,11 +50,17 @@ namespace grstapse
         //! Constructor
         explicit Pgm(const std::string& filepath);
 
+        //! Constructor for an image in memory (row-major pixels)
+        Pgm(unsigned int width, unsigned int height, std::vector<uint8_t> pixels);
+
+        //! Destructor
+        ~Pgm();
+
         //! Load the image from a .pgm file
         void loadFile(const std::string& filepath);
 
-        //! Saves the image to a .pgm file
-        void saveFile(const std::string& filepath);
+        //! Saves the image to a binary (P5) .pgm file
+        void saveFile(const std::string& filepath) const;
 
         //! \returns The width of the loaded image
         [[nodiscard]] inline unsigned int width() const
@@ -59,22 +74,35 @@ namespace grstapse
             return m_height;
         }
 
-        const std::vector<unsigned int>& pixels() const
+        //! \returns The pixels of the image (row-major)
+        [[nodiscard]] inline std::span<const uint8_t> pixels() const
         {
-            return m_pixels;
+            return {m_pixels, static_cast<std::size_t>(m_width) * m_height};
         }
 
-        [[nodiscard]] inline unsigned int pixel(const unsigned int row, const unsigned int column) const
+        [[nodiscard]] inline uint8_t pixel(const unsigned int row, const unsigned int column) const
         {
             assert(row < m_height);
             assert(column < m_width);
-            return m_pixels[row * m_width + column];
+            return m_pixels[static_cast<std::size_t>(row) * m_width + column];
+        }
+
+        //! \returns Whether the pixels are a view into a memory-mapped file
+        [[nodiscard]] inline bool isMapped() const
+        {
+            return m_mapping != nullptr;
         }
 
        private:
-        std::vector<unsigned int> m_pixels;
-        unsigned int m_width;
-        unsigned int m_height;
+        //! Releases the current image
+        void clear();
+
+        const uint8_t* m_pixels = nullptr;
+        std::vector<uint8_t> m_owned_pixels;  //!< Backing for images that are not memory-mapped
+        void* m_mapping            = nullptr;
+        std::size_t m_mapping_size = 0;
+        unsigned int m_width       = 0;
+        unsigned int m_height      = 0;
     };
 
 }  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,67 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <memory>
+#include <mutex>
+#include <string>
+// External
+#include <robin_hood/robin_hood.hpp>
+// Local
+#include "grstapse/common/utilities/noncopyable.hpp"
+
+namespace grstapse
+{
+    // Forward Declarations
+    class Pgm;
+
+    /**!
+     * Global singleton that shares loaded pgm images across the process
+     *
+     * Images are keyed by their canonical filepath and only weakly referenced, so an image (and its mapping) is
+     * released once the last user drops it.
+     *
+     * \note Thread-safe
+     */
+    class PgmRegistry : public Noncopyable
+    {
+       public:
+        //! \returns The singleton instance of this class
+        static PgmRegistry& instance();
+
+        //! \returns The image at \p filepath (loading it if it is not already loaded)
+        [[nodiscard]] std::shared_ptr<const Pgm> load(const std::string& filepath);
+
+        //! \returns The number of images that are currently loaded
+        [[nodiscard]] unsigned int size() const;
+
+       private:
+        //! Constructor
+        PgmRegistry() = default;
+
+        robin_hood::unordered_map<std::string, std::weak_ptr<const Pgm>> m_images;
+        mutable std::mutex m_mutex;  //!< mutable so that it can be used to lock const functions
+    };
+
+}  // namespace grstapse
\ No newline at end of file
@@ -22,6 +22,8 @@
  */
 #pragma once
 
+// Global
+#include <mutex>
 // External
 #include <robin_hood/robin_hood.hpp>
 // Local
@@ -33,6 +35,9 @@ namespace grstapse
     /**!
      * Global singleton that stores the times for named timers
      *
+     * \note Thread-safe. A named timer runs while at least one caller has started it and not yet stopped it, so
+     *       concurrent (or nested) uses of the same name measure the wall-clock time that the name was active.
+     *
      * \see Timer
      */
     class TimeKeeper : public Noncopyable
@@ -57,6 +62,8 @@ namespace grstapse
         //! Constructor
         TimeKeeper() = default;
         robin_hood::unordered_map<std::string, Timer> m_timers;
+        robin_hood::unordered_map<std::string, unsigned int> m_num_running;  //!< Number of active starts per timer
+        mutable std::mutex m_mutex;  //!< mutable so that it can be used to lock const functions
     };
 
 }  // namespace grstapse
\ No newline at end of file
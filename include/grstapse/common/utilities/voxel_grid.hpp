@@ -0,0 +1,122 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace grstapse
+{
+    /**!
+     * A 3D occupancy grid that is stored on disk as a sparse voxel octree
+     *
+     * File format (little endian):
+     *  - "GVOX" followed by the version (uint32)
+     *  - The number of voxels along x, y, and z (3 x uint32)
+     *  - The edge length of a voxel and the position of the minimum corner of the grid (4 x float)
+     *  - The octree in pre-order with 2 bits per node (4 nodes per byte, starting from the low bits): 0 for free, 1
+     *    for occupied, and 2 for a node whose 8 children follow (ordered by x, then y, then z). The root is the
+     *    smallest cube with a power of 2 edge that contains the grid and nodes entirely outside of the grid are free.
+     *
+     * Uniform regions collapse into a single node, so large open (or solid) volumes cost a couple of bits. The grid is
+     * expanded into one byte per voxel in memory for constant time lookups.
+     */
+    class VoxelGrid
+    {
+       public:
+        //! Default Constructor
+        VoxelGrid() = default;
+
+        //! Constructor
+        explicit VoxelGrid(const std::string& filepath);
+
+        /**!
+         * Constructor for a grid in memory
+         *
+         * \param dimensions The number of voxels along x, y, and z
+         * \param resolution The edge length of a voxel
+         * \param origin The position of the minimum corner of the grid
+         * \param occupancy Nonzero for the occupied voxels (x varies fastest, then y, then z)
+         */
+        VoxelGrid(const std::array<unsigned int, 3>& dimensions,
+                  float resolution,
+                  const std::array<float, 3>& origin,
+                  std::vector<uint8_t> occupancy);
+
+        //! Load the grid from a voxel octree file
+        void loadFile(const std::string& filepath);
+
+        //! Saves the grid to a voxel octree file
+        void saveFile(const std::string& filepath) const;
+
+        //! \returns The number of voxels along x, y, and z
+        [[nodiscard]] inline const std::array<unsigned int, 3>& dimensions() const
+        {
+            return m_dimensions;
+        }
+
+        //! \returns The edge length of a voxel
+        [[nodiscard]] inline float resolution() const
+        {
+            return m_resolution;
+        }
+
+        //! \returns The position of the minimum corner of the grid
+        [[nodiscard]] inline const std::array<float, 3>& origin() const
+        {
+            return m_origin;
+        }
+
+        //! \returns The occupancy of each voxel (x varies fastest, then y, then z)
+        [[nodiscard]] inline std::span<const uint8_t> occupancy() const
+        {
+            return m_occupancy;
+        }
+
+        //! \returns The index of the voxel (\p x, \p y, \p z)
+        [[nodiscard]] inline std::size_t index(const unsigned int x, const unsigned int y, const unsigned int z) const
+        {
+            assert(x < m_dimensions[0]);
+            assert(y < m_dimensions[1]);
+            assert(z < m_dimensions[2]);
+            return (static_cast<std::size_t>(z) * m_dimensions[1] + y) * m_dimensions[0] + x;
+        }
+
+        //! \returns Whether the voxel (\p x, \p y, \p z) is occupied
+        [[nodiscard]] inline bool isOccupied(const unsigned int x, const unsigned int y, const unsigned int z) const
+        {
+            return m_occupancy[index(x, y, z)] != 0;
+        }
+
+       private:
+        std::array<unsigned int, 3> m_dimensions = {0, 0, 0};
+        float m_resolution                       = 1.0f;
+        std::array<float, 3> m_origin            = {0.0f, 0.0f, 0.0f};
+        std::vector<uint8_t> m_occupancy;
+    };
+}  // namespace grstapse
\ No newline at end of file
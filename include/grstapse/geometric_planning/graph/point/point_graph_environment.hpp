@@ -24,8 +24,10 @@
 
 // Local
 #include "grstapse/common/search/undirected_graph/undirected_graph.hpp"
+#include "grstapse/common/search/undirected_graph/undirected_graph_csr.hpp"
 #include "grstapse/geometric_planning/graph/graph_environment.hpp"
 #include "grstapse/geometric_planning/graph/point/point_graph_configuration.hpp"
+#include "grstapse/geometric_planning/graph/point/point_graph_landmarks.hpp"
 
 #include "sampled_point_graph_environment.hpp"
 
@@ -42,16 +44,50 @@ namespace grstapse
         //! Constructor
         PointGraphEnvironment();
 
-        [[nodiscard]] std::shared_ptr<PointGraphEnvironment> shallowCopy() const;
-
         //!
         [[nodiscard]] std::shared_ptr<UndirectedGraph<PointGraphConfiguration>::Vertex> findVertex(
             const std::shared_ptr<const PointGraphConfiguration>& configuration) const;
 
         //! \copydoc EnvironmentBase
         [[nodiscard]] float longestPath() const final override;
+
+        /**!
+         * Builds the frozen CSR layout of the graph (if it has not been built already)
+         *
+         * \note Vertices and edges added afterwards are not part of the CSR layout
+         */
+        void freeze();
+
+        //! \returns The frozen CSR layout of the graph (nullptr if freeze has not been called)
+        [[nodiscard]] inline const std::shared_ptr<const UndirectedGraphCsr<PointGraphConfiguration>>& csr() const;
+
+        /**!
+         * Selects up to \p num_landmarks landmarks and computes the cost from each of them to every vertex (if it
+         * has not been done already)
+         *
+         * \note Freezes the graph
+         */
+        void computeLandmarks(unsigned int num_landmarks = 8);
+
+        //! \returns The landmarks for ALT heuristics (nullptr if computeLandmarks has not been called)
+        [[nodiscard]] inline const std::shared_ptr<const PointGraphLandmarks>& landmarks() const;
+
+       private:
+        std::shared_ptr<const UndirectedGraphCsr<PointGraphConfiguration>> m_csr;
+        std::shared_ptr<const PointGraphLandmarks> m_landmarks;
     };
 
     void from_json(const nlohmann::json& j, PointGraphEnvironment& environment);
 
+    // Inline Functions
+    const std::shared_ptr<const UndirectedGraphCsr<PointGraphConfiguration>>& PointGraphEnvironment::csr() const
+    {
+        return m_csr;
+    }
+
+    const std::shared_ptr<const PointGraphLandmarks>& PointGraphEnvironment::landmarks() const
+    {
+        return m_landmarks;
+    }
+
 }  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,69 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <algorithm>
+#include <memory>
+// Local
+#include "grstapse/common/search/heuristic_base.hpp"
+#include "grstapse/common/search/undirected_graph/undirected_graph_search_node.hpp"
+#include "grstapse/geometric_planning/graph/point/point_graph_configuration.hpp"
+#include "grstapse/geometric_planning/graph/point/point_graph_landmarks.hpp"
+
+namespace grstapse
+{
+    /**!
+     * A heuristic that uses the larger of the euclidean distance to the goal and the ALT lower bound from the
+     * landmarks of the graph
+     *
+     * \tparam UndirectedGraphSearchNodeDeriv
+     */
+    template <typename UndirectedGraphSearchNodeDeriv>
+    class PointGraphLandmarkHeuristic : public HeuristicBase<UndirectedGraphSearchNodeDeriv>
+    {
+       public:
+        //! Constructor
+        PointGraphLandmarkHeuristic(const std::shared_ptr<const PointGraphLandmarks>& landmarks,
+                                    const std::shared_ptr<const PointGraphConfiguration>& goal)
+            : m_landmarks(landmarks)
+            , m_goal(goal)
+            , m_goal_index(landmarks->csr().index(goal->id()))
+        {}
+
+        //! \copydoc HeuristicBase
+        [[nodiscard]] virtual float operator()(
+            const std::shared_ptr<UndirectedGraphSearchNodeDeriv>& node) const final override
+        {
+            const auto& vertex = node->vertex();
+            return std::max(vertex->payload()->euclideanDistance(*m_goal),
+                            m_landmarks->lowerBound(m_landmarks->csr().index(vertex->id()), m_goal_index));
+        }
+
+       private:
+        std::shared_ptr<const PointGraphLandmarks> m_landmarks;
+        std::shared_ptr<const PointGraphConfiguration> m_goal;
+        unsigned int m_goal_index;
+    };
+
+}  // namespace grstapse
\ No newline at end of file
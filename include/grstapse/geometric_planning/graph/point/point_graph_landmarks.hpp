@@ -0,0 +1,102 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <memory>
+#include <vector>
+// External
+// Local
+#include "grstapse/common/search/undirected_graph/undirected_graph_csr.hpp"
+
+namespace grstapse
+{
+    // Forward Declarations
+    class PointGraphConfiguration;
+
+    /**!
+     * Precomputed distances from a small set of landmark vertices for ALT (A*, landmarks, triangle inequality)
+     * lower bounds on the cost between two vertices of a point graph
+     *
+     * Landmarks are selected farthest first: each new landmark is the vertex whose cost to the closest landmark
+     * selected so far is largest (vertices not connected to any landmark are picked first, so every connected
+     * component gets a landmark).
+     */
+    class PointGraphLandmarks
+    {
+       public:
+        /**!
+         * Constructor
+         *
+         * \param csr The frozen layout of the graph
+         * \param num_landmarks The maximum number of landmarks to select
+         */
+        PointGraphLandmarks(const std::shared_ptr<const UndirectedGraphCsr<PointGraphConfiguration>>& csr,
+                            unsigned int num_landmarks);
+
+        //! \returns The number of landmarks
+        [[nodiscard]] inline unsigned int numLandmarks() const;
+
+        //! \returns The dense index of the \p landmark'th landmark
+        [[nodiscard]] inline unsigned int landmark(unsigned int landmark) const;
+
+        //! \returns The cost from the \p landmark'th landmark to the vertex with dense index \p vertex
+        [[nodiscard]] inline float distance(unsigned int vertex, unsigned int landmark) const;
+
+        /**!
+         * \returns A lower bound on the cost between the vertices with dense indices \p a and \p b
+         *
+         * \note Landmarks that are not connected to both vertices do not contribute to the bound
+         */
+        [[nodiscard]] float lowerBound(unsigned int a, unsigned int b) const;
+
+        //! \returns The frozen layout of the graph
+        [[nodiscard]] inline const UndirectedGraphCsr<PointGraphConfiguration>& csr() const;
+
+       private:
+        std::shared_ptr<const UndirectedGraphCsr<PointGraphConfiguration>> m_csr;
+        std::vector<unsigned int> m_landmarks;
+        std::vector<float> m_distances;  //!< Vertex major: [vertex * numLandmarks() + landmark]
+    };
+
+    // Inline Functions
+    unsigned int PointGraphLandmarks::numLandmarks() const
+    {
+        return m_landmarks.size();
+    }
+
+    unsigned int PointGraphLandmarks::landmark(unsigned int landmark) const
+    {
+        return m_landmarks[landmark];
+    }
+
+    float PointGraphLandmarks::distance(unsigned int vertex, unsigned int landmark) const
+    {
+        return m_distances[static_cast<std::size_t>(vertex) * m_landmarks.size() + landmark];
+    }
+
+    const UndirectedGraphCsr<PointGraphConfiguration>& PointGraphLandmarks::csr() const
+    {
+        return *m_csr;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -33,10 +33,14 @@ namespace grstapse
 {
     // Forward Declarations
     class PointGraphEnvironment;
+    class PointGraphShortestPaths;
 
     /**!
      *  A motion planner that conducts an A* search through an undirected graph where each vertex represents a point
-     *  in 2D space
+     *  in 2D space (guided by the landmarks of the graph, \see PointGraphLandmarkHeuristic)
+     *
+     *  Queries to or from a precomputed configuration are instead answered from the shortest path trees of
+     *  PointGraphShortestPaths
      */
     class PointGraphMotionPlanner : public GraphMotionPlannerBase
     {
@@ -47,6 +51,27 @@ namespace grstapse
         PointGraphMotionPlanner(const std::shared_ptr<const MotionPlannerParametersBase>& parameters,
                                 const std::shared_ptr<PointGraphEnvironment>& graph);
 
+        //! \copydoc MotionPlannerBase
+        [[nodiscard]] float durationQuery(const std::shared_ptr<const Species>& species,
+                                          const std::shared_ptr<const ConfigurationBase>& initial_configuration,
+                                          const std::shared_ptr<const ConfigurationBase>& goal_configuration) override;
+
+        //! \returns Whether the path has been memoized or is covered by the precomputed shortest paths
+        [[nodiscard]] bool isMemoized(
+            const std::shared_ptr<const Species>& species,
+            const std::shared_ptr<const ConfigurationBase>& initial_configuration,
+            const std::shared_ptr<const ConfigurationBase>& goal_configuration) const override;
+
+        /**!
+         * Runs a Dijkstra search from the vertex of each of \p configurations (replacing any previous precomputation)
+         *
+         * \note Not safe to call concurrently with queries
+         */
+        void precompute(const std::vector<std::shared_ptr<const ConfigurationBase>>& configurations) override;
+
+        //! \returns The precomputed shortest paths (nullptr if precompute has not been called)
+        [[nodiscard]] inline const std::shared_ptr<const PointGraphShortestPaths>& shortestPaths() const;
+
        protected:
         //! \copydoc MotionPlannerBase
         std::shared_ptr<const MotionPlanningQueryResultBase> computeMotionPlan(
@@ -57,6 +82,13 @@ namespace grstapse
         std::shared_ptr<const BestFirstSearchParameters> m_search_parameters;
         AStarFunctors<SearchNode> m_astar_functors;
         std::shared_ptr<PointGraphEnvironment> m_graph;
+        std::shared_ptr<const PointGraphShortestPaths> m_shortest_paths;
     };
 
+    // Inline Functions
+    const std::shared_ptr<const PointGraphShortestPaths>& PointGraphMotionPlanner::shortestPaths() const
+    {
+        return m_shortest_paths;
+    }
+
 }  // namespace grstapse
\ No newline at end of file
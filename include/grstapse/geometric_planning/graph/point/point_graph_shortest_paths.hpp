@@ -0,0 +1,109 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <memory>
+#include <optional>
+#include <vector>
+// External
+#include <robin_hood/robin_hood.hpp>
+// Local
+#include "grstapse/common/search/undirected_graph/undirected_graph_csr.hpp"
+
+namespace grstapse
+{
+    // Forward Declarations
+    class PointGraphConfiguration;
+    class PointGraphEnvironment;
+
+    /**!
+     * Shortest paths from a small set of source vertices (e.g. task and robot start locations) to every vertex of a
+     * point graph
+     *
+     * One Dijkstra search is run per source (in parallel) and the distances and predecessor trees are stored, so that
+     * path lengths are answered in O(1) and paths by walking the predecessor tree
+     */
+    class PointGraphShortestPaths
+    {
+       public:
+        /**!
+         * Constructor
+         *
+         * \param graph The graph to search (its CSR layout is used if it has been frozen)
+         * \param source_ids The ids of the source vertices
+         * \param num_threads The maximum number of Dijkstra searches to run in parallel (0 for hardware concurrency)
+         */
+        PointGraphShortestPaths(const std::shared_ptr<const PointGraphEnvironment>& graph,
+                                const std::vector<unsigned int>& source_ids,
+                                unsigned int num_threads = 0);
+
+        //! \returns Whether a shortest path between the vertices \p a and \p b is stored
+        [[nodiscard]] inline bool contains(unsigned int a, unsigned int b) const;
+
+        /**!
+         * \returns The euclidean length of the shortest path (by edge cost) between the vertices \p a and \p b, if it
+         *          is stored and exists
+         */
+        [[nodiscard]] std::optional<float> pathLength(unsigned int a, unsigned int b) const;
+
+        //! \returns The shortest path from vertex \p a to vertex \p b (empty if there is none or it is not stored)
+        [[nodiscard]] std::vector<std::shared_ptr<PointGraphConfiguration>> path(unsigned int a, unsigned int b) const;
+
+        //! \returns The number of source vertices
+        [[nodiscard]] inline unsigned int numSources() const;
+
+       private:
+        //! Results of a Dijkstra search from a single source
+        struct ShortestPathTree
+        {
+            std::vector<float> costs;       //!< Total edge cost to each vertex
+            std::vector<float> lengths;     //!< Euclidean length of the path to each vertex
+            std::vector<int> predecessors;  //!< Index of the predecessor on the path (-1 for the source/unreachable)
+        };
+
+        //! Runs Dijkstra from the vertex with index \p source
+        [[nodiscard]] ShortestPathTree dijkstra(unsigned int source) const;
+
+        //! \returns The tree and the index of the other vertex for a pair of vertex ids, if stored
+        [[nodiscard]] std::optional<std::pair<const ShortestPathTree*, unsigned int>> findTree(unsigned int a,
+                                                                                               unsigned int b) const;
+
+        std::shared_ptr<const UndirectedGraphCsr<PointGraphConfiguration>> m_csr;
+
+        robin_hood::unordered_map<unsigned int, unsigned int> m_source_indices;  //!< Vertex id -> tree index
+        std::vector<ShortestPathTree> m_trees;
+    };
+
+    // Inline Functions
+    bool PointGraphShortestPaths::contains(unsigned int a, unsigned int b) const
+    {
+        return m_csr->contains(a) && m_csr->contains(b) &&
+               (m_source_indices.contains(a) || m_source_indices.contains(b));
+    }
+
+    unsigned int PointGraphShortestPaths::numSources() const
+    {
+        return m_trees.size();
+    }
+}  // namespace grstapse
\ No newline at end of file
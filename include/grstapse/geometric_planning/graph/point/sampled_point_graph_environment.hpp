@@ -23,6 +23,9 @@
 #pragma once
 
 // Global
+#include <memory>
+#include <mutex>
+#include <vector>
 // External
 // Local
 #include "grstapse/geometric_planning/graph/graph_environment.hpp"
@@ -33,7 +36,12 @@ namespace grstapse
     class PointGraphEnvironment;
 
     /**!
+     * An environment for a point graph whose edge costs (and existence) are sampled
      *
+     * All the samples share a single topology (the union of the edges of the samples) and the edge costs are stored
+     * in a contiguous matrix with the samples of an edge next to each other, so that a search can relax an edge for a
+     * block of samples at once (\see SampledPointGraphShortestPaths). An edge that does not exist in a sample has an
+     * infinite cost in that sample.
      */
     class SampledPointGraphEnvironment : public GraphEnvironment
     {
@@ -41,36 +49,64 @@ namespace grstapse
         //! Constructor
         SampledPointGraphEnvironment();
 
-        //! Adds one of the sampled graphs
-        inline void addGraph(const std::shared_ptr<PointGraphEnvironment>& g);
-
-        //! \returns The \p index'th graph environment
+        /**!
+         * \returns A graph with the edges of the \p index'th sample
+         *
+         * \note The graph is built (and cached) when first requested; searches should use topology and edgeCosts
+         */
         [[nodiscard]] const std::shared_ptr<PointGraphEnvironment>& graph(unsigned int index) const;
 
         //! \returns The number of sampled graphs
         [[nodiscard]] inline unsigned int numGraphs() const;
 
+        //! \returns The graph with the union of the edges of all the samples (frozen)
+        [[nodiscard]] inline const std::shared_ptr<PointGraphEnvironment>& topology() const;
+
+        /**!
+         * \returns The costs of the edge with dense index \p edge_index (\see UndirectedGraphCsr) for each sample
+         *          (numGraphs contiguous values)
+         */
+        [[nodiscard]] inline const float* edgeCosts(unsigned int edge_index) const;
+
+        //! \returns The cost of the edge with dense index \p edge_index in the \p sample'th sample
+        [[nodiscard]] inline float edgeCost(unsigned int edge_index, unsigned int sample) const;
+
         //! \copydoc EnvironmentBase
         [[nodiscard]] float longestPath() const override;
 
        private:
-        std::vector<std::shared_ptr<PointGraphEnvironment>> m_graphs;
+        std::shared_ptr<PointGraphEnvironment> m_topology;
+        unsigned int m_num_samples;
+        std::vector<float> m_edge_costs;  //!< edge major: [edge_index * m_num_samples + sample]
 
-        friend class PointGraphEnvironment;
+        mutable std::mutex m_graphs_mutex;
+        mutable std::vector<std::shared_ptr<PointGraphEnvironment>> m_graphs;
+
+        friend void from_json(const nlohmann::json& j, SampledPointGraphEnvironment& environment);
     };
 
     //! Deserialize from json
     void from_json(const nlohmann::json& j, SampledPointGraphEnvironment& environment);
 
     // Inline functions
-    void SampledPointGraphEnvironment::addGraph(const std::shared_ptr<PointGraphEnvironment>& g)
+    unsigned int SampledPointGraphEnvironment::numGraphs() const
     {
-        m_graphs.push_back(g);
+        return m_num_samples;
     }
 
-    unsigned int SampledPointGraphEnvironment::numGraphs() const
+    const std::shared_ptr<PointGraphEnvironment>& SampledPointGraphEnvironment::topology() const
+    {
+        return m_topology;
+    }
+
+    const float* SampledPointGraphEnvironment::edgeCosts(unsigned int edge_index) const
+    {
+        return m_edge_costs.data() + edge_index * m_num_samples;
+    }
+
+    float SampledPointGraphEnvironment::edgeCost(unsigned int edge_index, unsigned int sample) const
     {
-        return m_graphs.size();
+        return m_edge_costs[edge_index * m_num_samples + sample];
     }
 
 }  // namespace grstapse
\ No newline at end of file
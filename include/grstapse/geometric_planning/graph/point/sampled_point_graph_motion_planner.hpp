@@ -22,6 +22,12 @@
  */
 #pragma once
 
+// Global
+#include <memory>
+#include <mutex>
+#include <vector>
+// External
+#include <robin_hood/robin_hood.hpp>
 // Local
 #include "grstapse/geometric_planning/graph/graph_motion_planner_base.hpp"
 
@@ -29,11 +35,14 @@ namespace grstapse
 {
     // Forward Declarations
     class PointGraphConfiguration;
-    class PointGraphMotionPlanner;
     class SampledPointGraphEnvironment;
+    class SampledPointGraphShortestPaths;
 
     /**!
+     * A motion planner for a sampled point graph
      *
+     * Queries are answered from shortest path trees that cover every sample at once (\see
+     * SampledPointGraphShortestPaths), which are computed the first time a vertex is used as an endpoint and cached
      */
     class SampledPointGraphMotionPlanner : public GraphMotionPlannerBase
     {
@@ -65,6 +74,8 @@ namespace grstapse
          * \param goal_configuration The target geometric configuration of the robot
          *
          * \returns Whether a path from \p start_state to \p goal_state has been memoized
+         *
+         * \note The shortest path trees cover every sample so \p index does not matter
          */
         [[nodiscard]] bool isMemoized(unsigned int index,
                                       const std::shared_ptr<const Species>& species,
@@ -86,6 +97,21 @@ namespace grstapse
                                           const std::shared_ptr<const PointGraphConfiguration>& initial_configuration,
                                           const std::shared_ptr<const PointGraphConfiguration>& goal_configuration);
 
+        /**!
+         * \returns The shortest path tree that answers the queries between \p initial_configuration and
+         *          \p goal_configuration in every graph (computing it if needed) and whether it is rooted at
+         *          \p goal_configuration
+         *
+         * \note Lets callers that repeat a query over many graphs resolve the tree once and read the path lengths
+         *       from it without taking the lock of the tree cache
+         */
+        [[nodiscard]] std::pair<std::shared_ptr<const SampledPointGraphShortestPaths>, bool> shortestPathTree(
+            const std::shared_ptr<const PointGraphConfiguration>& initial_configuration,
+            const std::shared_ptr<const PointGraphConfiguration>& goal_configuration);
+
+        //! Computes the shortest path trees from the vertex of each of \p configurations (in parallel)
+        void precompute(const std::vector<std::shared_ptr<const ConfigurationBase>>& configurations) override;
+
        protected:
         //! \copydoc MotionPlannerBase
         [[nodiscard]] std::shared_ptr<const MotionPlanningQueryResultBase> computeMotionPlan(
@@ -99,7 +125,19 @@ namespace grstapse
         using MotionPlannerBase::isMemoized;
         using MotionPlannerBase::query;
 
-        std::vector<std::shared_ptr<PointGraphMotionPlanner>> m_sub_motion_planners;
+        /**!
+         * \returns A shortest path tree rooted at either \p a or \p b (computing the tree from \p a if neither
+         *          exist) and whether it is rooted at \p b
+         */
+        [[nodiscard]] std::pair<std::shared_ptr<const SampledPointGraphShortestPaths>, bool> findOrComputeTree(
+            unsigned int a,
+            unsigned int b);
+
+        std::shared_ptr<const SampledPointGraphEnvironment> m_sampled_environment;
+
+        mutable std::mutex m_trees_mutex;
+        robin_hood::unordered_map<unsigned int, std::shared_ptr<const SampledPointGraphShortestPaths>>
+            m_trees;  //!< Source vertex id -> shortest path tree
     };
 
 }  // namespace grstapse
\ No newline at end of file
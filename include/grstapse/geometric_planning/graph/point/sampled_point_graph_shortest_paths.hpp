@@ -0,0 +1,99 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <memory>
+#include <optional>
+#include <vector>
+// External
+// Local
+#include "grstapse/common/search/undirected_graph/undirected_graph_csr.hpp"
+
+namespace grstapse
+{
+    // Forward Declarations
+    class PointGraphConfiguration;
+    class SampledPointGraphEnvironment;
+
+    /**!
+     * Shortest paths from a single source vertex to every vertex in every sample of a sampled point graph
+     *
+     * All the samples are searched at once over the shared topology: when a vertex is expanded each of its edges is
+     * relaxed for every sample in one contiguous (auto-vectorizable) loop over the per sample edge costs. The queue
+     * is ordered by the cheapest sample, which makes the search label correcting rather than label setting; a vertex
+     * is re-expanded if any of its samples improve after it has been expanded.
+     */
+    class SampledPointGraphShortestPaths
+    {
+       public:
+        /**!
+         * Constructor
+         *
+         * \param environment The sampled environment to search
+         * \param source_id The id of the source vertex
+         */
+        SampledPointGraphShortestPaths(const std::shared_ptr<const SampledPointGraphEnvironment>& environment,
+                                       unsigned int source_id);
+
+        //! \returns The id of the source vertex
+        [[nodiscard]] inline unsigned int sourceId() const;
+
+        //! \returns Whether the graph has a vertex with \p id
+        [[nodiscard]] inline bool contains(unsigned int id) const;
+
+        /**!
+         * \returns The euclidean length of the shortest path (by edge cost) from the source to the vertex with \p id
+         *          in the \p sample'th sample, if it exists
+         */
+        [[nodiscard]] std::optional<float> pathLength(unsigned int id, unsigned int sample) const;
+
+        /**!
+         * \returns The shortest path from the source to the vertex with \p id in the \p sample'th sample (empty if
+         *          there is none)
+         */
+        [[nodiscard]] std::vector<std::shared_ptr<PointGraphConfiguration>> path(unsigned int id,
+                                                                                 unsigned int sample) const;
+
+       private:
+        std::shared_ptr<const UndirectedGraphCsr<PointGraphConfiguration>> m_csr;
+        unsigned int m_source_id;
+        unsigned int m_num_samples;
+
+        // Vertex major: [vertex_index * m_num_samples + sample]
+        std::vector<float> m_costs;       //!< Total edge cost to each vertex
+        std::vector<float> m_lengths;     //!< Euclidean length of the path to each vertex
+        std::vector<int> m_predecessors;  //!< Index of the predecessor on the path (-1 for the source/unreachable)
+    };
+
+    // Inline Functions
+    unsigned int SampledPointGraphShortestPaths::sourceId() const
+    {
+        return m_source_id;
+    }
+
+    bool SampledPointGraphShortestPaths::contains(unsigned int id) const
+    {
+        return m_csr->contains(id);
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,72 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <concepts>
+#include <limits>
+#include <memory>
+
+// Local
+#include "grstapse/common/search/heuristic_base.hpp"
+#include "grstapse/geometric_planning/grid/grid_cell.hpp"
+#include "grstapse/geometric_planning/grid/grid_distance_table.hpp"
+
+namespace grstapse
+{
+    /**!
+     * A heuristic that looks up the length of the shortest path between a grid cell and the goal around the static
+     * obstacles of the grid
+     *
+     * \tparam GridCellDerive A derivative class of GridCell
+     */
+    template <typename GridCellDerive>
+    requires std::derived_from<GridCellDerive, GridCell>
+    // Note: GridCellDerive deriving from SearchNodeBase is checked in HeuristicBase
+    class GridCellTrueDistance : public HeuristicBase<GridCellDerive>
+    {
+       public:
+        /**!
+         * Constructor
+         *
+         * \param distances The distances to the grid cell the robot wants to be in
+         */
+        explicit GridCellTrueDistance(const std::shared_ptr<const GridDistanceTable>& distances)
+            : m_distances(distances)
+        {}
+
+        //!\returns The length of the shortest path between \p cell and the goal (infinity if there is none)
+        [[nodiscard]] inline float operator()(const std::shared_ptr<GridCellDerive>& cell) const final override
+        {
+            const unsigned int distance = m_distances->distance(cell->x(), cell->y());
+            if(distance == GridDistanceTable::k_unreachable)
+            {
+                return std::numeric_limits<float>::infinity();
+            }
+            return static_cast<float>(distance);
+        }
+
+       private:
+        std::shared_ptr<const GridDistanceTable> m_distances;
+    };
+}  // namespace grstapse
\ No newline at end of file
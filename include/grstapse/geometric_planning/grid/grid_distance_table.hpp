@@ -0,0 +1,83 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <cassert>
+#include <limits>
+#include <vector>
+
+namespace grstapse
+{
+    // Forward Declarations
+    class GridCell;
+    class GridMap;
+
+    /**!
+     * The length of the shortest 4-connected path from every cell of a grid to a goal cell
+     *
+     * Computed once with a breadth first search backwards from the goal, so it is a perfect heuristic for a robot
+     * moving through the static obstacles of the grid
+     *
+     * \see GridCellTrueDistance
+     */
+    class GridDistanceTable
+    {
+       public:
+        //! The distance of cells that cannot reach the goal
+        static constexpr unsigned int k_unreachable = std::numeric_limits<unsigned int>::max();
+
+        /**!
+         * Constructor
+         *
+         * \param map The grid
+         * \param goal The cell to compute the distances to
+         */
+        GridDistanceTable(const GridMap& map, const GridCell& goal);
+
+        //! \returns The length of the shortest path from (\p x, \p y) to the goal (k_unreachable if there is none)
+        [[nodiscard]] inline unsigned int distance(unsigned int x, unsigned int y) const;
+
+        //! \returns The length of the shortest path from \p cell to the goal (k_unreachable if there is none)
+        [[nodiscard]] unsigned int distance(const GridCell& cell) const;
+
+        //! \returns Whether there is a path from (\p x, \p y) to the goal
+        [[nodiscard]] inline bool isReachable(unsigned int x, unsigned int y) const;
+
+       private:
+        unsigned int m_width;
+        std::vector<unsigned int> m_distances;  //!< Row-major: [y * m_width + x]
+    };
+
+    // Inline functions
+    unsigned int GridDistanceTable::distance(const unsigned int x, const unsigned int y) const
+    {
+        assert(x < m_width && y * m_width + x < m_distances.size());
+        return m_distances[y * m_width + x];
+    }
+
+    bool GridDistanceTable::isReachable(const unsigned int x, const unsigned int y) const
+    {
+        return distance(x, y) != k_unreachable;
+    }
+}  // namespace grstapse
\ No newline at end of file
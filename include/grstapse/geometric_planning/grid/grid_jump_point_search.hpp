@@ -0,0 +1,68 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <memory>
+#include <optional>
+#include <vector>
+
+// Local
+#include "grstapse/geometric_planning/grid/grid_cell.hpp"
+
+namespace grstapse
+{
+    class GridMap;
+
+    /**!
+     * A jump point search through a uniform cost 2D grid with cardinal moves (the same moves as GridSearch)
+     *
+     * Only the jump points are added to the open list: horizontal jumps scan a row a word at a time and stop at
+     * a forced neighbor (a cell whose vertical neighbor is free while the vertical neighbor of the previous cell is
+     * blocked) or the goal, and vertical jumps stop at any cell from which a horizontal jump finds a jump point.
+     */
+    class GridJumpPointSearch
+    {
+       public:
+        //! Constructor
+        explicit GridJumpPointSearch(const std::shared_ptr<const GridMap>& map);
+
+        /**!
+         * \returns A shortest path (every cell, including \p initial and \p goal) from \p initial to \p goal (empty if
+         *          there is none)
+         */
+        [[nodiscard]] std::vector<GridCell> search(const GridCell& initial, const GridCell& goal) const;
+
+       private:
+        //! \returns Whether the cell is outside of the grid or an obstacle
+        [[nodiscard]] bool isBlocked(int x, int y) const;
+
+        //! \returns The x coordinate of the jump point found moving from (\p x, \p y) in direction \p dx
+        [[nodiscard]] std::optional<int> jumpHorizontal(int x, int y, int dx, const GridCell& goal) const;
+
+        //! \returns The y coordinate of the jump point found moving from (\p x, \p y) in direction \p dy
+        [[nodiscard]] std::optional<int> jumpVertical(int x, int y, int dy, const GridCell& goal) const;
+
+        std::shared_ptr<const GridMap> m_map;
+    };
+}  // namespace grstapse
\ No newline at end of file
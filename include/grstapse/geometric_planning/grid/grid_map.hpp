@@ -24,6 +24,7 @@
 
 // Global
 #include <cassert>
+#include <cstdint>
 #include <vector>
 
 // External
@@ -36,10 +37,17 @@ namespace grstapse
 {
     /**!
      * A 2D grid used for path planning
+     *
+     * Occupancy is stored row-major and bit-packed (one bit per cell, 64 cells per word, bit i of word k of row y is
+     * the cell (64k + i, y)) so that a row can be scanned a word at a time. The bits past the width of the grid in the
+     * last word of each row are set, so scans stop at the edge of the grid as if it were an obstacle.
      */
     class GridMap
     {
        public:
+        //! The number of cells in a word
+        static constexpr unsigned int k_word_size = 64;
+
         /**!
          * Constructor
          *
@@ -61,20 +69,44 @@ namespace grstapse
         //! \returns Whether the specified cell is an obstacle
         [[nodiscard]] inline bool isObstacle(unsigned int x, unsigned int y) const;
 
+        //! \returns The number of words in each row
+        [[nodiscard]] inline unsigned int wordsPerRow() const noexcept;
+
+        /**!
+         * \returns The obstacle bits of the \p k'th word of row \p y
+         *
+         * \note Words outside of the grid (including rows and words with negative indices) are all obstacles
+         */
+        [[nodiscard]] inline std::uint64_t word(int k, int y) const;
+
+        /**!
+         * \returns The x coordinate of the first obstacle in row \p y at or to the right of \p x (the width of the
+         *          grid if there is none)
+         */
+        [[nodiscard]] unsigned int nextObstacle(unsigned int x, unsigned int y) const;
+
+        /**!
+         * \returns The x coordinate of the first obstacle in row \p y at or to the left of \p x (-1 if there is
+         *          none)
+         */
+        [[nodiscard]] int previousObstacle(unsigned int x, unsigned int y) const;
+
        private:
-        std::vector<std::vector<bool>> m_map;
+        unsigned int m_width;
+        unsigned int m_height;
+        unsigned int m_words_per_row;
+        std::vector<std::uint64_t> m_words;  //!< Row-major: [y * m_words_per_row + x / k_word_size]
     };
 
     // Inline functions
     unsigned int GridMap::width() const noexcept
     {
-        return m_map.size();
+        return m_width;
     }
 
     unsigned int GridMap::height() const noexcept
     {
-        assert(!m_map.empty());
-        return m_map[0].size();
+        return m_height;
     }
 
     bool GridMap::isObstacle(const GridCell& cell) const
@@ -84,7 +116,21 @@ namespace grstapse
 
     bool GridMap::isObstacle(unsigned int x, unsigned int y) const
     {
-        assert(x < m_map.size() && y < m_map[x].size());
-        return m_map[x][y];
+        assert(x < m_width && y < m_height);
+        return (m_words[y * m_words_per_row + x / k_word_size] >> (x % k_word_size)) & 1;
+    }
+
+    unsigned int GridMap::wordsPerRow() const noexcept
+    {
+        return m_words_per_row;
+    }
+
+    std::uint64_t GridMap::word(int k, int y) const
+    {
+        if(y < 0 || y >= static_cast<int>(m_height) || k < 0 || k >= static_cast<int>(m_words_per_row))
+        {
+            return ~std::uint64_t(0);
+        }
+        return m_words[y * m_words_per_row + k];
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -22,6 +22,12 @@
  */
 #pragma once
 
+// Global
+#include <memory>
+#include <mutex>
+#include <set>
+#include <tuple>
+
 // Local
 #include "grstapse/common/search/search_algorithm_base.hpp"
 #include "grstapse/common/utilities/mutable_priority_queue/mutable_priority_queue.hpp"
@@ -31,9 +37,14 @@
 namespace grstapse
 {
     // Forward Declarations
+    class ConflictBase;
     class ConflictBasedSearchParameters;
+    class ConstraintTable;
     class ConstraintTreeNodeRoot;
     class ConstraintTreeNode;
+    class GridDistanceTable;
+    class GridPath;
+    class MultiValuedDecisionDiagram;
 
     /**!
      * Implementation of the Conflict-Based Search (CBS) algorithm.
@@ -48,6 +59,16 @@ namespace grstapse
      *       "Conflict-based search for optimal multi-agent pathfinding".
      *       Artif. Intell. 219:40-66 (2015)
      *
+     * With a suboptimality weight w > 1 this runs Enhanced CBS (ECBS) instead. Both levels become focal searches: the
+     * low level prefers paths with fewer conflicts with the other robots and the high level expands the node with
+     * the fewest conflicts among those that cost at most w times the lowest lower bound in the open set.
+     *
+     * \cite Max Barer, Guni Sharon, Roni Stern, Ariel Felner: "Suboptimal Variants of the Conflict-Based Search
+     *       Algorithm for the Multi-Agent Pathfinding Problem". SOCS 2014: 19-27
+     *
+     * With disjoint splitting, a conflict is resolved by requiring one robot to be at the conflict in one child and
+     * forbidding it in the other, so the children share no solutions (see ConflictBase::createDisjointConstraints).
+     *
      * \ref https://github.com/whoenig/libMultiRobotPlanning
      */
     class ConflictBaseSearch : public SearchAlgorithmBase<ConstraintTreeNodeBase, ConflictBasedSearchStatistics>
@@ -69,9 +90,30 @@ namespace grstapse
         SearchResults<ConstraintTreeNodeBase, ConflictBasedSearchStatistics> searchFromNode(
             const std::shared_ptr<ConstraintTreeNodeBase>& node) override;
 
+        /**!
+         * Conducts a search warm started from a previous solution (online replanning)
+         *
+         * The root is seeded with the previous paths of the robots that did not change, so only the changed robots are
+         * planned from scratch and only the conflicts they introduce are resolved. An unchanged robot is replanned only
+         * when one of those conflicts is branched on.
+         *
+         * \param previous_solution The path of each robot in the previous solution (e.g. the low level solutions of
+         *                          the goal of a previous search). They are shared, not copied
+         * \param changed_robots The robots whose start or goal changed (their previous paths are ignored)
+         *
+         * \returns The results of the search
+         *
+         * \note The unchanged robots keep their previous paths unless they are part of a conflict, so the result is
+         *       only optimal with respect to those paths
+         */
+        SearchResults<ConstraintTreeNodeBase, ConflictBasedSearchStatistics> searchFromSolution(
+            const std::vector<std::shared_ptr<const GridPath>>& previous_solution,
+            const robin_hood::unordered_set<unsigned int>& changed_robots);
+
        private:
         /**!
-         * Runs a series of A* searches on a temporal grid
+         * Runs a low level search on a temporal grid for each robot that does not have a low level solution yet (in
+         * parallel unless running ECBS)
          *
          * \param node A node from the Conflict Tree which contains constraints used to resolve conflicts from previous
          *             low-level searches
@@ -87,9 +129,59 @@ namespace grstapse
          * \param robot The id for the robot to compute the low level trajectory for
          *
          * \returns Whether the low-level search was successful
+         *
+         * \note Only writes to the slot of \p robot in \p node, so searches for different robots or nodes can run
+         *       concurrently
          */
         bool computeLowLevelSolution(const std::shared_ptr<ConstraintTreeNodeBase>& node, unsigned int robot);
 
+        //! \brief Computes the distances from every cell to the goal of each robot (once per search)
+        void computeDistanceTables();
+
+        //! \returns The multi-valued decision diagram for the paths of \p robot that take \p duration timesteps
+        [[nodiscard]] std::shared_ptr<const MultiValuedDecisionDiagram> createMultiValuedDecisionDiagram(
+            unsigned int robot,
+            unsigned int duration,
+            const ConstraintTable& constraints) const;
+
+        //! \brief Adds the node counts of a low level search to the statistics (thread safe)
+        void addLowLevelStatistics(const SearchStatisticsCommon& low_level_statistics);
+
+        //! \brief Adds \p node to the focal set if its cost is within the suboptimality bound (ECBS)
+        void pushFocal(const std::shared_ptr<ConstraintTreeNodeBase>& node);
+
+        //! \returns The node from the focal set with the fewest conflicts after removing it from both sets (ECBS)
+        std::shared_ptr<ConstraintTreeNodeBase> popFocal();
+
+        //! \brief Adds the open nodes that fall within the suboptimality bound once the lowest lower bound increases
+        void updateFocal();
+
+        /**!
+         * \returns The conflict to branch on in \p node (the first conflict, or the first of the most cardinal
+         *          conflicts when prioritizing conflicts)
+         */
+        [[nodiscard]] std::unique_ptr<const ConflictBase> selectConflict(const ConstraintTreeNodeBase& node) const;
+
+        /**!
+         * \brief Creates a node that replaces the low level solution of \p robot in \p node with the one from
+         *        \p child without adding \p child's constraint
+         *
+         * \cite Eli Boyarski, Ariel Felner, Roni Stern, Guni Sharon, David Tolpin, Oded Betzalel, Solomon Eyal Shimony:
+         *       "ICBS: Improved Conflict-Based Search Algorithm for Multi-Agent Pathfinding". IJCAI 2015: 740-746
+         */
+        [[nodiscard]] std::shared_ptr<ConstraintTreeNodeBase> createBypassNode(
+            const std::shared_ptr<ConstraintTreeNodeBase>& node,
+            const std::shared_ptr<const ConstraintTreeNodeBase>& child,
+            unsigned int robot) const;
+
+        /**!
+         * \returns The robots other than \p replanned_robot whose low level solutions in \p node break the negative
+         *          constraints that the positive \p constraint implies for them (none if \p constraint is negative)
+         */
+        [[nodiscard]] std::vector<unsigned int> robotsViolatingPositiveConstraint(const ConstraintTreeNodeBase& node,
+                                                                                  const ConstraintBase& constraint,
+                                                                                  unsigned int replanned_robot) const;
+
         /**!
          * \returns Whether the final position of a robot violates a vertex constraint
          */
@@ -97,6 +189,15 @@ namespace grstapse
             const robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>>& constraints,
             std::shared_ptr<const TemporalGridCellNode> goal) const;
 
-        MutablePriorityQueue<unsigned int, unsigned int, ConstraintTreeNodeBase> m_open;
+        MutablePriorityQueue<unsigned int, unsigned int, ConstraintTreeNodeBase> m_open;  //!< Ordered by lower bound
+
+        //! (number of conflicts, cost, id, node)
+        using FocalEntry = std::tuple<std::size_t, unsigned int, unsigned int, std::shared_ptr<ConstraintTreeNodeBase>>;
+        std::set<FocalEntry> m_focal;      //!< Open nodes that cost at most w * m_focal_lower_bound (ECBS)
+        unsigned int m_focal_lower_bound;  //!< The lowest lower bound of the nodes in the open set (ECBS)
+
+        std::vector<std::shared_ptr<const GridDistanceTable>> m_distance_tables;  //!< Low level heuristic per robot
+
+        std::mutex m_statistics_mutex;  //!< Guards the low level statistics while low level searches run in parallel
     };
 }  // namespace grstapse
\ No newline at end of file
@@ -42,6 +42,20 @@ namespace grstapse
          * \param map
          * \param initial_states
          * \param goal_states
+         * \param high_level_timer_name
+         * \param low_level_timer_name
+         * \param has_timeout
+         * \param timeout
+         * \param prioritize_conflicts Whether to branch on cardinal conflicts first
+         * \param bypass Whether to adopt a child's low level solution instead of branching when it has the same cost
+         *               and fewer conflicts
+         * \param suboptimality_weight The returned solution costs at most this factor times the optimal one. A weight
+         *                             above 1 runs Enhanced CBS (focal searches on both levels), which ignores
+         *                             \p prioritize_conflicts and \p bypass
+         * \param num_threads The maximum number of low level searches to run in parallel (0 uses one per hardware
+         *                    thread)
+         * \param disjoint_splitting Whether to branch with a positive and a negative constraint on the same robot
+         *                           instead of a negative constraint on each robot
          */
         ConflictBasedSearchParameters(ConstraintTreeNodeCostType cost_type,
                                       const std::shared_ptr<const GridMap>& map,
@@ -49,11 +63,24 @@ namespace grstapse
                                       const std::vector<std::shared_ptr<const GridCell>>& goal_states,
                                       const std::string& high_level_timer_name,
                                       const std::string& low_level_timer_name,
-                                      bool has_timeout = false,
-                                      float timeout    = std::numeric_limits<float>::max());
+                                      bool has_timeout           = false,
+                                      float timeout              = std::numeric_limits<float>::max(),
+                                      bool prioritize_conflicts  = true,
+                                      bool bypass                = true,
+                                      float suboptimality_weight = 1.0f,
+                                      unsigned int num_threads   = 0,
+                                      bool disjoint_splitting    = false);
+
+        //! \returns Whether to run Enhanced CBS (a suboptimality weight above 1)
+        [[nodiscard]] bool isEnhanced() const;
 
         std::string high_level_timer_name;
         ConstraintTreeNodeCostType cost_type;
         std::string low_level_timer_name;
+        bool prioritize_conflicts;   //!< Whether to classify conflicts with MDDs and branch on cardinal ones first
+        bool bypass;                 //!< Whether to bypass non-cardinal conflicts
+        float suboptimality_weight;  //!< Suboptimality bound of Enhanced CBS (1 for optimal CBS)
+        unsigned int num_threads;    //!< Maximum number of low level searches to run in parallel
+        bool disjoint_splitting;     //!< Whether to split on a positive and a negative constraint on one robot
     };
 }  // namespace grstapse
\ No newline at end of file
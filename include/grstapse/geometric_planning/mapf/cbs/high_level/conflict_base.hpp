@@ -53,6 +53,17 @@ namespace grstapse
         //! \returns A map of constraints for the robots involved in the conflict
         virtual robin_hood::unordered_map<unsigned int, std::shared_ptr<ConstraintBase>> createConstraints() const = 0;
 
+        /**!
+         * \returns A map of constraints for disjoint splitting: the first agent is given a positive constraint (mapped
+         *          to the second agent, which is replanned to avoid it) in one child and the usual negative
+         *          constraint in the other, so the two children share no solutions
+         *
+         * \cite Jiaoyang Li, Daniel Harabor, Peter J. Stuckey, Ariel Felner, Hang Ma, Sven Koenig: "Disjoint Splitting
+         *       for Multi-Agent Path Finding with Conflict-Based Search". ICAPS 2019: 279-283
+         */
+        virtual robin_hood::unordered_map<unsigned int, std::shared_ptr<ConstraintBase>> createDisjointConstraints()
+            const = 0;
+
        protected:
         /**!
          * Constructor
@@ -63,4 +74,20 @@ namespace grstapse
 
         std::array<unsigned int, 2> m_agents;
     };
+
+    // Inline functions
+    const std::array<unsigned int, 2>& ConflictBase::agents() const
+    {
+        return m_agents;
+    }
+
+    unsigned int ConflictBase::agent1() const
+    {
+        return m_agents[0];
+    }
+
+    unsigned int ConflictBase::agent2() const
+    {
+        return m_agents[1];
+    }
 }  // namespace grstapse
\ No newline at end of file
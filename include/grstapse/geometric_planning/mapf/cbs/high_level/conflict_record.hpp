@@ -0,0 +1,87 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <array>
+#include <cstdint>
+#include <memory>
+
+namespace grstapse
+{
+    // Forward Declarations
+    class ConflictBase;
+    class MultiValuedDecisionDiagram;
+
+    //! How many of the robots in a conflict cannot resolve it without increasing their cost
+    enum class ConflictCardinality : uint8_t
+    {
+        e_cardinal = 0,   //!< Both robots
+        e_semi_cardinal,  //!< One of the robots
+        e_non_cardinal    //!< Neither robot
+    };
+
+    /**!
+     * A lightweight record of a conflict between two robots' low level solutions
+     *
+     * Constraint tree nodes keep every conflict in their low level solutions as records so that a child can inherit
+     * the conflicts of its parent that do not involve the replanned robot
+     *
+     * \see ConstraintTreeNodeBase
+     */
+    struct ConflictRecord
+    {
+        //! \returns A conflict that can create the constraints that resolve this record
+        [[nodiscard]] std::unique_ptr<const ConflictBase> createConflict() const;
+
+        /**!
+         * \returns Whether the robots in the conflict cannot avoid it at their current cost levels
+         *
+         * \param mdd0 The multi-valued decision diagram for agents[0]
+         * \param mdd1 The multi-valued decision diagram for agents[1]
+         */
+        [[nodiscard]] ConflictCardinality cardinality(const MultiValuedDecisionDiagram& mdd0,
+                                                      const MultiValuedDecisionDiagram& mdd1) const;
+
+        //! \returns Whether this record involves \p robot
+        [[nodiscard]] inline bool involves(unsigned int robot) const;
+
+        //! Orders by time, then vertex before edge conflicts, then by agents
+        [[nodiscard]] bool operator<(const ConflictRecord& rhs) const;
+
+        //! \note agents[0] < agents[1] and agents[0] moves from (x1, y1) to (x2, y2) for an edge conflict
+        std::array<unsigned int, 2> agents;
+        unsigned int time;
+        bool is_edge;
+        unsigned int x1;
+        unsigned int y1;
+        unsigned int x2;
+        unsigned int y2;
+    };
+
+    // Inline functions
+    bool ConflictRecord::involves(const unsigned int robot) const
+    {
+        return agents[0] == robot || agents[1] == robot;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,86 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <memory>
+
+namespace grstapse
+{
+    // Forward Declarations
+    class ConstraintBase;
+
+    /**!
+     * A persistent singly linked list of the constraints on a robot (a cons list)
+     *
+     * A constraint tree node prepends its new constraint to the list of its parent, so the lists of the nodes in a
+     * constraint tree share their tails. Adding a constraint is O(1) time and memory and reading the constraints of a
+     * robot is linear in the number of constraints on it instead of the depth of the tree.
+     *
+     * \note An empty list is represented by nullptr
+     *
+     * \see ConstraintTreeNode
+     */
+    class ConstraintList
+    {
+       public:
+        /**!
+         * Constructor
+         *
+         * \param constraint The first constraint in the list
+         * \param next The rest of the list (shared with the list it was prepended to)
+         */
+        ConstraintList(const std::shared_ptr<const ConstraintBase>& constraint,
+                       const std::shared_ptr<const ConstraintList>& next);
+
+        //! \returns The first constraint in the list
+        [[nodiscard]] inline const std::shared_ptr<const ConstraintBase>& constraint() const;
+
+        //! \returns The rest of the list
+        [[nodiscard]] inline const std::shared_ptr<const ConstraintList>& next() const;
+
+        //! \returns The number of constraints in the list
+        [[nodiscard]] inline unsigned int size() const;
+
+       private:
+        std::shared_ptr<const ConstraintBase> m_constraint;
+        std::shared_ptr<const ConstraintList> m_next;
+        unsigned int m_size;
+    };
+
+    // Inline functions
+    const std::shared_ptr<const ConstraintBase>& ConstraintList::constraint() const
+    {
+        return m_constraint;
+    }
+
+    const std::shared_ptr<const ConstraintList>& ConstraintList::next() const
+    {
+        return m_next;
+    }
+
+    unsigned int ConstraintList::size() const
+    {
+        return m_size;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -41,6 +41,11 @@ namespace grstapse
     /**!
      * A node from a constraint tree used by Conflict-Based Search (CBS)
      *
+     * Stores only the robot replanned from its parent (its constraints, low level solution, MDD, and lower bound),
+     * so the per robot lookups walk up the parents to the last node that replanned that robot, which takes O(depth)
+     * instead of O(1). Per robot arrays would copy O(num_robots) pointers for every node generated, and most of the
+     * nodes are never expanded.
+     *
      * \see ConflictBasedSearch
      */
     class ConstraintTreeNode : public ConstraintTreeNodeBase
@@ -57,31 +62,62 @@ namespace grstapse
                            ConstraintTreeNodeCostType cost,
                            const std::shared_ptr<const ConstraintTreeNodeBase>& parent);
 
+        using ConstraintTreeNodeBase::setLowLevelSolution;
+
+        //! \copydoc ConstraintTreeNodeBase
+        void setLowLevelSolution(unsigned int robot, const std::shared_ptr<const GridPath>& path) final override;
+
         //! \copydoc ConstraintTreeNodeBase
-        void setLowLevelSolution(unsigned int robot,
-                                 const std::shared_ptr<const TemporalGridCellNode>& leaf) final override;
+        const std::shared_ptr<const GridPath>& lowLevelSolution(unsigned int robot) const final override;
 
         //! \copydoc ConstraintTreeNodeBase
-        const std::vector<std::shared_ptr<const TemporalGridCellNode>>& lowLevelSolution(
+        void setMultiValuedDecisionDiagram(unsigned int robot,
+                                           const std::shared_ptr<const MultiValuedDecisionDiagram>& mdd) final override;
+
+        //! \copydoc ConstraintTreeNodeBase
+        [[nodiscard]] const std::shared_ptr<const MultiValuedDecisionDiagram>& multiValuedDecisionDiagram(
             unsigned int robot) const final override;
 
         //! \copydoc ConstraintTreeNodeBase
+        void setLowLevelLowerBound(unsigned int robot, unsigned int lower_bound) final override;
+
+        //! \copydoc ConstraintTreeNodeBase
+        [[nodiscard]] unsigned int lowLevelLowerBound(unsigned int robot) const final override;
+
+        /**!
+         * \copydoc ConstraintTreeNodeBase
+         *
+         * \note A null \p constraint creates a bypass node, which only replaces the low level solution of \p robot
+         *       with another one of the same cost
+         */
         void setConstraint(unsigned int robot, const std::shared_ptr<const ConstraintBase>& constraint) final override;
 
         //! \copydoc ConstraintTreeNodeBase
-        [[nodiscard]] const robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>> constraints(
+        [[nodiscard]] const std::shared_ptr<const ConstraintList>& constraintList(
             unsigned int robot) const final override;
 
-       protected:
         //! \copydoc ConstraintTreeNodeBase
-        void constraintsInsert(unsigned int robot, robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>>& us)
-            const final override;
+        [[nodiscard]] const std::shared_ptr<const ConstraintList>& positiveConstraintList() const final override;
+
+        /**!
+         * \copydoc ConstraintTreeNodeBase
+         *
+         * Inherits the conflicts of the parent that do not involve the replanned robot and only checks the replanned
+         * robot against the others
+         */
+        void detectConflicts() final override;
 
        private:
-        unsigned int m_constraint_robot;                     //!< Which robot the last constraint was applied
-        std::shared_ptr<const ConstraintBase> m_constraint;  //!< The last constraint
-        std::vector<std::shared_ptr<const TemporalGridCellNode>>
-            m_low_level_solution;  //!< The new low level solution for m_constaint_robot after m_constraint was applied
+        unsigned int m_constraint_robot;  //!< Which robot the last constraint was applied
+        std::shared_ptr<const ConstraintList>
+            m_constraints;  //!< The constraints on m_constraint_robot (the last constraint prepended to the parent's)
+        std::shared_ptr<const ConstraintList>
+            m_positive_constraints;  //!< The positive constraints (the parent's unless the last constraint is one)
+        std::shared_ptr<const GridPath>
+            m_low_level_solution;  //!< The new low level solution for m_constaint_robot after the last constraint
+                                   //!< was applied
+        std::shared_ptr<const MultiValuedDecisionDiagram> m_mdd;  //!< The MDD for m_low_level_solution's cost level
+        unsigned int m_lower_bound;  //!< Lower bound on the optimal low level cost for m_constraint_robot
     };
 
 }  // namespace grstapse
\ No newline at end of file
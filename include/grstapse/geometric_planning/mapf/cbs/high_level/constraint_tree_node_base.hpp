@@ -23,6 +23,7 @@
 #pragma once
 
 // Global
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -32,15 +33,18 @@
 // Local
 #include "grstapse/common/search/search_node_base.hpp"
 #include "grstapse/common/utilities/mutable_priority_queue/mutable_priority_queueable.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/high_level/conflict_record.hpp"
 
 namespace grstapse
 {
     // Forward Declarations
     class ConflictBase;
     class ConstraintBase;
+    class ConstraintList;
     class ConstraintTreeNode;
-    class GridCell;
     class GridMap;
+    class GridPath;
+    class MultiValuedDecisionDiagram;
     class TemporalGridCellNode;
 
     //! Specifies the type of cost that should be calculated
@@ -72,20 +76,46 @@ namespace grstapse
                                ConstraintTreeNodeCostType cost,
                                const std::shared_ptr<const ConstraintTreeNodeBase>& parent);
 
-        //! \brief Sets a low level trajectory
-        virtual void setLowLevelSolution(unsigned int robot,
-                                         const std::shared_ptr<const TemporalGridCellNode>& leaf) = 0;
+        //! \brief Sets a low level trajectory (and resets the lower bound on its cost to its cost)
+        virtual void setLowLevelSolution(unsigned int robot, const std::shared_ptr<const GridPath>& path) = 0;
 
-        //! \returns A low level trajectory for \p robot
-        [[nodiscard]] virtual const std::vector<std::shared_ptr<const TemporalGridCellNode>>& lowLevelSolution(
+        //! \brief Sets the low level trajectory traced back from \p leaf
+        void setLowLevelSolution(unsigned int robot, const std::shared_ptr<const TemporalGridCellNode>& leaf);
+
+        //! \returns A low level trajectory for \p robot (shared with the ancestors of this node that planned it)
+        [[nodiscard]] virtual const std::shared_ptr<const GridPath>& lowLevelSolution(unsigned int robot) const = 0;
+
+        //! \brief Sets the multi-valued decision diagram for the cost level of \p robot's low level trajectory
+        virtual void setMultiValuedDecisionDiagram(unsigned int robot,
+                                                   const std::shared_ptr<const MultiValuedDecisionDiagram>& mdd) = 0;
+
+        //! \returns The multi-valued decision diagram for the cost level of \p robot's low level trajectory
+        [[nodiscard]] virtual const std::shared_ptr<const MultiValuedDecisionDiagram>& multiValuedDecisionDiagram(
             unsigned int robot) const = 0;
 
-        //! \brief Sets a constraint for \p robot
+        //! \brief Sets a lower bound on the cost of the optimal low level trajectory of \p robot
+        virtual void setLowLevelLowerBound(unsigned int robot, unsigned int lower_bound) = 0;
+
+        //! \returns A lower bound on the cost of the optimal low level trajectory of \p robot
+        [[nodiscard]] virtual unsigned int lowLevelLowerBound(unsigned int robot) const = 0;
+
+        /**!
+         * \brief Sets a constraint for \p robot
+         *
+         * \note A positive constraint (disjoint splitting) is on another robot and forbids \p robot along with every
+         *       other robot, so it is added to the positive constraints of the node instead of those of \p robot
+         */
         virtual void setConstraint(unsigned int robot, const std::shared_ptr<const ConstraintBase>& constraint) = 0;
 
+        //! \returns The constraints on \p robot (shared with the ancestors of this node)
+        [[nodiscard]] virtual const std::shared_ptr<const ConstraintList>& constraintList(unsigned int robot) const = 0;
+
+        //! \returns The positive constraints on all the robots (shared with the ancestors of this node)
+        [[nodiscard]] virtual const std::shared_ptr<const ConstraintList>& positiveConstraintList() const = 0;
+
         //! \returns A set of constraints for \p robot
-        [[nodiscard]] virtual const robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>> constraints(
-            unsigned int robot) const = 0;
+        [[nodiscard]] robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>> constraints(
+            unsigned int robot) const;
 
         //! \returns The cost of this node
         [[nodiscard]] unsigned int cost() const;
@@ -96,10 +126,26 @@ namespace grstapse
         //! \returns The sum of the durations of the lower level solutions
         [[nodiscard]] unsigned int sumOfCosts() const;
 
+        //! \returns A lower bound on the cost of this node (equal to the cost when the low level searches are optimal)
+        [[nodiscard]] unsigned int lowerBound() const;
+
         //! \returns The first conflict in the lower level solutions (with respect to time and then vertex before edge
         //! conflicts)
         [[nodiscard]] std::unique_ptr<const ConflictBase> getFirstConflict() const;
 
+        /**!
+         * \brief Detects and stores every conflict in the lower level solutions
+         *
+         * \note Must be called after all the lower level solutions of this node have been set
+         */
+        virtual void detectConflicts();
+
+        //! \returns Whether detectConflicts has been called on this node
+        [[nodiscard]] inline bool hasDetectedConflicts() const;
+
+        //! \returns The conflicts found by detectConflicts
+        [[nodiscard]] inline const std::vector<ConflictRecord>& conflicts() const;
+
         //! \copydoc SearchNodeBase
         [[nodiscard]] inline unsigned int hash() const final override;
 
@@ -109,22 +155,23 @@ namespace grstapse
         void display(const std::shared_ptr<const GridMap>& map) const;
 
        protected:
-        //! \returns The position of a specific \p robot at a specific \p time including if it has finish
-        [[nodiscard]] std::shared_ptr<const GridCell> getStateOrLast(unsigned int robot, unsigned int time) const;
-
-        //! \returns The position of a specific \p robot at a specific \p time or nullptr if it has finished
-        [[nodiscard]] std::shared_ptr<const GridCell> getState(unsigned int robot, unsigned int time) const;
-
-        //! \returns The position of a specific \p robot at the end of its route
-        [[nodiscard]] std::shared_ptr<const GridCell> getLastState(unsigned int robot) const;
+        /**!
+         * \returns Every conflict between all pairs of robots
+         *
+         * Each timestep hashes the cell (and the edge) each robot occupies so that only robots that share a cell (or
+         * traverse an edge in opposite directions) are compared
+         */
+        [[nodiscard]] std::vector<ConflictRecord> findAllConflicts() const;
 
-        virtual void constraintsInsert(unsigned int robot,
-                                       robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>>& us) const = 0;
+        //! \returns The lower level solutions of all the robots (resolved once instead of per lookup)
+        [[nodiscard]] std::vector<const GridPath*> lowLevelSolutions() const;
 
         unsigned int m_num_robots;
         ConstraintTreeNodeCostType m_cost_type;
+        bool m_conflicts_detected;
+        std::vector<ConflictRecord> m_conflicts;
 
-        static unsigned int s_next_id;
+        static std::atomic<unsigned int> s_next_id;  //!< Atomic so that nodes can be created by worker threads
 
         friend class ConstraintTreeNode;
     };
@@ -135,4 +182,14 @@ namespace grstapse
         return m_id;
     }
 
+    bool ConstraintTreeNodeBase::hasDetectedConflicts() const
+    {
+        return m_conflicts_detected;
+    }
+
+    const std::vector<ConflictRecord>& ConstraintTreeNodeBase::conflicts() const
+    {
+        return m_conflicts;
+    }
+
 }  // namespace grstapse
\ No newline at end of file
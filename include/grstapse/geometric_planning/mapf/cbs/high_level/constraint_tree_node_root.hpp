@@ -33,28 +33,41 @@ namespace grstapse
        public:
         ConstraintTreeNodeRoot(unsigned int num_robot, ConstraintTreeNodeCostType cost_type);
 
+        using ConstraintTreeNodeBase::setLowLevelSolution;
+
+        // \copydoc ConstraintTreeNodeBase
+        void setLowLevelSolution(unsigned int robot, const std::shared_ptr<const GridPath>& path) final override;
+
+        // \copydoc ConstraintTreeNodeBase
+        const std::shared_ptr<const GridPath>& lowLevelSolution(unsigned int robot) const final override;
+
         // \copydoc ConstraintTreeNodeBase
-        void setLowLevelSolution(unsigned int robot,
-                                 const std::shared_ptr<const TemporalGridCellNode>& leaf) final override;
+        void setMultiValuedDecisionDiagram(unsigned int robot,
+                                           const std::shared_ptr<const MultiValuedDecisionDiagram>& mdd) final override;
 
         // \copydoc ConstraintTreeNodeBase
-        const std::vector<std::shared_ptr<const TemporalGridCellNode>>& lowLevelSolution(
+        const std::shared_ptr<const MultiValuedDecisionDiagram>& multiValuedDecisionDiagram(
             unsigned int robot) const final override;
 
+        // \copydoc ConstraintTreeNodeBase
+        void setLowLevelLowerBound(unsigned int robot, unsigned int lower_bound) final override;
+
+        // \copydoc ConstraintTreeNodeBase
+        [[nodiscard]] unsigned int lowLevelLowerBound(unsigned int robot) const final override;
+
         // \copydoc ConstraintTreeNodeBase
         void setConstraint(unsigned int robot, const std::shared_ptr<const ConstraintBase>& constraint) final override;
 
         // \copydoc ConstraintTreeNodeBase
-        const robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>> constraints(
-            unsigned int robot) const final override;
+        const std::shared_ptr<const ConstraintList>& constraintList(unsigned int robot) const final override;
 
-       protected:
         // \copydoc ConstraintTreeNodeBase
-        void constraintsInsert(unsigned int robot, robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>>& us)
-            const final override;
+        const std::shared_ptr<const ConstraintList>& positiveConstraintList() const final override;
 
        private:
-        std::vector<std::vector<std::shared_ptr<const TemporalGridCellNode>>> m_low_level_solutions;
+        std::vector<std::shared_ptr<const GridPath>> m_low_level_solutions;
+        std::vector<std::shared_ptr<const MultiValuedDecisionDiagram>> m_mdds;
+        std::vector<unsigned int> m_lower_bounds;
     };
 
 }  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,66 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Local
+#include "grstapse/geometric_planning/mapf/cbs/high_level/constraint_base.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/high_level/temporal_edge.hpp"
+
+namespace grstapse
+{
+    /**!
+     * A constraint representing that a specific robot must move from (x1, y1) at time t to (x2, y2)
+     *
+     * Used by disjoint splitting. Every other robot is forbidden from (x1, y1) at time t, from (x2, y2) at time t + 1,
+     * and from moving along the edge in the other direction at time t.
+     *
+     * \see EdgeConstraint
+     */
+    class PositiveEdgeConstraint
+        : public ConstraintBase
+        , public TemporalEdge
+    {
+       public:
+        PositiveEdgeConstraint(unsigned int robot,
+                               unsigned int time,
+                               unsigned int x1,
+                               unsigned int y1,
+                               unsigned int x2,
+                               unsigned int y2);
+
+        //! \returns The robot that must traverse the edge
+        [[nodiscard]] inline unsigned int robot() const noexcept;
+
+        //! \copydoc ConstraintBase
+        size_t hash() const override;
+
+       private:
+        unsigned int m_robot;
+    };
+
+    // Inline functions
+    unsigned int PositiveEdgeConstraint::robot() const noexcept
+    {
+        return m_robot;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -48,6 +48,10 @@ namespace grstapse
 
         //! \returns Constraints for the two robots that are part of the conflict
         robin_hood::unordered_map<unsigned int, std::shared_ptr<ConstraintBase>> createConstraints() const override;
+
+        //! \copydoc ConflictBase
+        robin_hood::unordered_map<unsigned int, std::shared_ptr<ConstraintBase>> createDisjointConstraints()
+            const override;
     };
 
 }  // namespace grstapse
\ No newline at end of file
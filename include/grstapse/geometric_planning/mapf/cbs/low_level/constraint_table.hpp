@@ -0,0 +1,180 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <utility>
+// External
+#include <robin_hood/robin_hood.hpp>
+
+namespace grstapse
+{
+    // Forward Declarations
+    class ConstraintBase;
+    class ConstraintList;
+
+    /**!
+     * The constraints on a single robot compiled into hash tables keyed by (time, cell) and (time, edge)
+     *
+     * Built once per low level search so that checking a successor against the constraints is a single lookup
+     * instead of a scan over every constraint
+     *
+     * A positive constraint on the robot becomes a must-visit cell: every other cell is constrained at that time.
+     * A positive constraint on another robot becomes the negative constraints it implies for this one.
+     *
+     * \see SpaceTimeAStarWithConstraints
+     */
+    class ConstraintTable
+    {
+       public:
+        //! Constructor
+        explicit ConstraintTable(const robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>>& constraints);
+
+        //! Constructor (nullptr is an empty list)
+        explicit ConstraintTable(const ConstraintList* constraints);
+
+        /**!
+         * Constructor
+         *
+         * \param constraints The (negative) constraints on \p robot (nullptr is an empty list)
+         * \param positive_constraints The positive constraints on all the robots (nullptr is an empty list)
+         * \param robot The robot the table is for
+         */
+        ConstraintTable(const ConstraintList* constraints,
+                        const ConstraintList* positive_constraints,
+                        unsigned int robot);
+
+        //! \returns Whether a robot is not allowed to occupy (\p x, \p y) at \p time
+        [[nodiscard]] inline bool isVertexConstrained(unsigned int time, unsigned int x, unsigned int y) const;
+
+        //! \returns Whether a robot is not allowed to move from (\p x1, \p y1) at \p time to (\p x2, \p y2)
+        [[nodiscard]] inline bool isEdgeConstrained(unsigned int time,
+                                                    unsigned int x1,
+                                                    unsigned int y1,
+                                                    unsigned int x2,
+                                                    unsigned int y2) const;
+
+        //! \returns The latest time that (\p x, \p y) is constrained (0 if it never is), including the times that a
+        //!          different cell must be visited
+        [[nodiscard]] unsigned int latestVertexConstraint(unsigned int x, unsigned int y) const;
+
+        //! \returns Whether a robot at (\p x, \p y) at \p time can reach the next cell it must visit in time
+        [[nodiscard]] inline bool canReachMustVisit(unsigned int time, unsigned int x, unsigned int y) const;
+
+        //! \returns Whether there are no constraints
+        [[nodiscard]] inline bool empty() const;
+
+       private:
+        //! Adds \p constraint to the tables
+        void insert(const std::shared_ptr<const ConstraintBase>& constraint);
+
+        //! Adds the positive \p constraint to the tables of \p robot
+        void insertPositive(const std::shared_ptr<const ConstraintBase>& constraint, unsigned int robot);
+
+        //! Adds a negative constraint on (\p x, \p y) at \p time
+        void insertVertex(unsigned int time, unsigned int x, unsigned int y);
+
+        //! Requires the robot to be at (\p x, \p y) at \p time
+        void insertMustVisit(unsigned int time, unsigned int x, unsigned int y);
+
+        //! \returns A key for the cell (\p x, \p y)
+        [[nodiscard]] static inline uint64_t cellKey(unsigned int x, unsigned int y);
+
+        //! (time, cell)
+        using VertexKey = std::pair<uint64_t, uint64_t>;
+        //! (time, from cell, to cell)
+        using EdgeKey = std::pair<VertexKey, uint64_t>;
+
+        struct VertexKeyHash
+        {
+            [[nodiscard]] std::size_t operator()(const VertexKey& key) const;
+        };
+        struct EdgeKeyHash
+        {
+            [[nodiscard]] std::size_t operator()(const EdgeKey& key) const;
+        };
+
+        robin_hood::unordered_flat_set<VertexKey, VertexKeyHash> m_vertices;
+        robin_hood::unordered_flat_set<EdgeKey, EdgeKeyHash> m_edges;
+        robin_hood::unordered_flat_map<uint64_t, unsigned int> m_latest_vertex_constraint;  //!< cell -> time
+        std::map<unsigned int, uint64_t> m_must_visit;  //!< time -> cell (positive constraints, ordered by time)
+
+        static constexpr uint64_t k_nowhere = std::numeric_limits<uint64_t>::max();  //!< Must visit two cells at once
+    };
+
+    // Inline functions
+    bool ConstraintTable::isVertexConstrained(const unsigned int time, const unsigned int x, const unsigned int y) const
+    {
+        if(!m_must_visit.empty())
+        {
+            if(auto itr = m_must_visit.find(time); itr != m_must_visit.end() && itr->second != cellKey(x, y))
+            {
+                return true;
+            }
+        }
+        return !m_vertices.empty() && m_vertices.contains(VertexKey(time, cellKey(x, y)));
+    }
+
+    bool ConstraintTable::isEdgeConstrained(const unsigned int time,
+                                            const unsigned int x1,
+                                            const unsigned int y1,
+                                            const unsigned int x2,
+                                            const unsigned int y2) const
+    {
+        return !m_edges.empty() && m_edges.contains(EdgeKey(VertexKey(time, cellKey(x1, y1)), cellKey(x2, y2)));
+    }
+
+    bool ConstraintTable::canReachMustVisit(const unsigned int time, const unsigned int x, const unsigned int y) const
+    {
+        if(m_must_visit.empty())
+        {
+            return true;
+        }
+        auto itr = m_must_visit.upper_bound(time);
+        if(itr == m_must_visit.end())
+        {
+            return true;
+        }
+        if(itr->second == k_nowhere)
+        {
+            return false;
+        }
+        const unsigned int x2 = static_cast<unsigned int>(itr->second >> 32);
+        const unsigned int y2 = static_cast<unsigned int>(itr->second & 0xFFFFFFFF);
+        return (x > x2 ? x - x2 : x2 - x) + (y > y2 ? y - y2 : y2 - y) <= itr->first - time;
+    }
+
+    bool ConstraintTable::empty() const
+    {
+        return m_vertices.empty() && m_edges.empty() && m_must_visit.empty();
+    }
+
+    uint64_t ConstraintTable::cellKey(const unsigned int x, const unsigned int y)
+    {
+        return (static_cast<uint64_t>(x) << 32) | y;
+    }
+}  // namespace grstapse
\ No newline at end of file
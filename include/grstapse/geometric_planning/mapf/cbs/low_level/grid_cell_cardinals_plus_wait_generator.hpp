@@ -29,10 +29,14 @@
 namespace grstapse
 {
     // Forward Declarations
+    class ConstraintTable;
     class GridMap;
 
     /**!
      * Generates the successors for a TemporalGridCellNode (N, S, E, W, Wait)
+     *
+     * \note Edge constraints are checked here instead of by a pruning method because whether a node violates one
+     *       depends on its parent, and a pruned node would block every other way of reaching the same state
      */
     class GridCellCardinalsPlusWaitGenerator : public SuccessorGeneratorBase<TemporalGridCellNode>
     {
@@ -43,12 +47,15 @@ namespace grstapse
          * Constructor
          *
          * \param map
+         * \param constraints The constraints on the robot whose edge constraints the successors must satisfy
          */
-        GridCellCardinalsPlusWaitGenerator(const std::shared_ptr<const GridMap>& map);
+        GridCellCardinalsPlusWaitGenerator(const std::shared_ptr<const GridMap>& map,
+                                           const std::shared_ptr<const ConstraintTable>& constraints = nullptr);
 
        private:
         bool isValidNode(const std::shared_ptr<const TemporalGridCellNode>& node) const final override;
 
         std::shared_ptr<const GridMap> m_map;
+        std::shared_ptr<const ConstraintTable> m_constraints;
     };
 }  // namespace grstapse
\ No newline at end of file
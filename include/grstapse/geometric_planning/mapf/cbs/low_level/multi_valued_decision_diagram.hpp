@@ -0,0 +1,96 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <vector>
+
+namespace grstapse
+{
+    // Forward Declarations
+    class ConstraintTable;
+    class GridCell;
+    class GridDistanceTable;
+    class GridMap;
+
+    /**!
+     * A multi-valued decision diagram (MDD) of every path with a specific duration that takes a robot from its
+     * initial cell to its goal cell while satisfying its constraints
+     *
+     * Level t of the diagram holds the cells the robot can occupy at time t on one of those paths. A level with a
+     * single cell means that every path at this cost level goes through that cell at that time.
+     *
+     * \cite Guni Sharon, Roni Stern, Ariel Felner, Nathan R. Sturtevant:
+     *       "The increasing cost tree search for optimal multi-agent pathfinding".
+     *       Artif. Intell. 195:470-495 (2013)
+     */
+    class MultiValuedDecisionDiagram
+    {
+       public:
+        /**!
+         * Constructor
+         *
+         * \param map The grid the robot moves on
+         * \param initial The initial cell of the robot
+         * \param goal The goal cell of the robot
+         * \param duration The number of timesteps in the paths (the size of the robot's low level solution)
+         * \param constraints The constraints on the robot
+         * \param distances The distances from each cell to \p goal used to prune the forward pass (the manhattan
+         *                  distance is used if null)
+         */
+        MultiValuedDecisionDiagram(const GridMap& map,
+                                   const GridCell& initial,
+                                   const GridCell& goal,
+                                   unsigned int duration,
+                                   const ConstraintTable& constraints,
+                                   const GridDistanceTable* distances = nullptr);
+
+        //! \returns The number of timesteps in the paths
+        [[nodiscard]] inline unsigned int duration() const;
+
+        //! \returns The number of cells the robot can occupy at \p time (a finished robot stays on its goal)
+        [[nodiscard]] inline unsigned int width(unsigned int time) const;
+
+        //! \returns Whether every path at this cost level occupies (\p x, \p y) at \p time
+        [[nodiscard]] bool isSingleton(unsigned int time, unsigned int x, unsigned int y) const;
+
+        //! \returns Whether some path at this cost level occupies (\p x, \p y) at \p time
+        [[nodiscard]] bool contains(unsigned int time, unsigned int x, unsigned int y) const;
+
+       private:
+        unsigned int m_map_width;
+        unsigned int m_goal;                              //!< The index of the goal cell
+        std::vector<std::vector<unsigned int>> m_levels;  //!< Sorted indices (y * width + x) of the cells per timestep
+    };
+
+    // Inline functions
+    unsigned int MultiValuedDecisionDiagram::duration() const
+    {
+        return static_cast<unsigned int>(m_levels.size());
+    }
+
+    unsigned int MultiValuedDecisionDiagram::width(const unsigned int time) const
+    {
+        return time < m_levels.size() ? static_cast<unsigned int>(m_levels[time].size()) : 1;
+    }
+}  // namespace grstapse
\ No newline at end of file
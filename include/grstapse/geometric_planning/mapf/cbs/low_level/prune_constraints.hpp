@@ -2,7 +2,7 @@
  * Graphically Recursive Simultaneous Task Allocation, Planning,
  * Scheduling, and Execution
  *
- * Copyright (C) 2020-2021
+ * Copyright (C) 2020-2022
  *
  * Author: Andrew Messing
  * Author: Glen Neville
@@ -24,8 +24,6 @@
 
 // Global
 #include <memory>
-// External
-#include <robin_hood/robin_hood.hpp>
 // Local
 #include "grstapse/common/search/pruning_method_base.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_node.hpp"
@@ -33,21 +31,22 @@
 namespace grstapse
 {
     // Forward Declarations
-    class ConstraintBase;
-    class EdgeConstraint;
-    class VertexConstraint;
+    class ConstraintTable;
 
     /**!
-     * Prunes TemporalGridCells based on a set of constraints
+     * Prunes TemporalGridCells based on a set of vertex constraints and those that cannot reach the next cell they
+     * must visit in time
+     *
+     * \see GridCellCardinalsPlusWaitGenerator for the edge constraints
      */
     class PruneConstraints : public PruningMethodBase<TemporalGridCellNode>
     {
        public:
         /**!
          *
-         * \param constraints
+         * \param constraints The constraints on the robot
          */
-        explicit PruneConstraints(const robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>>& constraints);
+        explicit PruneConstraints(const std::shared_ptr<const ConstraintTable>& constraints);
 
         /**!
          * \returns Whether the node should be pruned
@@ -55,18 +54,6 @@ namespace grstapse
         [[nodiscard]] bool operator()(const std::shared_ptr<const TemporalGridCellNode>& node) const override;
 
        private:
-        /**!
-         * \returns Whether this node violates the edge constraint
-         */
-        [[nodiscard]] bool prune(const std::shared_ptr<const TemporalGridCellNode>& node,
-                                 const std::shared_ptr<const EdgeConstraint>& constraint) const;
-
-        /**!
-         * \returns Whether this node violates the vertex constraint
-         */
-        [[nodiscard]] bool prune(const std::shared_ptr<const TemporalGridCellNode>& node,
-                                 const std::shared_ptr<const VertexConstraint>& constraint) const;
-
-        robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>> m_constraints;
+        std::shared_ptr<const ConstraintTable> m_constraints;
     };
 }  // namespace grstapse
\ No newline at end of file
@@ -40,13 +40,16 @@ namespace grstapse
     class SpaceTimeAStarParameters;
     class TemporalGridCellNode;
     class ConstraintBase;
+    class ConstraintTable;
+    class GridDistanceTable;
 
     /**
      * \brief An A* search through a temporal grid where cells are <t, x, y>.
      *
      * Commonly used as the low level search for Conflict-Based Search (CBS). A
      * single agent search through a grid where temporospatial constraints have
-     * been placed by an external source.
+     * been placed by an external source. Positive (must-visit) constraints in the
+     * constraint table are supported as well.
      *
      * \see ConflictBasedSearch
      */
@@ -62,6 +65,20 @@ namespace grstapse
             const std::shared_ptr<const GridCell>& goal,
             const robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>>& constraints);
 
+        /**!
+         * Constructor
+         *
+         * \param constraints The constraints on the robot already compiled into a table
+         * \param distances The distances from each cell to \p goal used as the heuristic (the manhattan distance is
+         *                  used if null)
+         */
+        SpaceTimeAStarWithConstraints(const std::shared_ptr<const SpaceTimeAStarParameters>& parameters,
+                                      const std::shared_ptr<const GridMap>& map,
+                                      const std::shared_ptr<const GridCell>& initial,
+                                      const std::shared_ptr<const GridCell>& goal,
+                                      const std::shared_ptr<const ConstraintTable>& constraints,
+                                      const std::shared_ptr<const GridDistanceTable>& distances = nullptr);
+
         [[nodiscard]] std::shared_ptr<TemporalGridCellNode> createRootNode() override final;
 
        private:
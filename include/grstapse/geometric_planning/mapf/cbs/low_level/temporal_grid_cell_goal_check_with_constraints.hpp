@@ -25,16 +25,15 @@
 // Global
 #include <memory>
 
-// External
-#include <robin_hood/robin_hood.hpp>
-
 // Local
 #include "grstapse/common/search/goal_check_base.hpp"
-#include "grstapse/geometric_planning/mapf/cbs/high_level/constraint_base.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_node.hpp"
 
 namespace grstapse
 {
+    // Forward Declarations
+    class ConstraintTable;
+
     /**!
      * \brief
      */
@@ -47,9 +46,8 @@ namespace grstapse
          * \param goal
          * \param constraints
          */
-        TemporalGridCellGoalCheckWithConstraints(
-            const std::shared_ptr<const GridCell>& goal,
-            const robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>>& constraints);
+        TemporalGridCellGoalCheckWithConstraints(const std::shared_ptr<const GridCell>& goal,
+                                                 const ConstraintTable& constraints);
 
         //! \copydoc GoalCheckBase
         bool operator()(const std::shared_ptr<const TemporalGridCellNode>& node) const final override;
@@ -0,0 +1,58 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <memory>
+// Local
+#include "grstapse/common/search/memoization_base.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_node.hpp"
+
+namespace grstapse
+{
+    // Forward Declarations
+    class GridMap;
+
+    /**!
+     * Identifies a TemporalGridCellNode by its (time, x, y) so that a state reached by different paths is only
+     * expanded once
+     *
+     * The identifier is the index of the state in the (time, y, x) grid. States later than the identifiers can
+     * represent fall back to the node's unique identifier (in the upper half of the range so they cannot alias a
+     * state), which disables duplicate detection for them but keeps the search correct
+     */
+    class TemporalGridCellMemoization : public MemoizationBase<TemporalGridCellNode>
+    {
+       public:
+        //! Constructor
+        explicit TemporalGridCellMemoization(const std::shared_ptr<const GridMap>& map);
+
+        //! \returns The identifier for (time, x, y) of \p node
+        [[nodiscard]] unsigned int operator()(const std::shared_ptr<const TemporalGridCellNode>& node) const final;
+
+       private:
+        unsigned int m_width;
+        unsigned int m_num_cells;
+        unsigned int m_horizon;  //!< The first time that cannot be represented
+    };
+}  // namespace grstapse
\ No newline at end of file
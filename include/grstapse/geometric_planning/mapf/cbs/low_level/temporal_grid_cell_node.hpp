@@ -23,9 +23,10 @@
 #pragma once
 
 // Global
+#include <atomic>
 #include <memory>
 // Local
-#include "grstapse/common/search/a_star/a_star_search_node_base.hpp"
+#include "grstapse/common/search/focal_a_star/focal_a_star_search_node_base.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell.hpp"
 
 namespace grstapse
@@ -35,7 +36,7 @@ namespace grstapse
      */
     class TemporalGridCellNode
         : public TemporalGridCell
-        , public AStarSearchNodeBase<TemporalGridCellNode>
+        , public FocalAStarSearchNodeBase<TemporalGridCellNode>
     {
        public:
         /**!
@@ -55,6 +56,6 @@ namespace grstapse
         unsigned int hash() const override;
 
        private:
-        static unsigned int s_next_id;
+        static std::atomic<unsigned int> s_next_id;  //!< Atomic so that low level searches can run in parallel
     };
 }  // namespace grstapse
\ No newline at end of file
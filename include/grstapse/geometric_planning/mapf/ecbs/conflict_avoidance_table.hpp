@@ -0,0 +1,96 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+// External
+#include <robin_hood/robin_hood.hpp>
+
+namespace grstapse
+{
+    // Forward Declarations
+    class GridPath;
+
+    /**!
+     * The low level solutions of the other robots compiled into hash tables keyed by (time, cell) and (time, edge)
+     *
+     * Used by the low level search of Enhanced Conflict-Based Search to count how many conflicts a partial path has
+     * with the paths already planned for the other robots
+     *
+     * \see SpaceTimeFocalSearchWithConstraints
+     */
+    class ConflictAvoidanceTable
+    {
+       public:
+        //! Default Constructor (no other robots)
+        ConflictAvoidanceTable() = default;
+
+        //! Adds the low level solution of another robot
+        void addPath(const GridPath& path);
+
+        //! \returns The number of other robots that occupy (\p x, \p y) at \p time (including ones that have finished)
+        [[nodiscard]] unsigned int numVertexConflicts(unsigned int time, unsigned int x, unsigned int y) const;
+
+        /**!
+         * \returns The number of other robots that move from (\p x2, \p y2) to (\p x1, \p y1) while a robot moves from
+         *          (\p x1, \p y1) at \p time to (\p x2, \p y2)
+         */
+        [[nodiscard]] unsigned int numEdgeConflicts(unsigned int time,
+                                                    unsigned int x1,
+                                                    unsigned int y1,
+                                                    unsigned int x2,
+                                                    unsigned int y2) const;
+
+        //! \returns Whether no paths have been added
+        [[nodiscard]] inline bool empty() const;
+
+       private:
+        //! (time, cell)
+        using VertexKey = std::pair<uint64_t, uint64_t>;
+        //! (time, from cell, to cell)
+        using EdgeKey = std::pair<VertexKey, uint64_t>;
+
+        struct VertexKeyHash
+        {
+            [[nodiscard]] std::size_t operator()(const VertexKey& key) const;
+        };
+        struct EdgeKeyHash
+        {
+            [[nodiscard]] std::size_t operator()(const EdgeKey& key) const;
+        };
+
+        robin_hood::unordered_flat_map<VertexKey, unsigned int, VertexKeyHash> m_vertices;
+        robin_hood::unordered_flat_map<EdgeKey, unsigned int, EdgeKeyHash> m_edges;
+        robin_hood::unordered_map<uint64_t, std::vector<unsigned int>> m_finished;  //!< cell -> times robots finished
+    };
+
+    // Inline functions
+    bool ConflictAvoidanceTable::empty() const
+    {
+        return m_vertices.empty() && m_finished.empty();
+    }
+}  // namespace grstapse
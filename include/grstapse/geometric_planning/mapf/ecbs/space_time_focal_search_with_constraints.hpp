@@ -0,0 +1,82 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <memory>
+
+// Local
+#include "grstapse/common/search/focal_a_star/focal_a_star.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_node.hpp"
+
+namespace grstapse
+{
+    // Forward Declarations
+    class ConflictAvoidanceTable;
+    class ConstraintTable;
+    class FocalAStarParameters;
+    class GridCell;
+    class GridDistanceTable;
+    class GridMap;
+
+    /**!
+     * \brief A focal search through a temporal grid where cells are <t, x, y>.
+     *
+     * The low level search of Enhanced Conflict-Based Search (ECBS). Returns a path within a factor w of the
+     * shortest one that satisfies the constraints while preferring paths with fewer conflicts with the other robots.
+     *
+     * \cite Max Barer, Guni Sharon, Roni Stern, Ariel Felner: "Suboptimal Variants of the Conflict-Based Search
+     *       Algorithm for the Multi-Agent Pathfinding Problem". SOCS 2014: 19-27
+     *
+     * \see ConflictBaseSearch
+     * \see SpaceTimeAStarWithConstraints
+     */
+    class SpaceTimeFocalSearchWithConstraints : public FocalAStar<TemporalGridCellNode, SearchStatisticsCommon>
+    {
+        using Base = FocalAStar<TemporalGridCellNode, SearchStatisticsCommon>;
+
+       public:
+        /**!
+         * Constructor
+         *
+         * \param constraints The constraints on the robot already compiled into a table
+         * \param conflict_avoidance_table The paths of the other robots
+         * \param distances The distances from each cell to \p goal used as the heuristic (the manhattan distance is
+         *                  used if null)
+         */
+        SpaceTimeFocalSearchWithConstraints(
+            const std::shared_ptr<const FocalAStarParameters>& parameters,
+            const std::shared_ptr<const GridMap>& map,
+            const std::shared_ptr<const GridCell>& initial,
+            const std::shared_ptr<const GridCell>& goal,
+            const std::shared_ptr<const ConstraintTable>& constraints,
+            const std::shared_ptr<const ConflictAvoidanceTable>& conflict_avoidance_table,
+            const std::shared_ptr<const GridDistanceTable>& distances = nullptr);
+
+        [[nodiscard]] std::shared_ptr<TemporalGridCellNode> createRootNode() override final;
+
+       private:
+        std::shared_ptr<const GridCell> m_initial;
+        std::shared_ptr<const ConflictAvoidanceTable> m_conflict_avoidance_table;
+    };
+}  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,61 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <memory>
+
+// Local
+#include "grstapse/common/search/focal_a_star/focal_heuristic_base.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_node.hpp"
+
+namespace grstapse
+{
+    // Forward Declarations
+    class ConflictAvoidanceTable;
+
+    /**!
+     * Focal heuristic that counts the number of conflicts between the path to a node and the paths of the other
+     * robots (accumulated from the parent so that it holds the conflicts of the whole partial path)
+     *
+     * \see SpaceTimeFocalSearchWithConstraints
+     */
+    class TemporalGridCellConflictCount : public FocalHeuristicBase<TemporalGridCellNode>
+    {
+       public:
+        //! Constructor
+        explicit TemporalGridCellConflictCount(const std::shared_ptr<const ConflictAvoidanceTable>& table);
+
+       protected:
+        //! \returns The conflicts of the parent plus the vertex conflicts of \p node
+        [[nodiscard]] float computeStateHeuristic(
+            const std::shared_ptr<TemporalGridCellNode>& node) const final override;
+
+        //! \returns The edge conflicts from moving from the parent of \p node to \p node
+        [[nodiscard]] float computeTransitionHeuristic(
+            const std::shared_ptr<TemporalGridCellNode>& node) const final override;
+
+       private:
+        std::shared_ptr<const ConflictAvoidanceTable> m_table;
+    };
+}  // namespace grstapse
@@ -0,0 +1,120 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace grstapse
+{
+    // Forward Declarations
+    class TemporalGridCellNode;
+
+    /**!
+     * The route of a single robot through a grid stored as a contiguous array of packed (x, y) cells indexed by time
+     *
+     * Paths are immutable once created so constraint tree nodes share them through shared_ptrs instead of copying
+     * them; only the path of the robot that is replanned is new in a child node.
+     *
+     * \see ConstraintTreeNodeBase
+     */
+    class GridPath
+    {
+       public:
+        //! Constructor (traces the low level search nodes from \p leaf back to the root)
+        explicit GridPath(const std::shared_ptr<const TemporalGridCellNode>& leaf);
+
+        //! Constructor
+        explicit GridPath(std::vector<uint64_t> cells);
+
+        //! \returns The number of timesteps in the path
+        [[nodiscard]] inline unsigned int size() const;
+
+        //! \returns The packed cell at \p time
+        [[nodiscard]] inline uint64_t cell(unsigned int time) const;
+
+        //! \returns The packed cell at \p time or the last cell if the robot has finished
+        [[nodiscard]] inline uint64_t cellOrLast(unsigned int time) const;
+
+        //! \returns The packed cell at the end of the path
+        [[nodiscard]] inline uint64_t back() const;
+
+        //! \returns The packed cells of the path
+        [[nodiscard]] inline const std::vector<uint64_t>& cells() const;
+
+        //! \returns The cell (\p x, \p y) packed into a single integer
+        [[nodiscard]] static inline uint64_t pack(unsigned int x, unsigned int y);
+
+        //! \returns The x coordinate of a packed \p cell
+        [[nodiscard]] static inline unsigned int x(uint64_t cell);
+
+        //! \returns The y coordinate of a packed \p cell
+        [[nodiscard]] static inline unsigned int y(uint64_t cell);
+
+       private:
+        std::vector<uint64_t> m_cells;
+    };
+
+    // Inline functions
+    unsigned int GridPath::size() const
+    {
+        return static_cast<unsigned int>(m_cells.size());
+    }
+
+    uint64_t GridPath::cell(const unsigned int time) const
+    {
+        return m_cells[time];
+    }
+
+    uint64_t GridPath::cellOrLast(const unsigned int time) const
+    {
+        return time < m_cells.size() ? m_cells[time] : m_cells.back();
+    }
+
+    uint64_t GridPath::back() const
+    {
+        return m_cells.back();
+    }
+
+    const std::vector<uint64_t>& GridPath::cells() const
+    {
+        return m_cells;
+    }
+
+    uint64_t GridPath::pack(const unsigned int x, const unsigned int y)
+    {
+        return (static_cast<uint64_t>(x) << 32) | y;
+    }
+
+    unsigned int GridPath::x(const uint64_t cell)
+    {
+        return static_cast<unsigned int>(cell >> 32);
+    }
+
+    unsigned int GridPath::y(const uint64_t cell)
+    {
+        return static_cast<unsigned int>(cell & 0xFFFFFFFF);
+    }
+}  // namespace grstapse
\ No newline at end of file
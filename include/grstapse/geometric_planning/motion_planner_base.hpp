@@ -23,9 +23,11 @@
 #pragma once
 
 // Global
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <vector>
 // Local
 #include "grstapse/common/utilities/noncopyable.hpp"
 #include "grstapse/common/utilities/timer.hpp"
@@ -66,6 +68,8 @@ namespace grstapse
          * \param goal_configuration The target geometric configuration of the robot
          *
          * \returns The result of the motion planning query
+         *
+         * \note Safe to call concurrently if computeMotionPlan of the derived class is
          */
         [[nodiscard]] std::shared_ptr<const MotionPlanningQueryResultBase> query(
             const std::shared_ptr<const Species>& species,
@@ -82,9 +86,17 @@ namespace grstapse
          *
          * \returns The status of the planner and the path generated as the solution if possible
          */
-        [[nodiscard]] float durationQuery(const std::shared_ptr<const Species>& species,
-                                          const std::shared_ptr<const ConfigurationBase>& initial_configuration,
-                                          const std::shared_ptr<const ConfigurationBase>& goal_configuration);
+        [[nodiscard]] virtual float durationQuery(const std::shared_ptr<const Species>& species,
+                                                  const std::shared_ptr<const ConfigurationBase>& initial_configuration,
+                                                  const std::shared_ptr<const ConfigurationBase>& goal_configuration);
+
+        /**!
+         * Gives the motion planner the configurations that queries are expected between (e.g. task and robot start
+         * locations) so that it can precompute motion plans between them
+         *
+         * \note Does nothing by default
+         */
+        virtual void precompute(const std::vector<std::shared_ptr<const ConfigurationBase>>& configurations) {}
 
         /**!
          * Checks if a path from \p start_state to \p goal_configuration has been memoized
@@ -94,10 +106,13 @@ namespace grstapse
          * \param goal_configuration The target geometric configuration of the robot
          *
          * \returns Whether a path from \p start_state to \p goal_state has been memoized
+         *
+         * \note Derived classes that answer some queries without memoizing them (e.g. from a precomputation) report
+         *       those as memoized as well
          */
-        [[nodiscard]] inline bool isMemoized(const std::shared_ptr<const Species>& species,
-                                             const std::shared_ptr<const ConfigurationBase>& initial_configuration,
-                                             const std::shared_ptr<const ConfigurationBase>& goal_configuration) const;
+        [[nodiscard]] virtual bool isMemoized(const std::shared_ptr<const Species>& species,
+                                              const std::shared_ptr<const ConfigurationBase>& initial_configuration,
+                                              const std::shared_ptr<const ConfigurationBase>& goal_configuration) const;
 
         //! Clears the cache of motion plans
         void clearCache();
@@ -123,6 +138,12 @@ namespace grstapse
             const std::shared_ptr<const ConfigurationBase>& initial_configuration,
             const std::shared_ptr<const ConfigurationBase>& goal_configuration) const;
 
+        //! \copydoc getMemoized (the caller must hold m_mutex)
+        [[nodiscard]] std::shared_ptr<const MotionPlanningQueryResultBase> findMemoized(
+            const std::shared_ptr<const Species>& species,
+            const std::shared_ptr<const ConfigurationBase>& initial_configuration,
+            const std::shared_ptr<const ConfigurationBase>& goal_configuration) const;
+
         /**!
          * Computes a motion plan
          *
@@ -146,7 +167,7 @@ namespace grstapse
         std::multimap<std::shared_ptr<const Species>, MemoizationValue> m_memoization;
         mutable std::mutex m_mutex;  //!< mutable so that it can be used to lock const functions
 
-        static unsigned int s_num_failures;
+        static std::atomic<unsigned int> s_num_failures;
     };
 
     // Inline Functions
@@ -155,15 +176,9 @@ namespace grstapse
         return m_environment;
     }
 
-    bool MotionPlannerBase::isMemoized(const std::shared_ptr<const Species>& species,
-                                       const std::shared_ptr<const ConfigurationBase>& initial_configuration,
-                                       const std::shared_ptr<const ConfigurationBase>& goal_configuration) const
-    {
-        return getMemoized(species, initial_configuration, goal_configuration) != nullptr;
-    }
-
     unsigned int MotionPlannerBase::numMotionPlans() const
     {
+        std::lock_guard<std::mutex> lock(m_mutex);
         return m_memoization.size();
     }
 }  // namespace grstapse
\ No newline at end of file
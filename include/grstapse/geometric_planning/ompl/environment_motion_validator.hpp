@@ -0,0 +1,66 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <memory>
+#include <utility>
+// External
+#include <ompl/base/MotionValidator.h>
+
+namespace grstapse
+{
+    // Forward Declarations
+    class OmplEnvironment;
+    class Species;
+
+    /**!
+     * Checks motions against an environment for a fixed species
+     *
+     * A motion that OmplEnvironment::isMotionFree proves to be free is accepted without sampling. Otherwise the motion
+     * is sampled at the resolution of the state space like the discrete motion validator of ompl
+     */
+    class EnvironmentMotionValidator : public ompl::base::MotionValidator
+    {
+       public:
+        //! Constructor
+        EnvironmentMotionValidator(const ompl::base::SpaceInformationPtr& space_information,
+                                   const std::shared_ptr<const OmplEnvironment>& environment,
+                                   const std::shared_ptr<const Species>& species);
+
+        //! \copydoc ompl::base::MotionValidator
+        [[nodiscard]] bool checkMotion(const ompl::base::State* s1, const ompl::base::State* s2) const final override;
+
+        //! \copydoc ompl::base::MotionValidator
+        [[nodiscard]] bool checkMotion(const ompl::base::State* s1,
+                                       const ompl::base::State* s2,
+                                       std::pair<ompl::base::State*, double>& last_valid) const final override;
+
+       private:
+        //! \returns Whether the states sampled strictly between \p s1 and \p s2 are valid
+        [[nodiscard]] bool checkInterior(const ompl::base::State* s1, const ompl::base::State* s2) const;
+
+        std::shared_ptr<const OmplEnvironment> m_environment;
+        std::shared_ptr<const Species> m_species;
+    };
+}  // namespace grstapse
\ No newline at end of file
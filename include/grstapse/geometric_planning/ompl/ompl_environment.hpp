@@ -23,10 +23,12 @@
 #pragma once
 
 // Global
+#include <cstdint>
 #include <mutex>
 #include <queue>
 // External
 #include <nlohmann/json.hpp>
+#include <ompl/base/MotionValidator.h>
 #include <ompl/base/StateSpace.h>
 #include <ompl/base/StateValidityChecker.h>
 // Local
@@ -45,10 +47,15 @@ namespace grstapse
     enum class OmplEnvironmentType : uint8_t
     {
         e_unknown = 0,
-        e_pgm
+        e_pgm,
+        e_quadtree,
+        e_voxel
     };
     NLOHMANN_JSON_SERIALIZE_ENUM(OmplEnvironmentType,
-                                 {{OmplEnvironmentType::e_unknown, "unknown"}, {OmplEnvironmentType::e_pgm, "pgm"}});
+                                 {{OmplEnvironmentType::e_unknown, "unknown"},
+                                  {OmplEnvironmentType::e_pgm, "pgm"},
+                                  {OmplEnvironmentType::e_quadtree, "quadtree"},
+                                  {OmplEnvironmentType::e_voxel, "voxel"}});
 
     /**!
      * Abstract base class for the environment that is to be used with motion planners from OMPL
@@ -63,8 +70,36 @@ namespace grstapse
         //! Deserialize from json
         [[nodiscard]] static std::shared_ptr<OmplEnvironment> deserializeFromJson(const nlohmann::json& j);
 
-        //! \copydoc ompl::base::StateValidityChecker
-        [[nodiscard]] virtual bool isValid(const ompl::base::State* state) const override = 0;
+        //! \returns Whether \p state is valid for the species set by setSpecies
+        [[nodiscard]] bool isValid(const ompl::base::State* state) const override;
+
+        /**!
+         * \returns Whether \p state is valid for a robot of \p species
+         *
+         * \note Must be safe to call concurrently (it should only read the map)
+         */
+        [[nodiscard]] virtual bool isValid(const ompl::base::State* state, const Species& species) const = 0;
+
+        //! \returns A hash of everything that determines which states and motions are valid (used to key roadmaps)
+        [[nodiscard]] virtual uint64_t fingerprint() const = 0;
+
+        /**!
+         * \returns Whether the motion from \p from to \p to is known to be valid for a robot of \p species without
+         *          sampling it
+         *
+         * \note Conservative: false means "unknown" rather than "in collision"
+         */
+        [[nodiscard]] virtual bool isMotionFree(const ompl::base::State* from,
+                                                const ompl::base::State* to,
+                                                const Species& species) const;
+
+        /**!
+         * \returns A motion validator for robots of \p species (nullptr to use the default discrete motion validator
+         *          of ompl)
+         */
+        [[nodiscard]] virtual std::shared_ptr<ompl::base::MotionValidator> createMotionValidator(
+            const ompl::base::SpaceInformationPtr& space_information,
+            const std::shared_ptr<const Species>& species) const;
 
         //! \returns The state space for this environment
         [[nodiscard]] inline const std::shared_ptr<ompl::base::StateSpace>& stateSpace() const;
@@ -26,8 +26,11 @@
 #include <concepts>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <vector>
 // External
 #include <nlohmann/json.hpp>
+#include <robin_hood/robin_hood.hpp>
 #include <ompl/geometric/SimpleSetup.h>
 // Local
 #include "grstapse/geometric_planning/motion_planner_base.hpp"
@@ -94,6 +97,15 @@ namespace grstapse {
     /**!
      *  Conducts motion planning by wrapping several classes from the Open Motion Planning Library
      *
+     *  Queries are answered by a pool of planner instances. Each instance owns its own SimpleSetup, planner and
+     *  species-bound validity checker over the shared (read-only) environment, so concurrent queries do not block
+     *  each other. Idle instances are kept per species so that roadmaps are only reused for the species they were
+     *  validated against.
+     *
+     *  With OmplMotionPlannerParameters::reuse_roadmap, a PRM roadmap is grown once per robot radius (or loaded from
+     *  the roadmap directory, keyed by the fingerprint of the environment) and every query is answered as a search on
+     *  it instead of planning until the timeout.
+     *
      *  \cite I. Șucan, M. Moll, and L. Kavraki, "The Open Motion Planning Library",
      *        IEEE Robotics & Automation Magazine, 19(4):72–82, December 2012. https://ompl.kavrakilab.org
      */
@@ -105,12 +117,26 @@ namespace grstapse {
                           const std::shared_ptr<const OmplMotionPlannerParameters> &parameters,
                           const std::shared_ptr<OmplEnvironment> &environment);
 
-        //! \returns A pointer to the space information
-        [[nodiscard]] const std::shared_ptr<ompl::base::SpaceInformation> &spaceInformation() const;
+        /**!
+         * \returns A pointer to the space information
+         *
+         * \note This is not used by the planner instances and its validity checker is the environment itself
+         */
+        [[nodiscard]] inline const std::shared_ptr<ompl::base::SpaceInformation> &spaceInformation() const;
+
+        //! \returns The number of idle planner instances in the pool
+        [[nodiscard]] unsigned int numIdlePlanners() const;
 
         //! \returns The type of motion planning algorithm used
         [[nodiscard]] inline OmplMotionPlannerType omplMotionPlannerType() const;
 
+        /**!
+         * \returns The filepath that the roadmap for robots with \p bounding_radius is saved to
+         *
+         * \note The fingerprint of the environment is only computed the first time
+         */
+        [[nodiscard]] std::string roadmapFilepath(float bounding_radius) const;
+
     protected:
         //! Computes a motion plan using an OMPL motion planner
         [[nodiscard]] std::shared_ptr<const MotionPlanningQueryResultBase> computeMotionPlan(
@@ -118,11 +144,60 @@ namespace grstapse {
                 const std::shared_ptr<const ConfigurationBase> &initial_configuration,
                 const std::shared_ptr<const ConfigurationBase> &goal_configuration) final override;
 
+        //! \returns An idle planner instance for \p species from the pool (or a new one if there are none)
+        [[nodiscard]] std::unique_ptr<ompl::geometric::SimpleSetup> acquireSimpleSetup(
+                const std::shared_ptr<const Species> &species);
+
+        //! Returns \p simple_setup to the pool of idle planner instances for \p species
+        void releaseSimpleSetup(const std::shared_ptr<const Species> &species,
+                                std::unique_ptr<ompl::geometric::SimpleSetup> &&simple_setup);
+
+        //! \returns A new planner instance whose validity checker is bound to \p species
+        [[nodiscard]] std::unique_ptr<ompl::geometric::SimpleSetup> createSimpleSetup(
+                const std::shared_ptr<const Species> &species);
+
+        /**!
+         * Sets a PRM whose roadmap is the persistent roadmap for \p species as the planner of \p simple_setup
+         *
+         * The roadmap is copied from memory, loaded from the roadmap directory, or grown (and then saved). Only the
+         * queries that need the same roadmap wait while it is loaded or grown.
+         */
+        void setupRoadmapPlanner(ompl::geometric::SimpleSetup &simple_setup,
+                                 const std::shared_ptr<const Species> &species);
+
+        //! Calls setup on \p simple_setup (which also sets up the state space shared by all the instances)
+        void setup(ompl::geometric::SimpleSetup &simple_setup);
+
+        //! \returns A new motion planner of the configured type
+        [[nodiscard]] std::shared_ptr<ompl::base::Planner> createPlanner(
+                const std::shared_ptr<ompl::base::SpaceInformation> &space_information) const;
+
+        //! A serialized roadmap that is loaded or grown by the first query that needs it
+        struct Roadmap {
+            std::once_flag loaded;
+            std::string data;
+        };
+
         OmplMotionPlannerType m_ompl_motion_planner_type;
-        std::unique_ptr<ompl::geometric::SimpleSetup> m_simple_setup;
+        std::shared_ptr<ompl::base::SpaceInformation> m_space_information;
+
+        mutable std::mutex m_pool_mutex;
+        //! Idle planner instances keyed by species id
+        robin_hood::unordered_map<unsigned int, std::vector<std::unique_ptr<ompl::geometric::SimpleSetup>>>
+                m_idle_simple_setups;
+        //! Roadmaps keyed by bounding radius (the map is guarded by m_pool_mutex)
+        robin_hood::unordered_map<float, std::shared_ptr<Roadmap>> m_roadmaps;
+
+        std::mutex m_setup_mutex;
+        mutable std::once_flag m_fingerprint_flag;
+        mutable uint64_t m_fingerprint;
     };
 
     // Inline Functions
+    const std::shared_ptr<ompl::base::SpaceInformation> &OmplMotionPlanner::spaceInformation() const {
+        return m_space_information;
+    }
+
     OmplMotionPlannerType OmplMotionPlanner::omplMotionPlannerType() const {
         return m_ompl_motion_planner_type;
     }
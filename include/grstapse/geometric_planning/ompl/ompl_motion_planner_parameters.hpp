@@ -22,6 +22,8 @@
  */
 #pragma once
 
+// Global
+#include <string>
 // Local
 #include "grstapse/geometric_planning/motion_planner_parameters_base.hpp"
 
@@ -51,6 +53,13 @@ namespace grstapse
         float connection_range;
         unsigned int solutions_window;
         float convergence_epislon;
+
+        //! Whether to grow a roadmap once per species and answer queries as searches on it (PRM and PRM* only)
+        bool reuse_roadmap;
+        //! The time spent growing a new roadmap before it is used to answer queries
+        float roadmap_construction_time;
+        //! Directory that roadmaps are saved to and loaded from (roadmaps are only kept in memory if empty)
+        std::string roadmap_directory;
     };
 
 }  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,110 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <cstdint>
+#include <memory>
+#include <vector>
+// Local
+#include "grstapse/geometric_planning/pgm_environment.hpp"
+
+namespace grstapse
+{
+    /**!
+     * Environment from a PGM image that answers collision queries with a pyramid of occupancy maps
+     *
+     * Level 0 marks the obstacle pixels of the image and each coarser level marks the 2x2 blocks of the level below
+     * that contain an obstacle (a complete region quadtree stored level by level). A query for a rectangle of pixels
+     * descends from the single cell at the top and stops at the first free cell, so large open regions are proven
+     * free with a handful of lookups. Validity is identical to PgmEnvironment: a query that cannot be decided on the
+     * bounding square of the robot falls back to the exact check
+     */
+    class QuadtreeEnvironment
+        : public PgmEnvironment
+        , public std::enable_shared_from_this<QuadtreeEnvironment>
+    {
+       public:
+        //! For json
+        QuadtreeEnvironment();
+
+        //! Constructor
+        QuadtreeEnvironment(const std::string& filepath,
+                            const float resolution,
+                            const float origin_x,
+                            const float origin_y);
+
+        using PgmEnvironment::isValid;
+
+        //! \copydoc OmplEnvironment::isValid
+        [[nodiscard]] bool isValid(const ompl::base::State* state, const Species& species) const final override;
+
+        //! \copydoc OmplEnvironment::createMotionValidator
+        [[nodiscard]] std::shared_ptr<ompl::base::MotionValidator> createMotionValidator(
+            const ompl::base::SpaceInformationPtr& space_information,
+            const std::shared_ptr<const Species>& species) const final override;
+
+        /**!
+         * \copydoc OmplEnvironment::isMotionFree
+         *
+         * Checks the bounding box of the robot swept along a straight motion (never free for Dubins curves)
+         */
+        [[nodiscard]] bool isMotionFree(const ompl::base::State* from,
+                                        const ompl::base::State* to,
+                                        const Species& species) const final override;
+
+        /**!
+         * \returns Whether there are no obstacle pixels in the (inclusive) rectangle of cells from (\p min_cx,
+         *          \p min_cy) to (\p max_cx, \p max_cy)
+         *
+         * \note Cells outside of the image are free
+         */
+        [[nodiscard]] bool isRegionFree(int min_cx, int min_cy, int max_cx, int max_cy) const;
+
+        //! \returns The number of levels in the pyramid
+        [[nodiscard]] inline unsigned int numLevels() const;
+
+       private:
+        //! Builds the pyramid from the image
+        void buildLevels();
+
+        //! \returns Whether the rectangle is free inside of the cell (\p x, \p y) of \p level
+        [[nodiscard]] bool isRegionFree(
+            unsigned int level, int x, int y, int min_cx, int min_cy, int max_cx, int max_cy) const;
+
+        //! One row major mask per level (1 means the block contains an obstacle), from finest to coarsest
+        std::vector<std::vector<uint8_t>> m_levels;
+        std::vector<int> m_level_widths;
+        std::vector<int> m_level_heights;
+
+        friend void from_json(const nlohmann::json& j, QuadtreeEnvironment& e);
+    };
+
+    void from_json(const nlohmann::json& j, QuadtreeEnvironment& e);
+
+    // Inline functions
+    unsigned int QuadtreeEnvironment::numLevels() const
+    {
+        return m_levels.size();
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,66 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <memory>
+// External
+#include <ompl/base/StateValidityChecker.h>
+
+namespace grstapse
+{
+    // Forward Declarations
+    class OmplEnvironment;
+    class Species;
+
+    /**!
+     * Checks the validity of states against a shared (read-only) environment for a fixed species
+     *
+     * Unlike using the environment directly as the validity checker, this does not depend on the species set on the
+     * environment, so multiple planners can check states for different species concurrently
+     */
+    class SpeciesValidityChecker : public ompl::base::StateValidityChecker
+    {
+       public:
+        //! Constructor
+        SpeciesValidityChecker(const ompl::base::SpaceInformationPtr& space_information,
+                               const std::shared_ptr<const OmplEnvironment>& environment,
+                               const std::shared_ptr<const Species>& species);
+
+        //! \copydoc ompl::base::StateValidityChecker
+        [[nodiscard]] bool isValid(const ompl::base::State* state) const final override;
+
+        //! \returns The species that states are checked for
+        [[nodiscard]] inline const std::shared_ptr<const Species>& species() const;
+
+       private:
+        std::shared_ptr<const OmplEnvironment> m_environment;
+        std::shared_ptr<const Species> m_species;
+    };
+
+    // Inline Functions
+    const std::shared_ptr<const Species>& SpeciesValidityChecker::species() const
+    {
+        return m_species;
+    }
+}  // namespace grstapse
\ No newline at end of file
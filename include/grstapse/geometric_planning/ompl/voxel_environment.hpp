@@ -0,0 +1,113 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <cstdint>
+#include <memory>
+#include <vector>
+// Local
+#include "grstapse/common/utilities/voxel_grid.hpp"
+#include "grstapse/geometric_planning/ompl/ompl_environment.hpp"
+
+namespace grstapse
+{
+    /**!
+     * SE(3) environment where the map comes from a voxel octree file
+     *
+     * Robots are spheres of their bounding radius. A clearance field (the distance from the center of each voxel to the
+     * center of the nearest occupied voxel) is precomputed when the map is loaded, so checking a state is a single
+     * lookup and motions that stay within the clearance of their endpoints are accepted without sampling.
+     */
+    class VoxelEnvironment
+        : public OmplEnvironment
+        , public std::enable_shared_from_this<VoxelEnvironment>
+    {
+       public:
+        //! For json
+        VoxelEnvironment();
+
+        //! Constructor
+        explicit VoxelEnvironment(const std::string& filepath);
+
+        //! Constructor for a grid in memory
+        explicit VoxelEnvironment(VoxelGrid grid);
+
+        using OmplEnvironment::isValid;
+
+        /**!
+         * \copydoc OmplEnvironment::isValid
+         *
+         * A state is valid if no occupied voxel center is strictly closer to the center of its voxel than the bounding
+         * radius of the robot
+         */
+        [[nodiscard]] bool isValid(const ompl::base::State* state, const Species& species) const final override;
+
+        /**!
+         * \copydoc OmplEnvironment::isMotionFree
+         *
+         * The clearance field is 1-Lipschitz, so a straight motion is free if the clearance left at its endpoints
+         * covers its length
+         */
+        [[nodiscard]] bool isMotionFree(const ompl::base::State* from,
+                                        const ompl::base::State* to,
+                                        const Species& species) const final override;
+
+        //! \copydoc OmplEnvironment::createMotionValidator
+        [[nodiscard]] std::shared_ptr<ompl::base::MotionValidator> createMotionValidator(
+            const ompl::base::SpaceInformationPtr& space_information,
+            const std::shared_ptr<const Species>& species) const final override;
+
+        //! \copydoc Environment
+        [[nodiscard]] float longestPath() const final override;
+
+        //! \returns A hash of the grid and the state space
+        [[nodiscard]] uint64_t fingerprint() const final override;
+
+        /**!
+         * \returns The distance from the center of the voxel containing (\p x, \p y, \p z) to the center of the
+         *          nearest occupied voxel (infinity if the grid is empty or the point is outside of it)
+         */
+        [[nodiscard]] float clearance(float x, float y, float z) const;
+
+        //! \returns The occupancy grid
+        [[nodiscard]] inline const VoxelGrid& grid() const;
+
+       private:
+        //! Computes the clearance field and the bounds of the state space from the grid
+        void initialize();
+
+        VoxelGrid m_grid;
+        std::vector<float> m_clearance;  //!< Per voxel, in the same order as the grid
+
+        friend void from_json(const nlohmann::json& j, VoxelEnvironment& e);
+    };
+
+    void from_json(const nlohmann::json& j, VoxelEnvironment& e);
+
+    // Inline functions
+    const VoxelGrid& VoxelEnvironment::grid() const
+    {
+        return m_grid;
+    }
+}  // namespace grstapse
\ No newline at end of file
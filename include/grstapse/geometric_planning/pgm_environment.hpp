@@ -23,7 +23,9 @@
 #pragma once
 
 // Global
+#include <cstdint>
 #include <memory>
+#include <vector>
 // Local
 #include "grstapse/common/utilities/pgm.hpp"
 #include "grstapse/geometric_planning/ompl/ompl_environment.hpp"
@@ -42,12 +44,17 @@ namespace grstapse
         //! Constructor
         PgmEnvironment(const std::string& filepath, const float resolution, const float origin_x, const float origin_y);
 
-        //! \copydoc ompl::base::StateValidityChecker
-        [[nodiscard]] bool isValid(const ompl::base::State* state) const final override;
+        using OmplEnvironment::isValid;
+
+        //! \copydoc OmplEnvironment::isValid
+        [[nodiscard]] bool isValid(const ompl::base::State* state, const Species& species) const override;
 
         //! \copydoc Environment
         [[nodiscard]] float longestPath() const final override;
 
+        //! \returns A hash of the image, its placement and the state space
+        [[nodiscard]] uint64_t fingerprint() const final override;
+
         //! \returns The minimum x coordinate in the environment
         [[nodiscard]] inline float minX() const;
 
@@ -63,11 +70,61 @@ namespace grstapse
         //! \returns The resolution of a pixel in the pgm
         [[nodiscard]] inline float resolution() const;
 
-       private:
+        /**!
+         * Inflates the obstacles of the map by the bounding radius of a robot
+         *
+         * \param bounding_radius The bounding radius of the robot
+         *
+         * \returns A (row major) mask over the cells of the map where 1 means a robot with \p bounding_radius
+         *          centered in that cell is in collision (matches isValid)
+         */
+        [[nodiscard]] std::vector<uint8_t> inflatedOccupancy(float bounding_radius) const;
+
+        /**!
+         * Computes the shortest path distances from (\p x, \p y) to every cell of the map through the free cells of
+         * \p occupancy (8-connected Dijkstra)
+         *
+         * \param occupancy A mask from inflatedOccupancy
+         * \param x The x coordinate of the source
+         * \param y The y coordinate of the source
+         *
+         * \returns The (row major) distance to each cell (infinity if it cannot be reached)
+         */
+        [[nodiscard]] std::vector<float> geodesicDistances(const std::vector<uint8_t>& occupancy,
+                                                           float x,
+                                                           float y) const;
+
+        /**!
+         * \copydoc geodesicDistances
+         *
+         * \param distances Output: the (row major) distance to each cell (overwritten so that one buffer can be reused
+         *                  for many sources)
+         */
+        void geodesicDistances(const std::vector<uint8_t>& occupancy,
+                               float x,
+                               float y,
+                               std::vector<float>& distances) const;
+
+        /**!
+         * \returns A lower bound on the length of a collision free path between the source of \p distances and
+         *          (\p x, \p y) (infinity if there is none on the grid)
+         *
+         * \note The grid distance is corrected for the overestimate of 8-connected paths and for the discretization
+         *       of the endpoints so that it does not exceed the length of a continuous path
+         */
+        [[nodiscard]] float geodesicLowerBound(const std::vector<float>& distances, float x, float y) const;
+
+       protected:
+        //! Constructor for derivatives
+        explicit PgmEnvironment(OmplEnvironmentType environment_type);
+
         //! \returns The cell coordinate in the image for the real word coordinates (\p x, \p y)
         [[nodiscard]] inline std::pair<int, int> toCell(const float x, const float y) const;
 
-        Pgm m_pgm;
+        //! \returns Whether the cell (\p cx, \p cy) is in the image
+        [[nodiscard]] inline bool inMap(const int cx, const int cy) const;
+
+        std::shared_ptr<const Pgm> m_pgm;  //!< Shared with other environments using the same image
         float m_turning_radius;
         float m_resolution;
         float m_origin_x;
@@ -86,7 +143,7 @@ namespace grstapse
 
     float PgmEnvironment::maxX() const
     {
-        return m_origin_x + m_pgm.width() * m_resolution;
+        return m_origin_x + m_pgm->width() * m_resolution;
     }
 
     float PgmEnvironment::minY() const
@@ -96,7 +153,7 @@ namespace grstapse
 
     float PgmEnvironment::maxY() const
     {
-        return m_origin_y + m_pgm.height() * m_resolution;
+        return m_origin_y + m_pgm->height() * m_resolution;
     }
 
     float PgmEnvironment::resolution() const
@@ -110,4 +167,9 @@ namespace grstapse
         const int cy = (y - m_origin_y) / m_resolution;
         return {cx, cy};
     }
+
+    bool PgmEnvironment::inMap(const int cx, const int cy) const
+    {
+        return cx >= 0 && cy >= 0 && cx < static_cast<int>(m_pgm->width()) && cy < static_cast<int>(m_pgm->height());
+    }
 }  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,100 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <tuple>
+#include <vector>
+
+namespace grstapse
+{
+    /**!
+     * Container for a temporal precedence between two tasks: the successor cannot start until \p lag after the
+     * predecessor finishes
+     */
+    struct TemporalArc
+    {
+        unsigned int predecessor;
+        unsigned int successor;
+        float lag;
+    };
+
+    /**!
+     * Computes the earliest start/finish timepoints of a set of tasks by propagating along the longest paths through
+     * the precedence graph (in topological order) in O(tasks + arcs)
+     *
+     * \param durations The duration of each task
+     * \param release_times The earliest time that each task can start (e.g. the initial transitions)
+     * \param arcs The temporal precedences between the tasks
+     * \param timepoints Output: timepoints[i] = (start, finish) of the ith task
+     *
+     * \returns The makespan of the tasks, or a negative value if \p arcs contains a cycle
+     */
+    float propagateEarliestTimepoints(const std::vector<float>& durations,
+                                      const std::vector<float>& release_times,
+                                      const std::vector<TemporalArc>& arcs,
+                                      std::vector<std::pair<float, float>>& timepoints);
+
+    /**!
+     * Builds an arc for each (predecessor, successor) pair of \p constraints (lagged by the transition duration between
+     * the two tasks) and propagates the earliest timepoints along them
+     *
+     * \param durations The duration of each task
+     * \param release_times The earliest time that each task can start (e.g. the initial transitions)
+     * \param transition_duration Returns the transition duration from a predecessor to a successor (negative if
+     *                            motion planning fails)
+     * \param timepoints Output: timepoints[i] = (start, finish) of the ith task
+     * \param constraints Containers of (predecessor, successor) pairs (e.g. precedence constraints and an ordering of
+     *                    the mutex constraints)
+     *
+     * \returns The makespan of the tasks, or a negative value if a transition fails or the arcs contain a cycle
+     */
+    template <typename TransitionDurationFunction, typename... Constraints>
+    float propagateEarliestTimepoints(const std::vector<float>& durations,
+                                      const std::vector<float>& release_times,
+                                      const TransitionDurationFunction& transition_duration,
+                                      std::vector<std::pair<float, float>>& timepoints,
+                                      const Constraints&... constraints)
+    {
+        std::vector<TemporalArc> arcs;
+        arcs.reserve((constraints.size() + ... + 0));
+        auto add_arcs = [&transition_duration, &arcs](const auto& pairs) -> bool
+        {
+            for(const auto& [predecessor, successor]: pairs)
+            {
+                const float lag = transition_duration(predecessor, successor);
+                if(lag < 0.0f)
+                {
+                    return false;
+                }
+                arcs.push_back(TemporalArc{.predecessor = predecessor, .successor = successor, .lag = lag});
+            }
+            return true;
+        };
+        if(!(add_arcs(constraints) && ...))
+        {
+            return -1.0f;
+        }
+        return propagateEarliestTimepoints(durations, release_times, arcs, timepoints);
+    }
+}  // namespace grstapse
\ No newline at end of file
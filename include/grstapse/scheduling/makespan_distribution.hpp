@@ -0,0 +1,92 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <vector>
+
+namespace grstapse
+{
+    /**!
+     * Container for the distribution of the makespan of a schedule over a set of samples
+     *
+     * \see ScheduleRobustnessEvaluator
+     */
+    class MakespanDistribution
+    {
+       public:
+        /**!
+         * Constructor
+         *
+         * \param makespans The makespan for each sample (a negative value marks a sample where the schedule is
+         *                  infeasible)
+         */
+        explicit MakespanDistribution(std::vector<float> makespans);
+
+        /**!
+         * \returns The smallest makespan that at least ceil(\p alpha * numSamples()) of the samples finish within
+         *          (infinity if that includes an infeasible sample)
+         */
+        [[nodiscard]] float quantile(float alpha) const;
+
+        //! \returns The mean makespan over the samples (infinity if any sample is infeasible)
+        [[nodiscard]] float mean() const;
+
+        //! \returns The largest makespan over the samples (infinity if any sample is infeasible)
+        [[nodiscard]] inline float worst() const;
+
+        //! \returns The number of samples
+        [[nodiscard]] inline unsigned int numSamples() const;
+
+        //! \returns The number of samples where the schedule is infeasible
+        [[nodiscard]] inline unsigned int numInfeasible() const;
+
+        //! \returns The makespan of each sample in ascending order (infeasible samples are infinity)
+        [[nodiscard]] inline const std::vector<float>& sortedMakespans() const;
+
+       private:
+        std::vector<float> m_sorted_makespans;
+        unsigned int m_num_infeasible;
+    };
+
+    // Inline functions
+    float MakespanDistribution::worst() const
+    {
+        return quantile(1.0f);
+    }
+
+    unsigned int MakespanDistribution::numSamples() const
+    {
+        return m_sorted_makespans.size();
+    }
+
+    unsigned int MakespanDistribution::numInfeasible() const
+    {
+        return m_num_infeasible;
+    }
+
+    const std::vector<float>& MakespanDistribution::sortedMakespans() const
+    {
+        return m_sorted_makespans;
+    }
+}  // namespace grstapse
\ No newline at end of file
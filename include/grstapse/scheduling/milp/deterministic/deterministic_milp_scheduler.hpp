@@ -32,7 +32,9 @@
 #include <gurobi_c++.h>
 #include <robin_hood/robin_hood.hpp>
 // Local
+#include "grstapse/common/utilities/custom_hashings.hpp"
 #include "grstapse/scheduling/milp/deterministic/deterministic_milp_scheduler_base.hpp"
+#include "grstapse/scheduling/milp/deterministic/schedule_repair_inputs.hpp"
 #include "grstapse/scheduling/milp/mutex_constraint_info.hpp"
 #include "grstapse/scheduling/milp/robot_task_transition_info.hpp"
 #include "grstapse/scheduling/milp/task_variable_info.hpp"
@@ -57,10 +59,36 @@ namespace grstapse {
 
         void recomputEnviroment();
 
+        /**!
+         * \brief Repairs a schedule computed by this scheduler after the task durations have deviated during execution
+         *
+         * The ordering of \p schedule is kept and the timepoints are re-propagated (see DeterministicSchedule::repair).
+         * Only if that ordering has become infeasible is the MILP re-solved, warm started from \p schedule, with the
+         * tasks that have started fixed in place.
+         *
+         * \param schedule A schedule previously computed by this scheduler
+         * \param current_time The time at which the repair is requested
+         * \param task_statuses The execution status of each task
+         * \param task_durations The (updated) duration of each task (negative keeps the current duration)
+         *
+         * \returns The repaired schedule, or nullptr if no feasible schedule exists
+         */
+        [[nodiscard]] std::shared_ptr<const DeterministicSchedule> repairSchedule(
+                const DeterministicSchedule &schedule,
+                float current_time,
+                const std::vector<TaskExecutionStatus> &task_statuses,
+                const std::vector<float> &task_durations);
+
     protected:
         //! \copydoc SchedulerBase
         std::shared_ptr<const ScheduleBase> computeSchedule() override;
 
+        //! Iteratively solves the MILP until no heuristic transition durations are used by the solution
+        std::shared_ptr<const DeterministicSchedule> solveIteratively();
+
+        //! \copydoc DeterministicMilpSchedulerBase
+        bool createTaskDurationsOtherIterations(GRBModel &model) override;
+
         //! \copydoc DeterministicMilpSchedulerBase
         [[nodiscard]] std::string createTaskStartName(unsigned int task_nr) const final override;
 
@@ -127,5 +155,10 @@ namespace grstapse {
         //! Note: Needed for DeterministicMilpScheduler::m_reduced_mutex_constraints's reference
         robin_hood::unordered_map<std::string, MutexConstraintInfo> m_placeholder_reduced_mutex_constraints;
         GRBVar m_makespan;
+
+        // Only set during repairSchedule
+        const DeterministicSchedule *m_repair_schedule;
+        const ScheduleRepairInputs *m_repair_inputs;
+        robin_hood::unordered_set<std::pair<unsigned int, unsigned int>> m_repair_ordering;
     };
 }  // namespace grstapse
\ No newline at end of file
@@ -23,6 +23,7 @@
 #pragma once
 
 // Global
+#include <span>
 // External
 #include <robin_hood/robin_hood.hpp>
 // Local
@@ -160,7 +161,8 @@ namespace grstapse
 
         // region computeInitialTransitionHeuristicDurations
         /**!
-         * Computes the initial transition durations based on euclidean distance
+         * Sets the initial transition durations from the problem's TransitionDurationMatrix (using the heuristic
+         * duration for those that have not been computed by motion planning)
          */
         bool computeInitialTransitionHeuristicDurations();
 
@@ -185,22 +187,12 @@ namespace grstapse
         [[nodiscard]] virtual float computeInitialTransitionDuration(
             const std::shared_ptr<const ConfigurationBase>& configuration,
             const std::shared_ptr<const Robot>& robot) const = 0;
-
-        /**!
-         *
-         * \param configuration
-         * \param robot
-         *
-         * \returns
-         */
-        [[nodiscard]] virtual float computeInitialTransitionHeuristicDuration(
-            const std::shared_ptr<const ConfigurationBase>& configuration,
-            const std::shared_ptr<const Robot>& robot) const;
         // endregion
 
         // region computeTransitionHeuristicDuration
         /**!
-         * Computes the transition durations based on euclidean distance
+         * Sets the transition durations from the problem's TransitionDurationMatrix (using the heuristic duration for
+         * those that have not been computed by motion planning)
          */
         virtual bool computeTransitionHeuristicDurations();
 
@@ -229,20 +221,19 @@ namespace grstapse
             const std::shared_ptr<const ConfigurationBase>& initial_configuration,
             const std::shared_ptr<const ConfigurationBase>& goal_configuration,
             const std::shared_ptr<const Robot>& robot) const = 0;
+        // endregion
 
         /**!
+         * Computes the actual duration of a transition with motion planning (cached in the problem's
+         * TransitionDurationMatrix)
          *
-         * \param initial_configuration
-         * \param goal_configuration
-         * \param robot
+         * \param robot_nr The robot that transitions
+         * \param previous_task_nr The task the robot transitions from (negative for its initial configuration)
+         * \param task_nr The task the robot transitions to
          *
-         * \returns
+         * \returns The duration of the transition (negative if motion planning failed)
          */
-        [[nodiscard]] virtual float computeTransitionHeuristicDuration(
-            const std::shared_ptr<const ConfigurationBase>& initial_configuration,
-            const std::shared_ptr<const ConfigurationBase>& goal_configuration,
-            const std::shared_ptr<const Robot>& robot) const;
-        // endregion
+        float queryTransitionDuration(unsigned int robot_nr, int previous_task_nr, unsigned int task_nr);
 
         /**!
          * Checks if a transition exists between two tasks
@@ -254,10 +245,21 @@ namespace grstapse
          */
         [[nodiscard]] virtual std::pair<bool, float> checkTransitionFeasibility(unsigned int i, unsigned int j);
 
+        /**!
+         * \param i Index for a task
+         * \param j Index for another task
+         *
+         * \returns The transitions from task \p i to task \p j of the robots allocated to both tasks (empty if there
+         *          are none)
+         */
+        [[nodiscard]] std::span<RobotTaskTransitionInfo> transitionInfo(unsigned int i, unsigned int j);
+
         std::vector<float> m_task_durations;
         std::vector<TaskVariableInfo> m_tasks_timepoints;
         std::vector<TaskTransitionInfo> m_initial_transition_info;
-        std::vector<std::vector<TaskTransitionInfo>> m_transition_info;
+        std::vector<RobotTaskTransitionInfo> m_transition_info;        //!< Grouped by pair of tasks
+        std::vector<TaskPairTransitionInfo> m_task_pair_transitions;  //!< Sorted by pair of tasks
+        robin_hood::unordered_map<std::pair<unsigned int, unsigned int>, unsigned int> m_task_pair_index;
         std::unique_ptr<GRBVar> m_task_finishes;  //!< For makespan
         robin_hood::unordered_set<std::pair<unsigned int, unsigned int>> m_mp_induced_precedence_constraints;
         robin_hood::unordered_map<std::string, MutexConstraintInfo>& m_reduced_mutex_constraints;
@@ -23,12 +23,16 @@
 #pragma once
 
 // Global
+#include <memory>
 #include <tuple>
 #include <vector>
 // Local
 #include "grstapse/scheduling/schedule_base.hpp"
 
 namespace grstapse {
+    // Forward Declarations
+    struct ScheduleRepairInputs;
+
     //! \brief Container for a deterministic schedule for a set of tasks with constraints
     class DeterministicSchedule : public ScheduleBase {
     public:
@@ -62,6 +66,22 @@ namespace grstapse {
         //! \returns When the ith task ends
         [[nodiscard]] inline float taskEnd(const unsigned int i) const;
 
+        /**!
+         * \brief Repairs the schedule after the durations have deviated during execution
+         *
+         * Keeps the precedence set mutex constraints of this schedule and re-propagates the start/finish timepoints
+         * of the tasks in O(tasks + constraints). Tasks that have started keep their start timepoint and pending tasks
+         * cannot start before the current time.
+         *
+         * \param inputs The current state of execution
+         *
+         * \returns The repaired schedule, or nullptr if the ordering of this schedule has become infeasible (a
+         *          successor started before its predecessor, a transition failed, or the constraints contain a cycle)
+         *
+         * \see DeterministicMilpScheduler::repairSchedule
+         */
+        [[nodiscard]] std::shared_ptr<const DeterministicSchedule> repair(const ScheduleRepairInputs &inputs) const;
+
     protected:
         std::vector<std::pair<float, float>> m_timepoints;
     };
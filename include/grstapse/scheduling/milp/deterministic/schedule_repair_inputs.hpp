@@ -0,0 +1,62 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <vector>
+// Local
+#include "grstapse/scheduling/earliest_timepoint_propagation.hpp"
+
+namespace grstapse
+{
+    /**!
+     * Execution status of a task when a schedule is repaired
+     */
+    enum class TaskExecutionStatus
+    {
+        e_pending = 0,
+        e_in_progress,
+        e_completed
+    };
+
+    /**!
+     * Container for the state of execution used to repair a DeterministicSchedule
+     *
+     * \see DeterministicSchedule::repair
+     */
+    struct ScheduleRepairInputs
+    {
+        //! The time at which the repair is requested (pending tasks cannot start before it)
+        float current_time;
+        //! The execution status of each task
+        std::vector<TaskExecutionStatus> task_statuses;
+        //! The (updated) duration of each task (negative or empty keeps the duration from the schedule)
+        std::vector<float> task_durations;
+        //! The earliest time each task can start based on the initial transitions of its coalition
+        std::vector<float> initial_transition_durations;
+        //! The precedence constraints with the transition durations between the tasks as lags
+        std::vector<TemporalArc> precedence_constraints;
+        //! The transition duration for each of the schedule's precedence set mutex constraints (in the same order)
+        std::vector<float> mutex_transition_durations;
+    };
+}  // namespace grstapse
\ No newline at end of file
@@ -56,6 +56,8 @@ namespace grstapse
         float timeout;
         unsigned int threads;
         bool compute_transition_duration_heuristic;
+        //! Whether to use obstacle-aware (geodesic) lower bounds as the transition heuristic for pgm environments
+        bool geodesic_transition_heuristic;
 
        protected:
         void internalDeserialize(const nlohmann::json& j);
@@ -44,4 +44,13 @@ namespace grstapse
 
     using TaskTransitionInfo = std::vector<RobotTaskTransitionInfo>;
 
+    //! The range of a flat list of RobotTaskTransitionInfo that holds the transitions from task_i to task_j
+    struct TaskPairTransitionInfo
+    {
+        unsigned int task_i;
+        unsigned int task_j;
+        unsigned int begin;  //!< Index of the transition of the first robot allocated to both tasks
+        unsigned int end;    //!< One past the index of the transition of the last robot allocated to both tasks
+    };
+
 }  // namespace grstapse
\ No newline at end of file
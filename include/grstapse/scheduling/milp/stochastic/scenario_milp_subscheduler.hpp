@@ -59,6 +59,16 @@ namespace grstapse
         //! \copydoc DeterministicMilpSchedulerBase
         [[nodiscard]] std::string createPrecedenceConstraintName(unsigned int i, unsigned int j) const override;
 
+        /**!
+         * Adds the mutex constraints that the StochasticMilpScheduler left in the shared reduced set to \p model
+         *
+         * \note Never reduces the set itself (even when it is empty), as a mutex constraint that can be ordered either
+         *       way in this scenario may have been forced by another scenario
+         *
+         * \copydoc MilpSchedulerBase
+         */
+        bool createMutexConstraints(GRBModel& model) override;
+
         //! \copydoc DeterministicMilpSchedulerBase
         void addMutexConstraint(GRBModel& model,
                                 const unsigned int i,
@@ -78,11 +88,6 @@ namespace grstapse
             const std::shared_ptr<const ConfigurationBase>& configuration,
             const std::shared_ptr<const Robot>& robot) const final override;
 
-        //! \copydoc DeterministicMilpSchedulerBase
-        [[nodiscard]] float computeInitialTransitionHeuristicDuration(
-            const std::shared_ptr<const ConfigurationBase>& configuration,
-            const std::shared_ptr<const Robot>& robot) const override;
-
         //! \copydoc DeterministicMilpSchedulerBase
         [[nodiscard]] bool isTransitionMemoized(const std::shared_ptr<const ConfigurationBase>& initial_configuration,
                                                 const std::shared_ptr<const ConfigurationBase>& goal_configuration,
@@ -94,17 +99,43 @@ namespace grstapse
             const std::shared_ptr<const ConfigurationBase>& goal_configuration,
             const std::shared_ptr<const Robot>& robot) const override;
 
-        //! \copydoc DeterministicMilpSchedulerBase
-        [[nodiscard]] float computeTransitionHeuristicDuration(
-            const std::shared_ptr<const ConfigurationBase>& initial_configuration,
-            const std::shared_ptr<const ConfigurationBase>& goal_configuration,
-            const std::shared_ptr<const Robot>& robot) const override;
-
-        //! \copydoc MilpSchedulerBase
+        /**!
+         * Adds this scenario's makespan and its indicator for the chance constraint
+         *
+         * \note m_makespan must be set to the shared makespan variable before this is called
+         *
+         * \copydoc MilpSchedulerBase
+         */
         bool createObjective(GRBModel& model) override;
 
+        /**!
+         * Computes the task durations and the transition durations (between tasks that share a robot and have either a
+         * precedence or a mutex constraint) for this scenario
+         *
+         * \note Only uses the motion planner for this scenario's graph, so different scenarios can be computed
+         *       concurrently
+         *
+         * \returns Whether all of the task durations, initial transitions, and transitions that are forced by
+         *          precedence constraints were found
+         */
+        bool computeScenarioDurations();
+
+        /**!
+         * Computes the earliest start/finish times of the tasks for this scenario when the mutex constraints are
+         * ordered by \p ordering (longest path propagation, no MILP)
+         *
+         * \param ordering A list of (predecessor, successor) pairs for the mutex constraints
+         * \param timepoints Output: the (start, finish) of each task
+         *
+         * \returns The makespan of this scenario, or a negative value if the ordering is infeasible
+         */
+        float evaluateOrdering(const std::vector<std::pair<unsigned int, unsigned int>>& ordering,
+                               std::vector<std::pair<float, float>>& timepoints);
+
        protected:
         unsigned int m_index;
+        GRBVar m_makespan;   //!< The makespan shared by all scenarios (owned by the StochasticMilpScheduler)
+        GRBVar m_satisfied;  //!< Whether this scenario finishes within the shared makespan
 
        private:
         std::shared_ptr<const ScheduleBase> computeSchedule() override;
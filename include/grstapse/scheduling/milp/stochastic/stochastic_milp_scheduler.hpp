@@ -30,6 +30,13 @@ namespace grstapse
     /**!
      * \brief Uses a MILP formulation to solve a stochastic robot scheduling problem
      *
+     * The problem is solved with a scenario decomposition. The master problem is a chance constrained MILP over the
+     * mutex ordering variables (p_(i,j)) that are shared by all scenarios, but it only contains the temporal variables
+     * of an active subset of the scenarios (the inactive scenarios are assumed to be satisfied, so it is a relaxation).
+     * Each ordering from the master problem is then evaluated on every scenario in parallel with longest path
+     * propagation, which gives an upper bound. The scenarios that the master problem's makespan does not cover are
+     * added to the active set until the bounds meet or no scenario is violated.
+     *
      * \note We use gurobi as our MILP solver
      */
     class StochasticMilpScheduler : public MilpSchedulerBase
@@ -57,9 +64,34 @@ namespace grstapse
         //! \copydoc MilpSchedulerBase
         std::shared_ptr<const ScheduleBase> computeSchedule() override;
 
+        //! \returns The number of scenarios that must finish within the makespan (ceil(alpha * q))
+        [[nodiscard]] unsigned int numRequiredScenarios() const;
+
+        /**!
+         * Removes the mutex constraints that are already ordered by a precedence constraint and forces the direction of
+         * the mutex constraints that can only be transitioned in one direction in at least one scenario
+         *
+         * \returns Whether every mutex constraint can be ordered in at least one direction for all scenarios
+         */
+        bool reduceMutexConstraints();
+
+        /**!
+         * Evaluates \p ordering on every scenario in parallel
+         *
+         * \param ordering A list of (predecessor, successor) pairs for the mutex constraints
+         * \param num_threads The number of threads to use (0 uses one per hardware thread)
+         *
+         * \returns The makespan of each scenario (negative if the ordering is infeasible for a scenario)
+         */
+        [[nodiscard]] std::vector<float> evaluateScenarios(
+            const std::vector<std::pair<unsigned int, unsigned int>>& ordering,
+            unsigned int num_threads);
+
        protected:
         std::vector<ScenarioMilpSubscheduler> m_subschedulers;
         robin_hood::unordered_map<std::string, MutexConstraintInfo> m_reduced_mutex_constraints;
+        std::vector<unsigned int> m_active_scenarios;  //!< The scenarios that are in the master problem
+        GRBVar m_makespan;
         unsigned int m_num_scenario;
         float m_alpha_q;  //!< alpha * q
     };
@@ -32,11 +32,17 @@ namespace grstapse
      */
     struct StochasticMilpSchedulerParameters : public MilpSchedulerParameters
     {
+        //! Default Constructor
+        StochasticMilpSchedulerParameters();
+
         //!
         static std::shared_ptr<const StochasticMilpSchedulerParameters> deserializeFromJson(const nlohmann::json& j);
 
         float alpha;
         unsigned int num_scenarios;
+        unsigned int scenarios_per_iteration;  //!< Number of scenarios added to the master problem each iteration
+        float decomposition_gap;               //!< Relative gap between the bounds at which the decomposition stops
+        unsigned int scenario_threads;         //!< Number of threads for the scenario subproblems (0 = all cores)
     };
 
 }  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,132 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <memory>
+#include <tuple>
+#include <vector>
+// External
+#include <robin_hood/robin_hood.hpp>
+// Local
+#include "grstapse/common/utilities/custom_hashings.hpp"
+#include "grstapse/common/utilities/noncopyable.hpp"
+#include "grstapse/scheduling/makespan_distribution.hpp"
+
+namespace grstapse
+{
+    // Forward Declarations
+    class SampledPointGraphShortestPaths;
+    class ScheduleBase;
+    class SchedulerProblemInputs;
+
+    /**!
+     * Evaluates how a fixed ordering of the mutex constraints performs over every sample of the
+     * SampledPointGraphEnvironments used by the robots
+     *
+     * For each sample, the task durations and transitions are queried from that sample's graph and the makespan is
+     * computed by longest path propagation through the precedence constraints and the ordering (no MILP). The samples
+     * are independent and are evaluated in parallel.
+     *
+     * \see SampledPointGraphMotionPlanner
+     * \see StochasticMilpScheduler
+     */
+    class ScheduleRobustnessEvaluator : public Noncopyable
+    {
+       public:
+        /**!
+         * Constructor
+         *
+         * \param problem_inputs The allocation, tasks, and robots to evaluate (each robot's species must use a
+         *                       SampledPointGraphMotionPlanner)
+         * \param num_threads The number of threads to use (0 uses one per hardware thread)
+         */
+        explicit ScheduleRobustnessEvaluator(const std::shared_ptr<const SchedulerProblemInputs>& problem_inputs,
+                                             unsigned int num_threads = 0);
+
+        /**!
+         * Computes the makespan distribution over all samples
+         *
+         * \param precedence_set_mutex_constraints A list of (predecessor, successor) pairs that order the mutex
+         *                                         constraints
+         *
+         * \returns The makespan distribution over all samples
+         */
+        [[nodiscard]] MakespanDistribution evaluate(
+            const std::vector<std::pair<unsigned int, unsigned int>>& precedence_set_mutex_constraints) const;
+
+        //! \returns The makespan distribution of the ordering from \p schedule over all samples
+        [[nodiscard]] MakespanDistribution evaluate(const ScheduleBase& schedule) const;
+
+        /**!
+         * Computes the makespan of a single sample
+         *
+         * \param index The index of the sample
+         * \param precedence_set_mutex_constraints A list of (predecessor, successor) pairs that order the mutex
+         *                                         constraints
+         *
+         * \returns The makespan for the \p index'th sample, or a negative value if the ordering is infeasible for it
+         */
+        [[nodiscard]] float evaluateSample(
+            unsigned int index,
+            const std::vector<std::pair<unsigned int, unsigned int>>& precedence_set_mutex_constraints) const;
+
+        //! \returns The number of samples
+        [[nodiscard]] inline unsigned int numSamples() const;
+
+       private:
+        //! A duration query resolved to the shortest path tree that answers it in every sample
+        struct DurationQuery
+        {
+            std::shared_ptr<const SampledPointGraphShortestPaths> tree;
+            unsigned int target_id;  //!< The vertex whose path length is read from tree
+            float speed;             //!< The speed of the robot's species
+        };
+
+        //! \returns The duration of \p query in the \p index'th sample (negative if there is no path)
+        [[nodiscard]] static float duration(const DurationQuery& query, unsigned int index);
+
+        /**!
+         * \returns The longest transition from \p predecessor to \p successor for the robots allocated to both in the
+         *          \p index'th sample (negative if one fails)
+         */
+        [[nodiscard]] float transitionDuration(unsigned int index,
+                                               unsigned int predecessor,
+                                               unsigned int successor) const;
+
+        // The queries are resolved once by the constructor so that evaluating a sample only reads the trees
+        std::shared_ptr<const SchedulerProblemInputs> m_problem_inputs;
+        std::vector<DurationQuery> m_task_queries;                  //!< Per task (by the widest robot allocated to it)
+        std::vector<std::vector<DurationQuery>> m_initial_queries;  //!< Per task, per robot allocated to it
+        robin_hood::unordered_map<std::pair<unsigned int, unsigned int>, std::vector<DurationQuery>>
+            m_transition_queries;  //!< (predecessor, successor) -> per robot allocated to both
+        unsigned int m_num_samples;
+        unsigned int m_num_threads;
+    };
+
+    // Inline functions
+    unsigned int ScheduleRobustnessEvaluator::numSamples() const
+    {
+        return m_num_samples;
+    }
+}  // namespace grstapse
\ No newline at end of file
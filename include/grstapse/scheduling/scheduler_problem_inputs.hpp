@@ -58,6 +58,7 @@ namespace grstapse
         [[nodiscard]] inline const std::shared_ptr<const Task>& planTask(unsigned int index) const;
         [[nodiscard]] inline unsigned int numberOfPlanTasks() const;
         [[nodiscard]] inline const std::multimap<unsigned int, unsigned int>& precedenceConstraints() const;
+        [[nodiscard]] inline const std::shared_ptr<TransitionDurationMatrix>& transitionDurationMatrix() const;
 
         // Module Parameters
         [[nodiscard]] inline const std::shared_ptr<const SchedulerParameters>& schedulerParameters() const;
@@ -113,6 +114,10 @@ namespace grstapse
     {
         return m_itags_problem_inputs->precedenceConstraints();
     }
+    const std::shared_ptr<TransitionDurationMatrix>& SchedulerProblemInputs::transitionDurationMatrix() const
+    {
+        return m_itags_problem_inputs->transitionDurationMatrix();
+    }
     const std::shared_ptr<const SchedulerParameters>& SchedulerProblemInputs::schedulerParameters() const
     {
         return m_itags_problem_inputs->schedulerParameters();
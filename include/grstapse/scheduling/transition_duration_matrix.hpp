@@ -0,0 +1,221 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// Global
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+// Local
+#include "grstapse/common/utilities/noncopyable.hpp"
+
+namespace grstapse
+{
+    // Forward Declarations
+    class Robot;
+    class Species;
+    class Task;
+
+    /**!
+     * Dense per-species matrix of the transition durations between the plan tasks of a problem
+     *
+     * Holds the heuristic (lower bound) transition durations, which are computed once per problem, and caches the
+     * actual transition durations as they are computed by motion planning, so that each scheduler (one per ITAGS node)
+     * reads them directly instead of recomputing them.
+     *
+     * \note The transition from task i to task j is from the terminal configuration of i to the initial configuration
+     *       of j. Initial transitions depend on the initial configuration of a robot and so are stored per robot.
+     * \note Caching actual durations is thread-safe
+     *
+     * \see DeterministicMilpSchedulerBase
+     */
+    class TransitionDurationMatrix : public Noncopyable
+    {
+       public:
+        /**!
+         * Constructor
+         *
+         * \param tasks The plan tasks
+         * \param robots The robots
+         * \param geodesic_heuristic Whether to tighten the heuristic durations with obstacle-aware lower bounds for
+         *                           species that plan in a PgmEnvironment
+         */
+        TransitionDurationMatrix(const std::vector<std::shared_ptr<const Task>>& tasks,
+                                 const std::vector<std::shared_ptr<const Robot>>& robots,
+                                 bool geodesic_heuristic = false);
+
+        //! \returns The heuristic duration for robot \p robot_nr to transition from task \p task_i to task \p task_j
+        [[nodiscard]] inline float transitionHeuristicDuration(unsigned int robot_nr,
+                                                               unsigned int task_i,
+                                                               unsigned int task_j) const;
+
+        /**!
+         * \returns The actual duration for robot \p robot_nr to transition from task \p task_i to task \p task_j if it
+         *          has been computed (negative if motion planning failed)
+         */
+        [[nodiscard]] inline std::optional<float> transitionDuration(unsigned int robot_nr,
+                                                                     unsigned int task_i,
+                                                                     unsigned int task_j) const;
+
+        //! Caches the actual duration for robot \p robot_nr to transition from task \p task_i to task \p task_j
+        inline void setTransitionDuration(unsigned int robot_nr,
+                                          unsigned int task_i,
+                                          unsigned int task_j,
+                                          float duration);
+
+        //! \returns The heuristic duration for robot \p robot_nr to transition from its initial configuration to task
+        //!          \p task_nr
+        [[nodiscard]] inline float initialTransitionHeuristicDuration(unsigned int robot_nr,
+                                                                      unsigned int task_nr) const;
+
+        /**!
+         * \returns The actual duration for robot \p robot_nr to transition from its initial configuration to task
+         *          \p task_nr if it has been computed (negative if motion planning failed)
+         */
+        [[nodiscard]] inline std::optional<float> initialTransitionDuration(unsigned int robot_nr,
+                                                                            unsigned int task_nr) const;
+
+        //! Caches the actual duration for robot \p robot_nr to transition from its initial configuration to task
+        //! \p task_nr
+        inline void setInitialTransitionDuration(unsigned int robot_nr, unsigned int task_nr, float duration);
+
+        //! \returns The index of the species of robot \p robot_nr
+        [[nodiscard]] inline unsigned int speciesIndex(unsigned int robot_nr) const;
+
+        //! \returns The number of tasks
+        [[nodiscard]] inline unsigned int numberOfTasks() const;
+
+       private:
+        /**!
+         * Tightens the heuristic durations with the geodesic distances (obstacles inflated by the bounding radius of
+         * the species) computed by a grid Dijkstra from the initial configuration of each task
+         *
+         * \note Skips species that do not plan in a PgmEnvironment and tasks/robots that are not SE(2) states
+         *
+         * \see PgmEnvironment::geodesicDistances
+         */
+        void computeGeodesicHeuristics(const std::vector<std::shared_ptr<const Task>>& tasks,
+                                       const std::vector<std::shared_ptr<const Robot>>& robots,
+                                       const std::vector<std::shared_ptr<const Species>>& species);
+
+        //! \returns The index in the flattened transition matrices
+        [[nodiscard]] inline std::size_t transitionIndex(unsigned int robot_nr,
+                                                         unsigned int task_i,
+                                                         unsigned int task_j) const;
+
+        //! \returns The index in the flattened initial transition matrices
+        [[nodiscard]] inline std::size_t initialTransitionIndex(unsigned int robot_nr, unsigned int task_nr) const;
+
+        //! \returns The value of a cached duration if it has been set
+        [[nodiscard]] static inline std::optional<float> load(const std::atomic<float>& duration);
+
+        unsigned int m_num_tasks;
+        std::vector<unsigned int> m_robot_species;  //!< Robot number to the index of its species
+
+        // species x task x task
+        std::vector<float> m_transition_heuristic_durations;
+        std::unique_ptr<std::atomic<float>[]> m_transition_durations;
+
+        // robot x task
+        std::vector<float> m_initial_transition_heuristic_durations;
+        std::unique_ptr<std::atomic<float>[]> m_initial_transition_durations;
+    };
+
+    // Inline functions
+    float TransitionDurationMatrix::transitionHeuristicDuration(const unsigned int robot_nr,
+                                                                const unsigned int task_i,
+                                                                const unsigned int task_j) const
+    {
+        return m_transition_heuristic_durations[transitionIndex(robot_nr, task_i, task_j)];
+    }
+
+    std::optional<float> TransitionDurationMatrix::transitionDuration(const unsigned int robot_nr,
+                                                                      const unsigned int task_i,
+                                                                      const unsigned int task_j) const
+    {
+        return load(m_transition_durations[transitionIndex(robot_nr, task_i, task_j)]);
+    }
+
+    void TransitionDurationMatrix::setTransitionDuration(const unsigned int robot_nr,
+                                                         const unsigned int task_i,
+                                                         const unsigned int task_j,
+                                                         const float duration)
+    {
+        m_transition_durations[transitionIndex(robot_nr, task_i, task_j)].store(duration, std::memory_order_relaxed);
+    }
+
+    float TransitionDurationMatrix::initialTransitionHeuristicDuration(const unsigned int robot_nr,
+                                                                       const unsigned int task_nr) const
+    {
+        return m_initial_transition_heuristic_durations[initialTransitionIndex(robot_nr, task_nr)];
+    }
+
+    std::optional<float> TransitionDurationMatrix::initialTransitionDuration(const unsigned int robot_nr,
+                                                                             const unsigned int task_nr) const
+    {
+        return load(m_initial_transition_durations[initialTransitionIndex(robot_nr, task_nr)]);
+    }
+
+    void TransitionDurationMatrix::setInitialTransitionDuration(const unsigned int robot_nr,
+                                                                const unsigned int task_nr,
+                                                                const float duration)
+    {
+        m_initial_transition_durations[initialTransitionIndex(robot_nr, task_nr)].store(duration,
+                                                                                        std::memory_order_relaxed);
+    }
+
+    unsigned int TransitionDurationMatrix::speciesIndex(const unsigned int robot_nr) const
+    {
+        return m_robot_species[robot_nr];
+    }
+
+    unsigned int TransitionDurationMatrix::numberOfTasks() const
+    {
+        return m_num_tasks;
+    }
+
+    std::size_t TransitionDurationMatrix::transitionIndex(const unsigned int robot_nr,
+                                                          const unsigned int task_i,
+                                                          const unsigned int task_j) const
+    {
+        return (static_cast<std::size_t>(m_robot_species[robot_nr]) * m_num_tasks + task_i) * m_num_tasks + task_j;
+    }
+
+    std::size_t TransitionDurationMatrix::initialTransitionIndex(const unsigned int robot_nr,
+                                                                 const unsigned int task_nr) const
+    {
+        return static_cast<std::size_t>(robot_nr) * m_num_tasks + task_nr;
+    }
+
+    std::optional<float> TransitionDurationMatrix::load(const std::atomic<float>& duration)
+    {
+        // Note: NaN marks a duration that has not been computed
+        const float value = duration.load(std::memory_order_relaxed);
+        if(value != value)
+        {
+            return std::nullopt;
+        }
+        return value;
+    }
+}  // namespace grstapse
\ No newline at end of file
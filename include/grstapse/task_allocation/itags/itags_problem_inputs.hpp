@@ -36,6 +36,7 @@ namespace grstapse
 {
     // Forward Declarations
     class Task;
+    class TransitionDurationMatrix;
 
     /**!
      * Contain for the inputs to an ITAGS problem
@@ -82,6 +83,9 @@ namespace grstapse
 
         [[nodiscard]] inline float scheduleWorstMakespan() const;
 
+        //! \returns The transition durations between the plan tasks for each species (shared by all schedulers)
+        [[nodiscard]] inline const std::shared_ptr<TransitionDurationMatrix> &transitionDurationMatrix() const;
+
         // Module Parameters
         [[nodiscard]] inline const std::shared_ptr<const BestFirstSearchParameters> &itagsParameters() const;
 
@@ -130,12 +134,18 @@ namespace grstapse
             const nlohmann::json &j,
             const std::shared_ptr<const GrstapsProblemInputs> &grstaps_problem_inputs);
 
+        //! Lets the motion planners precompute motion plans between the robot and task configurations
+        void precomputeMotionPlans();
+
+        //! Builds the transition duration cache (geodesic bounds if the MILP parameters ask for them)
+        void createTransitionDurationMatrix();
+
         // From task planning
         std::vector<unsigned int> m_plan_task_indices;
         std::multimap<unsigned int, unsigned int> m_precedence_constraints;
         Eigen::MatrixXf m_desired_traits_matrix;
 
-
+        std::shared_ptr<TransitionDurationMatrix> m_transition_duration_matrix;
 
         std::shared_ptr<const GrstapsProblemInputs> m_grstaps_problem_inputs;
 
@@ -170,6 +180,11 @@ namespace grstapse
         return m_schedule_worst_makespan;
     }
 
+    const std::shared_ptr<TransitionDurationMatrix> &ItagsProblemInputs::transitionDurationMatrix() const
+    {
+        return m_transition_duration_matrix;
+    }
+
     const std::shared_ptr<const BestFirstSearchParameters> &ItagsProblemInputs::itagsParameters() const
     {
         return m_grstaps_problem_inputs->itagsParameters();
@@ -35,6 +35,7 @@ namespace grstapse::constants
     const char* k_connection_range                      = "connection_range";
     const char* k_convergence_epislon                   = "convergence_epislon";
     const char* k_cost                                  = "cost";
+    const char* k_decomposition_gap                     = "decomposition_gap";
     const char* k_desired_traits                        = "desired_traits";
     const char* k_domain_filepath                       = "domain_filepath";
     const char* k_dubins                                = "dubins";
@@ -45,6 +46,7 @@ namespace grstapse::constants
     const char* k_execution_motion_plan                 = "execution_motion_plan";
     const char* k_fcpop_parameters                      = "fcpop_parameters";
     const char* k_finish_timepoint                      = "finish_timepoint";
+    const char* k_geodesic_transition_heuristic         = "geodesic_transition_heuristic";
     const char* k_goal_type                             = "goal_type";
     const char* k_graph_type                            = "graph_type";
     const char* k_heuristic_time                        = "heuristic_time";
@@ -91,9 +93,14 @@ namespace grstapse::constants
     const char* k_qy                                    = "qy";
     const char* k_qz                                    = "qz";
     const char* k_resolution                            = "resolution";
+    const char* k_reuse_roadmap                         = "reuse_roadmap";
+    const char* k_roadmap_construction_time             = "roadmap_construction_time";
+    const char* k_roadmap_directory                     = "roadmap_directory";
     const char* k_robot_traits_matrix_reduction         = "robot_traits_matrix_reduction";
     const char* k_robots                                = "robots";
     const char* k_rotation                              = "rotation";
+    const char* k_scenario_threads                      = "scenario_threads";
+    const char* k_scenarios_per_iteration               = "scenarios_per_iteration";
     const char* k_scheduler_parameters                  = "scheduler_parameters";
     const char* k_scheduler_type                        = "scheduler_type";
     const char* k_scheduling_time                       = "scheduling_time";
@@ -127,6 +134,7 @@ namespace grstapse::constants
     const char* k_vertex_a                              = "vertex_a";
     const char* k_vertex_b                              = "vertex_b";
     const char* k_vertices                              = "vertices";
+    const char* k_voxel_filepath                        = "voxel_filepath";
     const char* k_x                                     = "x";
     const char* k_y                                     = "y";
     const char* k_yaml_filepath                         = "yaml_filepath";
@@ -0,0 +1,124 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/common/utilities/distance_transform.hpp"
+
+// Global
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
+// External
+#include <fmt/format.h>
+// Local
+#include "grstapse/common/utilities/error.hpp"
+
+namespace grstapse
+{
+    std::vector<float> squaredDistanceTransform(std::span<const uint8_t> obstacles,
+                                                std::span<const unsigned int> dimensions)
+    {
+        const std::size_t num_cells =
+            std::accumulate(dimensions.begin(), dimensions.end(), std::size_t{1}, std::multiplies<>());
+        if(obstacles.size() != num_cells)
+        {
+            throw createLogicError(fmt::format("Expected {0:d} cells, but got {1:d}", num_cells, obstacles.size()));
+        }
+
+        const float infinity = std::numeric_limits<float>::infinity();
+        std::vector<float> squared_distances(num_cells);
+        for(std::size_t i = 0; i < num_cells; ++i)
+        {
+            squared_distances[i] = obstacles[i] ? 0.0f : infinity;
+        }
+        if(num_cells == 0)
+        {
+            return squared_distances;
+        }
+
+        // 1D transform of f (with the given stride) using the lower envelope of parabolas
+        const unsigned int max_dimension = *std::max_element(dimensions.begin(), dimensions.end());
+        std::vector<float> f(max_dimension);
+        std::vector<float> z(max_dimension + 1);
+        std::vector<int> v(max_dimension);
+        auto transform = [&squared_distances, &f, &z, &v, infinity](const std::size_t start,
+                                                                    const int n,
+                                                                    const std::size_t stride)
+        {
+            for(int q = 0; q < n; ++q)
+            {
+                f[q] = squared_distances[start + q * stride];
+            }
+            int k = -1;
+            for(int q = 0; q < n; ++q)
+            {
+                if(f[q] == infinity)
+                {
+                    continue;
+                }
+                float s = -infinity;
+                while(k >= 0)
+                {
+                    s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2.0f * (q - v[k]));
+                    if(s > z[k])
+                    {
+                        break;
+                    }
+                    --k;
+                }
+                ++k;
+                v[k]     = q;
+                z[k]     = k == 0 ? -infinity : s;
+                z[k + 1] = infinity;
+            }
+            for(int q = 0, j = 0; q < n; ++q)
+            {
+                if(k < 0)
+                {
+                    squared_distances[start + q * stride] = infinity;
+                    continue;
+                }
+                while(z[j + 1] < q)
+                {
+                    ++j;
+                }
+                squared_distances[start + q * stride] = (q - v[j]) * (q - v[j]) + f[v[j]];
+            }
+        };
+
+        // Transform every line along each axis in turn
+        std::size_t stride = 1;
+        for(const unsigned int n: dimensions)
+        {
+            const std::size_t line_span = stride * n;
+            for(std::size_t outer = 0; outer < num_cells; outer += line_span)
+            {
+                for(std::size_t inner = 0; inner < stride; ++inner)
+                {
+                    transform(outer + inner, n, stride);
+                }
+            }
+            stride = line_span;
+        }
+        return squared_distances;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -23,112 +23,219 @@
 #include "grstapse/common/utilities/pgm.hpp"
 
 // Global
-#include <exception>
+#include <cctype>
 #include <fstream>
-#include <sstream>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+// External
+#include <fmt/format.h>
+// Local
+#include "grstapse/common/utilities/error.hpp"
 
 namespace grstapse
 {
+    namespace
+    {
+        //! The header of a pgm file
+        struct PgmHeader
+        {
+            bool binary;
+            unsigned int width;
+            unsigned int height;
+            unsigned int max_value;
+            std::size_t data_offset;  //!< Offset of the first byte of the pixels
+        };
+
+        /**!
+         * Reads the header of a pgm file: the magic number, width, height, and maximum value separated by whitespace
+         * and comments (from a '#' to the end of the line)
+         */
+        PgmHeader parseHeader(const uint8_t* data, const std::size_t size, const std::string& filepath)
+        {
+            std::size_t position = 0;
+            auto skip            = [&]()
+            {
+                while(position < size)
+                {
+                    if(std::isspace(data[position]))
+                    {
+                        ++position;
+                    }
+                    else if(data[position] == '#')
+                    {
+                        while(position < size && data[position] != '\n')
+                        {
+                            ++position;
+                        }
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+            };
+            auto read_unsigned = [&]() -> unsigned int
+            {
+                skip();
+                if(position >= size || !std::isdigit(data[position]))
+                {
+                    throw createLogicError(fmt::format("Malformed PGM header in '{0:s}'", filepath));
+                }
+                unsigned int rv = 0;
+                for(; position < size && std::isdigit(data[position]); ++position)
+                {
+                    rv = rv * 10 + (data[position] - '0');
+                }
+                return rv;
+            };
+
+            skip();
+            if(size < position + 2 || data[position] != 'P' || (data[position + 1] != '5' && data[position + 1] != '2'))
+            {
+                throw createLogicError(fmt::format("Invalid PGM image type in '{0:s}'", filepath));
+            }
+            PgmHeader header;
+            header.binary = data[position + 1] == '5';
+            position += 2;
+            header.width     = read_unsigned();
+            header.height    = read_unsigned();
+            header.max_value = read_unsigned();
+            // A single whitespace character separates the header from the pixels
+            header.data_offset = position + 1;
+            return header;
+        }
+    }  // namespace
+
     Pgm::Pgm(const std::string& filepath)
     {
         loadFile(filepath);
     }
 
+    Pgm::Pgm(unsigned int width, unsigned int height, std::vector<uint8_t> pixels)
+        : m_owned_pixels(std::move(pixels))
+        , m_width(width)
+        , m_height(height)
+    {
+        if(m_owned_pixels.size() != static_cast<std::size_t>(width) * height)
+        {
+            throw createLogicError(fmt::format("Expected {0:d} pixels, but got {1:d}",
+                                               static_cast<std::size_t>(width) * height,
+                                               m_owned_pixels.size()));
+        }
+        m_pixels = m_owned_pixels.data();
+    }
+
+    Pgm::~Pgm()
+    {
+        clear();
+    }
+
     void Pgm::loadFile(const std::string& filepath)
     {
-        std::ifstream fin(filepath.c_str());
+        clear();
 
-        std::string file_type;
-        getline(fin, file_type);
-        for(int i = 0; i < file_type.size(); ++i)
+        const int fd = ::open(filepath.c_str(), O_RDONLY);
+        if(fd < 0)
         {
-            if(file_type[i] == ' ')
-            {
-                continue;
-            }
-            // Comment
-            else if(file_type[i] == '#')
-            {
-                // Grab the next line and start over
-                getline(fin, file_type);
-                i = -1;
-                continue;
-            }
-            // Not comment
-            else
-            {
-                break;
-            }
+            throw createRuntimeError(fmt::format("Could not open '{0:s}'", filepath));
         }
-
-        if(file_type != "P5" && file_type != "P2")
+        struct stat file_stats;
+        if(::fstat(fd, &file_stats) != 0 || file_stats.st_size == 0)
+        {
+            ::close(fd);
+            throw createRuntimeError(fmt::format("Could not read '{0:s}'", filepath));
+        }
+        void* mapping = ::mmap(nullptr, file_stats.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        // The mapping keeps the file alive
+        ::close(fd);
+        if(mapping == MAP_FAILED)
         {
-            throw std::invalid_argument("Invalid PGM image type: " + file_type);
+            throw createRuntimeError(fmt::format("Could not memory-map '{0:s}'", filepath));
         }
+        m_mapping      = mapping;
+        m_mapping_size = file_stats.st_size;
 
-        std::string dimensions;
-        getline(fin, dimensions);
-        for(int i = 0; i < dimensions.size(); ++i)
+        try
         {
-            if(dimensions[i] == ' ')
+            const auto* data        = static_cast<const uint8_t*>(m_mapping);
+            const PgmHeader header  = parseHeader(data, m_mapping_size, filepath);
+            const std::size_t count = static_cast<std::size_t>(header.width) * header.height;
+            if(header.max_value > 255)
             {
-                continue;
+                throw createLogicError(fmt::format("16 bit PGM images are not supported ('{0:s}')", filepath));
             }
-            // Comment
-            else if(dimensions[i] == '#')
+
+            if(header.binary)
             {
-                // Grab the next line and start over
-                getline(fin, dimensions);
-                i = -1;
-                continue;
+                if(header.data_offset + count > m_mapping_size)
+                {
+                    throw createLogicError(fmt::format("PGM image '{0:s}' is truncated", filepath));
+                }
+                m_pixels = data + header.data_offset;
             }
-            // Not comment
             else
             {
-                break;
-            }
-        }
-
-        std::istringstream iss(dimensions);
-        iss >> m_width >> m_height;
-
-        m_pixels.resize(m_width * m_height);
-
-        std::string max_val_str;
-        getline(fin, max_val_str);
-
-        unsigned int i = 0;
-        if(file_type == "P2")
-        {
-            while(fin.good())
-            {
-                std::string line;
-                getline(fin, line);
-
-                std::istringstream iss2(line);
-                std::string val;
-                while(iss2 >> val)
+                // ASCII pixels are parsed into memory and the mapping is released
+                m_owned_pixels.reserve(count);
+                std::size_t position = header.data_offset;
+                while(m_owned_pixels.size() < count)
                 {
-                    m_pixels[i++] = atoi(val.c_str());
+                    while(position < m_mapping_size && !std::isdigit(data[position]))
+                    {
+                        ++position;
+                    }
+                    if(position >= m_mapping_size)
+                    {
+                        throw createLogicError(fmt::format("PGM image '{0:s}' is truncated", filepath));
+                    }
+                    unsigned int value = 0;
+                    for(; position < m_mapping_size && std::isdigit(data[position]); ++position)
+                    {
+                        value = value * 10 + (data[position] - '0');
+                    }
+                    m_owned_pixels.push_back(value);
                 }
+                ::munmap(m_mapping, m_mapping_size);
+                m_mapping      = nullptr;
+                m_mapping_size = 0;
+                m_pixels       = m_owned_pixels.data();
             }
+            m_width  = header.width;
+            m_height = header.height;
         }
-        else  // file_type == "P5"
+        catch(...)
         {
-            while(fin.good())
-            {
-                char lo;
-                fin.get(lo);
-                m_pixels[i++] = static_cast<unsigned int>(lo);
-            }
+            clear();
+            throw;
         }
+    }
 
-        fin.close();
+    void Pgm::saveFile(const std::string& filepath) const
+    {
+        std::ofstream fout(filepath, std::ios::binary);
+        fout << "P5\n" << m_width << ' ' << m_height << "\n255\n";
+        fout.write(reinterpret_cast<const char*>(m_pixels), static_cast<std::streamsize>(m_width) * m_height);
+        if(!fout)
+        {
+            throw createRuntimeError(fmt::format("Could not write '{0:s}'", filepath));
+        }
     }
 
-    void Pgm::saveFile(const std::string& filepath)
+    void Pgm::clear()
     {
-        // TODO(andrew)
-        throw std::logic_error("Not implemented");
+        if(m_mapping != nullptr)
+        {
+            ::munmap(m_mapping, m_mapping_size);
+        }
+        m_mapping      = nullptr;
+        m_mapping_size = 0;
+        m_owned_pixels.clear();
+        m_pixels = nullptr;
+        m_width  = 0;
+        m_height = 0;
     }
 }  // namespace grstapse
\ No newline at end of file
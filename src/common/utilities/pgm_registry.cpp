@@ -0,0 +1,71 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/common/utilities/pgm_registry.hpp"
+
+// Global
+#include <filesystem>
+// Local
+#include "grstapse/common/utilities/pgm.hpp"
+
+namespace grstapse
+{
+    PgmRegistry& PgmRegistry::instance()
+    {
+        static PgmRegistry singleton;
+        return singleton;
+    }
+
+    std::shared_ptr<const Pgm> PgmRegistry::load(const std::string& filepath)
+    {
+        const std::string key = std::filesystem::weakly_canonical(filepath).string();
+
+        // Loaded under the lock so that concurrent loads of the same file share a single mapping
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::weak_ptr<const Pgm>& entry = m_images[key];
+        if(std::shared_ptr<const Pgm> pgm = entry.lock(); pgm != nullptr)
+        {
+            return pgm;
+        }
+
+        // Drop the entries of released images
+        for(auto iter = m_images.begin(); iter != m_images.end();)
+        {
+            iter = iter->second.expired() && iter->first != key ? m_images.erase(iter) : std::next(iter);
+        }
+
+        auto pgm = std::make_shared<const Pgm>(filepath);
+        m_images[key] = pgm;
+        return pgm;
+    }
+
+    unsigned int PgmRegistry::size() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        unsigned int rv = 0;
+        for(const auto& [key, entry]: m_images)
+        {
+            rv += !entry.expired();
+        }
+        return rv;
+    }
+}  // namespace grstapse
\ No newline at end of file
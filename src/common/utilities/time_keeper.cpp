@@ -36,24 +36,40 @@ namespace grstapse
 
     void TimeKeeper::start(const std::string& timer_name)
     {
+        std::lock_guard<std::mutex> lock(m_mutex);
         if(!m_timers.contains(timer_name))
         {
-            m_timers[timer_name] = Timer();
+            m_timers[timer_name]      = Timer();
+            m_num_running[timer_name] = 0;
+        }
+        if(m_num_running[timer_name]++ == 0)
+        {
+            m_timers[timer_name].start();
         }
-        m_timers[timer_name].start();
     }
 
     void TimeKeeper::stop(const std::string& timer_name)
     {
+        std::lock_guard<std::mutex> lock(m_mutex);
         if(!m_timers.contains(timer_name))
         {
             throw createLogicError(fmt::format("Request for time from unknown timer '{0:s}'", timer_name));
         }
-        m_timers[timer_name].stop();
+        unsigned int& num_running = m_num_running[timer_name];
+        if(num_running == 0)
+        {
+            Logger::warn("TimeKeeper::stop called when timer '{0:s}' is not running", timer_name);
+            return;
+        }
+        if(--num_running == 0)
+        {
+            m_timers[timer_name].stop();
+        }
     }
 
     void TimeKeeper::reset(const std::string& timer_name)
     {
+        std::lock_guard<std::mutex> lock(m_mutex);
         if(!m_timers.contains(timer_name))
         {
             throw createLogicError(fmt::format("Request for time from unknown timer '{0:s}'", timer_name));
@@ -63,6 +79,7 @@ namespace grstapse
 
     float TimeKeeper::time(const std::string& timer_name) const
     {
+        std::lock_guard<std::mutex> lock(m_mutex);
         if(!m_timers.contains(timer_name))
         {
             throw createLogicError(fmt::format("Request for time from unknown timer '{0:s}'", timer_name));
@@ -0,0 +1,265 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/common/utilities/voxel_grid.hpp"
+
+// Global
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+// External
+#include <fmt/format.h>
+// Local
+#include "grstapse/common/utilities/error.hpp"
+
+namespace grstapse
+{
+    namespace
+    {
+        static_assert(std::endian::native == std::endian::little, "Voxel octree files are little endian");
+
+        constexpr char k_magic[4]          = {'G', 'V', 'O', 'X'};
+        constexpr uint32_t k_version       = 1;
+        constexpr uint8_t k_free_node      = 0;
+        constexpr uint8_t k_occupied_node  = 1;
+        constexpr uint8_t k_split_node     = 2;
+        constexpr std::size_t k_header_size = sizeof(k_magic) + sizeof(uint32_t) * 4 + sizeof(float) * 4;
+
+        //! \returns The edge of the smallest power of 2 cube that contains a grid with \p dimensions
+        unsigned int rootEdge(const std::array<unsigned int, 3>& dimensions)
+        {
+            return std::bit_ceil(std::max({dimensions[0], dimensions[1], dimensions[2], 1u}));
+        }
+
+        template <typename T>
+        void write(std::vector<uint8_t>& buffer, const T& value)
+        {
+            const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        template <typename T>
+        T read(const std::vector<uint8_t>& buffer, std::size_t& position)
+        {
+            T value;
+            std::memcpy(&value, buffer.data() + position, sizeof(T));
+            position += sizeof(T);
+            return value;
+        }
+    }  // namespace
+
+    VoxelGrid::VoxelGrid(const std::string& filepath)
+    {
+        loadFile(filepath);
+    }
+
+    VoxelGrid::VoxelGrid(const std::array<unsigned int, 3>& dimensions,
+                         const float resolution,
+                         const std::array<float, 3>& origin,
+                         std::vector<uint8_t> occupancy)
+        : m_dimensions(dimensions)
+        , m_resolution(resolution)
+        , m_origin(origin)
+        , m_occupancy(std::move(occupancy))
+    {
+        const std::size_t num_voxels = static_cast<std::size_t>(dimensions[0]) * dimensions[1] * dimensions[2];
+        if(m_occupancy.size() != num_voxels)
+        {
+            throw createLogicError(fmt::format("Expected {0:d} voxels, but got {1:d}", num_voxels, m_occupancy.size()));
+        }
+    }
+
+    void VoxelGrid::loadFile(const std::string& filepath)
+    {
+        std::ifstream fin(filepath, std::ios::binary);
+        if(!fin)
+        {
+            throw createRuntimeError(fmt::format("Could not open '{0:s}'", filepath));
+        }
+        const std::vector<uint8_t> buffer{std::istreambuf_iterator<char>(fin), std::istreambuf_iterator<char>()};
+        if(buffer.size() < k_header_size || std::memcmp(buffer.data(), k_magic, sizeof(k_magic)) != 0)
+        {
+            throw createLogicError(fmt::format("'{0:s}' is not a voxel octree file", filepath));
+        }
+
+        std::size_t position = sizeof(k_magic);
+        if(const auto version = read<uint32_t>(buffer, position); version != k_version)
+        {
+            throw createLogicError(fmt::format("Unsupported voxel octree version {0:d} in '{1:s}'", version, filepath));
+        }
+        for(unsigned int& dimension: m_dimensions)
+        {
+            dimension = read<uint32_t>(buffer, position);
+        }
+        m_resolution = read<float>(buffer, position);
+        for(float& coordinate: m_origin)
+        {
+            coordinate = read<float>(buffer, position);
+        }
+        if(!(m_resolution > 0.0f))
+        {
+            throw createLogicError(fmt::format("Invalid voxel resolution in '{0:s}'", filepath));
+        }
+
+        m_occupancy.assign(static_cast<std::size_t>(m_dimensions[0]) * m_dimensions[1] * m_dimensions[2], 0);
+
+        std::size_t node           = 0;
+        const std::size_t num_nodes = (buffer.size() - position) * 4;
+        auto next_code              = [&]() -> uint8_t
+        {
+            if(node >= num_nodes)
+            {
+                throw createLogicError(fmt::format("Voxel octree '{0:s}' is truncated", filepath));
+            }
+            const uint8_t code = (buffer[position + node / 4] >> (2 * (node % 4))) & 0b11;
+            ++node;
+            return code;
+        };
+        auto decode = [&](auto&& self, const unsigned int x, const unsigned int y, const unsigned int z,
+                          const unsigned int edge) -> void
+        {
+            switch(next_code())
+            {
+                case k_free_node:
+                {
+                    return;
+                }
+                case k_occupied_node:
+                {
+                    for(unsigned int vz = z, vz_end = std::min(z + edge, m_dimensions[2]); vz < vz_end; ++vz)
+                    {
+                        for(unsigned int vy = y, vy_end = std::min(y + edge, m_dimensions[1]); vy < vy_end; ++vy)
+                        {
+                            for(unsigned int vx = x, vx_end = std::min(x + edge, m_dimensions[0]); vx < vx_end; ++vx)
+                            {
+                                m_occupancy[index(vx, vy, vz)] = 1;
+                            }
+                        }
+                    }
+                    return;
+                }
+                case k_split_node:
+                {
+                    if(edge == 1)
+                    {
+                        throw createLogicError(fmt::format("Voxel octree '{0:s}' splits a voxel", filepath));
+                    }
+                    const unsigned int half = edge / 2;
+                    for(unsigned int child = 0; child < 8; ++child)
+                    {
+                        self(self,
+                             x + (child & 1) * half,
+                             y + ((child >> 1) & 1) * half,
+                             z + ((child >> 2) & 1) * half,
+                             half);
+                    }
+                    return;
+                }
+                default:
+                {
+                    throw createLogicError(fmt::format("Invalid node in voxel octree '{0:s}'", filepath));
+                }
+            }
+        };
+        decode(decode, 0, 0, 0, rootEdge(m_dimensions));
+    }
+
+    void VoxelGrid::saveFile(const std::string& filepath) const
+    {
+        // One code per node, collapsing uniform children into their parent
+        std::vector<uint8_t> codes;
+        auto encode = [&](auto&& self, const unsigned int x, const unsigned int y, const unsigned int z,
+                          const unsigned int edge) -> uint8_t
+        {
+            if(x >= m_dimensions[0] || y >= m_dimensions[1] || z >= m_dimensions[2])
+            {
+                codes.push_back(k_free_node);
+                return k_free_node;
+            }
+            if(edge == 1)
+            {
+                const uint8_t code = isOccupied(x, y, z) ? k_occupied_node : k_free_node;
+                codes.push_back(code);
+                return code;
+            }
+
+            const std::size_t start = codes.size();
+            codes.push_back(k_split_node);
+            const unsigned int half = edge / 2;
+            bool uniform            = true;
+            uint8_t first_code      = k_split_node;
+            for(unsigned int child = 0; child < 8; ++child)
+            {
+                const uint8_t code = self(self,
+                                          x + (child & 1) * half,
+                                          y + ((child >> 1) & 1) * half,
+                                          z + ((child >> 2) & 1) * half,
+                                          half);
+                if(child == 0)
+                {
+                    first_code = code;
+                }
+                uniform = uniform && code != k_split_node && code == first_code;
+            }
+            if(uniform)
+            {
+                codes.resize(start);
+                codes.push_back(first_code);
+                return first_code;
+            }
+            return k_split_node;
+        };
+        encode(encode, 0, 0, 0, rootEdge(m_dimensions));
+
+        std::vector<uint8_t> buffer;
+        buffer.reserve(k_header_size + (codes.size() + 3) / 4);
+        buffer.insert(buffer.end(), std::begin(k_magic), std::end(k_magic));
+        write(buffer, k_version);
+        for(const unsigned int dimension: m_dimensions)
+        {
+            write(buffer, static_cast<uint32_t>(dimension));
+        }
+        write(buffer, m_resolution);
+        for(const float coordinate: m_origin)
+        {
+            write(buffer, coordinate);
+        }
+        for(std::size_t i = 0; i < codes.size(); i += 4)
+        {
+            uint8_t byte = 0;
+            for(std::size_t j = i, j_end = std::min(i + 4, codes.size()); j < j_end; ++j)
+            {
+                byte |= codes[j] << (2 * (j - i));
+            }
+            buffer.push_back(byte);
+        }
+
+        std::ofstream fout(filepath, std::ios::binary);
+        if(!fout)
+        {
+            throw createRuntimeError(fmt::format("Could not open '{0:s}'", filepath));
+        }
+        fout.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    }
+}  // namespace grstapse
\ No newline at end of file
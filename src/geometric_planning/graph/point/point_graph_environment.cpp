@@ -52,12 +52,21 @@ namespace grstapse
         throw std::logic_error("Not implemented");
     }
 
-    std::shared_ptr<PointGraphEnvironment> PointGraphEnvironment::shallowCopy() const
+    void PointGraphEnvironment::freeze()
     {
-        auto rv        = std::make_shared<PointGraphEnvironment>();
-        rv->m_vertices = m_vertices;
-        rv->m_edges    = m_edges;
-        return rv;
+        if(m_csr == nullptr)
+        {
+            m_csr = std::make_shared<const UndirectedGraphCsr<PointGraphConfiguration>>(*this);
+        }
+    }
+
+    void PointGraphEnvironment::computeLandmarks(const unsigned int num_landmarks)
+    {
+        freeze();
+        if(m_landmarks == nullptr)
+        {
+            m_landmarks = std::make_shared<const PointGraphLandmarks>(m_csr, num_landmarks);
+        }
     }
 
     void from_json(const nlohmann::json& j, PointGraphEnvironment& environment)
@@ -76,5 +85,6 @@ namespace grstapse
                                 edge_j[constants::k_vertex_b],
                                 edge_j[constants::k_cost]);
         }
+        environment.freeze();
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,133 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/geometric_planning/graph/point/point_graph_landmarks.hpp"
+
+// Global
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+// Local
+#include "grstapse/geometric_planning/graph/point/point_graph_configuration.hpp"
+
+namespace grstapse
+{
+    namespace
+    {
+        //! \returns The cost from the vertex with dense index \p source to every vertex in \p csr
+        std::vector<float> dijkstra(const UndirectedGraphCsr<PointGraphConfiguration>& csr, const unsigned int source)
+        {
+            std::vector<float> costs(csr.numVertices(), std::numeric_limits<float>::infinity());
+
+            using QueueEntry = std::pair<float, unsigned int>;
+            std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<>> open;
+            costs[source] = 0.0f;
+            open.emplace(0.0f, source);
+            while(!open.empty())
+            {
+                const auto [cost, current] = open.top();
+                open.pop();
+                if(cost > costs[current])
+                {
+                    continue;
+                }
+                for(unsigned int entry = csr.begin(current), end = csr.end(current); entry < end; ++entry)
+                {
+                    const unsigned int successor = csr.neighbor(entry);
+                    const float successor_cost   = cost + csr.cost(entry);
+                    if(successor_cost < costs[successor])
+                    {
+                        costs[successor] = successor_cost;
+                        open.emplace(successor_cost, successor);
+                    }
+                }
+            }
+            return costs;
+        }
+    }  // namespace
+
+    PointGraphLandmarks::PointGraphLandmarks(
+        const std::shared_ptr<const UndirectedGraphCsr<PointGraphConfiguration>>& csr,
+        const unsigned int num_landmarks)
+        : m_csr(csr)
+    {
+        const unsigned int num_vertices = m_csr->numVertices();
+        if(num_vertices == 0 || num_landmarks == 0)
+        {
+            return;
+        }
+
+        // Cost from each vertex to its closest landmark; seeded from an arbitrary vertex so that the first landmark
+        // is on the periphery of the graph
+        std::vector<float> closest = dijkstra(*m_csr, 0);
+        std::vector<std::vector<float>> landmark_costs;
+        while(m_landmarks.size() < std::min(num_landmarks, num_vertices))
+        {
+            // Infinite costs (not connected to any landmark yet) are the farthest
+            const unsigned int next = std::max_element(closest.begin(), closest.end()) - closest.begin();
+            if(closest[next] <= 0.0f)
+            {
+                break;
+            }
+            m_landmarks.push_back(next);
+            landmark_costs.push_back(dijkstra(*m_csr, next));
+            for(unsigned int vertex = 0; vertex < num_vertices; ++vertex)
+            {
+                closest[vertex] = std::min(closest[vertex], landmark_costs.back()[vertex]);
+            }
+            if(m_landmarks.size() == 1)
+            {
+                // Drop the seed now that there is a real landmark
+                closest = landmark_costs.back();
+            }
+        }
+
+        const unsigned int num_selected = m_landmarks.size();
+        m_distances.resize(static_cast<std::size_t>(num_vertices) * num_selected);
+        for(unsigned int vertex = 0; vertex < num_vertices; ++vertex)
+        {
+            for(unsigned int landmark = 0; landmark < num_selected; ++landmark)
+            {
+                m_distances[static_cast<std::size_t>(vertex) * num_selected + landmark] =
+                    landmark_costs[landmark][vertex];
+            }
+        }
+    }
+
+    float PointGraphLandmarks::lowerBound(const unsigned int a, const unsigned int b) const
+    {
+        const unsigned int num_landmarks = m_landmarks.size();
+        const float* a_distances         = m_distances.data() + static_cast<std::size_t>(a) * num_landmarks;
+        const float* b_distances         = m_distances.data() + static_cast<std::size_t>(b) * num_landmarks;
+
+        // Triangle inequality: |d(L, a) - d(L, b)| <= d(a, b)
+        float rv = 0.0f;
+        for(unsigned int landmark = 0; landmark < num_landmarks; ++landmark)
+        {
+            const float difference = std::abs(a_distances[landmark] - b_distances[landmark]);
+            rv                     = std::isinf(difference) || std::isnan(difference) ? rv : std::max(rv, difference);
+        }
+        return rv;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -24,14 +24,15 @@
 
 // Local
 #include "grstapse/common/search/undirected_graph/undirected_graph_path_cost.hpp"
-#include "grstapse/common/search/undirected_graph/undirected_graph_successor_generator.hpp"
+#include "grstapse/common/search/undirected_graph/undirected_graph_csr_successor_generator.hpp"
 #include "grstapse/common/utilities/constants.hpp"
 #include "grstapse/geometric_planning/graph/point/equal_point_graph_configuration_goal_check.hpp"
 #include "grstapse/geometric_planning/graph/point/point_graph_a_star.hpp"
 #include "grstapse/geometric_planning/graph/point/point_graph_configuration.hpp"
-#include "grstapse/geometric_planning/graph/point/point_graph_configuration_euclidean_distance_heuristic.hpp"
 #include "grstapse/geometric_planning/graph/point/point_graph_environment.hpp"
+#include "grstapse/geometric_planning/graph/point/point_graph_landmark_heuristic.hpp"
 #include "grstapse/geometric_planning/graph/point/point_graph_motion_planning_query_result.hpp"
+#include "grstapse/geometric_planning/graph/point/point_graph_shortest_paths.hpp"
 #include "grstapse/geometric_planning/motion_planner_parameters_base.hpp"
 
 namespace grstapse
@@ -49,11 +50,64 @@ namespace grstapse
         , m_astar_functors({
               .pathcost            = std::make_shared<const UndirectedGraphPathCost<SearchNode>>(),
               .heuristic           = nullptr,  // Gets set for each A* search individually
-              .successor_generator = std::make_shared<const UndirectedGraphSuccessorGenerator<SearchNode>>(graph),
+              .successor_generator = nullptr,  // Set once the graph is frozen
               .goal_check          = nullptr  // Gets set for each A* search individually
           })
         , m_graph(graph)
-    {}
+        , m_shortest_paths(nullptr)
+    {
+        m_graph->computeLandmarks();
+        m_astar_functors.successor_generator =
+            std::make_shared<const UndirectedGraphCsrSuccessorGenerator<SearchNode>>(m_graph->csr());
+    }
+
+    float PointGraphMotionPlanner::durationQuery(const std::shared_ptr<const Species>& species,
+                                                 const std::shared_ptr<const ConfigurationBase>& initial_configuration,
+                                                 const std::shared_ptr<const ConfigurationBase>& goal_configuration)
+    {
+        auto ic = std::dynamic_pointer_cast<const PointGraphConfiguration>(initial_configuration);
+        auto gc = std::dynamic_pointer_cast<const PointGraphConfiguration>(goal_configuration);
+        if(m_shortest_paths != nullptr && ic != nullptr && gc != nullptr)
+        {
+            if(std::optional<float> length = m_shortest_paths->pathLength(ic->id(), gc->id()); length.has_value())
+            {
+                return *length / species->speed();
+            }
+        }
+        return MotionPlannerBase::durationQuery(species, initial_configuration, goal_configuration);
+    }
+
+    bool PointGraphMotionPlanner::isMemoized(
+        const std::shared_ptr<const Species>& species,
+        const std::shared_ptr<const ConfigurationBase>& initial_configuration,
+        const std::shared_ptr<const ConfigurationBase>& goal_configuration) const
+    {
+        auto ic = std::dynamic_pointer_cast<const PointGraphConfiguration>(initial_configuration);
+        auto gc = std::dynamic_pointer_cast<const PointGraphConfiguration>(goal_configuration);
+        if(m_shortest_paths != nullptr && ic != nullptr && gc != nullptr &&
+           m_shortest_paths->contains(ic->id(), gc->id()))
+        {
+            return true;
+        }
+        return MotionPlannerBase::isMemoized(species, initial_configuration, goal_configuration);
+    }
+
+    void PointGraphMotionPlanner::precompute(
+        const std::vector<std::shared_ptr<const ConfigurationBase>>& configurations)
+    {
+        std::vector<unsigned int> source_ids;
+        source_ids.reserve(configurations.size());
+        for(const std::shared_ptr<const ConfigurationBase>& configuration: configurations)
+        {
+            // Skip configurations from other environments
+            if(auto pgc = std::dynamic_pointer_cast<const PointGraphConfiguration>(configuration);
+               pgc != nullptr && m_graph->vertices().contains(pgc->id()))
+            {
+                source_ids.push_back(pgc->id());
+            }
+        }
+        m_shortest_paths = std::make_shared<const PointGraphShortestPaths>(m_graph, source_ids);
+    }
 
     std::shared_ptr<const MotionPlanningQueryResultBase> PointGraphMotionPlanner::computeMotionPlan(
         const std::shared_ptr<const Species>& species,
@@ -63,11 +117,29 @@ namespace grstapse
         auto ic = std::dynamic_pointer_cast<const PointGraphConfiguration>(initial_configuration);
         auto gc = std::dynamic_pointer_cast<const PointGraphConfiguration>(goal_configuration);
 
-        m_astar_functors.heuristic =
-            std::make_shared<const PointGraphConfigurationEuclideanDistanceHeuristic<SearchNode>>(gc);
-        m_astar_functors.goal_check = std::make_shared<const EqualPointGraphConfigurationGoalCheck<SearchNode>>(gc);
+        // Walk the precomputed shortest path tree
+        if(m_shortest_paths != nullptr && m_shortest_paths->contains(ic->id(), gc->id()))
+        {
+            std::vector<std::shared_ptr<PointGraphConfiguration>> path = m_shortest_paths->path(ic->id(), gc->id());
+            if(path.empty())
+            {
+                return std::make_shared<PointGraphMotionPlanningQueryResult>(MotionPlannerQueryStatus::e_timeout);
+            }
+            return std::make_shared<PointGraphMotionPlanningQueryResult>(MotionPlannerQueryStatus::e_success, path);
+        }
+
+        if(!m_graph->csr()->contains(gc->id()))
+        {
+            return std::make_shared<PointGraphMotionPlanningQueryResult>(MotionPlannerQueryStatus::e_timeout);
+        }
+
+        // Copied so that concurrent queries do not share the per search functors
+        AStarFunctors<SearchNode> astar_functors = m_astar_functors;
+        astar_functors.heuristic =
+            std::make_shared<const PointGraphLandmarkHeuristic<SearchNode>>(m_graph->landmarks(), gc);
+        astar_functors.goal_check = std::make_shared<const EqualPointGraphConfigurationGoalCheck<SearchNode>>(gc);
 
-        PointGraphAStar a_star(m_search_parameters, ic, m_graph, m_astar_functors);
+        PointGraphAStar a_star(m_search_parameters, ic, m_graph, astar_functors);
         auto result = a_star.search();
         if(!result.foundGoal())
         {
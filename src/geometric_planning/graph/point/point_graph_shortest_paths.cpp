@@ -0,0 +1,153 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/geometric_planning/graph/point/point_graph_shortest_paths.hpp"
+
+// Global
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+// Local
+#include "grstapse/common/utilities/parallel_for.hpp"
+#include "grstapse/geometric_planning/graph/point/point_graph_environment.hpp"
+
+namespace grstapse
+{
+    PointGraphShortestPaths::PointGraphShortestPaths(const std::shared_ptr<const PointGraphEnvironment>& graph,
+                                                     const std::vector<unsigned int>& source_ids,
+                                                     const unsigned int num_threads)
+    {
+        m_csr = graph->csr() != nullptr ? graph->csr()
+                                        : std::make_shared<const UndirectedGraphCsr<PointGraphConfiguration>>(*graph);
+
+        std::vector<unsigned int> sources;
+        for(const unsigned int id: source_ids)
+        {
+            if(!m_source_indices.contains(id))
+            {
+                m_source_indices[id] = sources.size();
+                sources.push_back(m_csr->index(id));
+            }
+        }
+
+        m_trees.resize(sources.size());
+        parallelFor(
+            0,
+            sources.size(),
+            [this, &sources](const unsigned int i)
+            {
+                m_trees[i] = dijkstra(sources[i]);
+            },
+            num_threads);
+    }
+
+    std::optional<float> PointGraphShortestPaths::pathLength(const unsigned int a, const unsigned int b) const
+    {
+        const auto tree = findTree(a, b);
+        if(!tree.has_value() || std::isinf(tree->first->costs[tree->second]))
+        {
+            return std::nullopt;
+        }
+        return tree->first->lengths[tree->second];
+    }
+
+    std::vector<std::shared_ptr<PointGraphConfiguration>> PointGraphShortestPaths::path(const unsigned int a,
+                                                                                        const unsigned int b) const
+    {
+        const auto tree = findTree(a, b);
+        if(!tree.has_value() || std::isinf(tree->first->costs[tree->second]))
+        {
+            return {};
+        }
+
+        // Walk from the other vertex to the root of the tree
+        std::vector<std::shared_ptr<PointGraphConfiguration>> rv;
+        for(int index = tree->second; index != -1; index = tree->first->predecessors[index])
+        {
+            rv.push_back(m_csr->vertex(index)->payload());
+        }
+
+        // The walk goes from b to a if the tree is rooted at a
+        if(m_source_indices.contains(a))
+        {
+            std::reverse(rv.begin(), rv.end());
+        }
+        return rv;
+    }
+
+    PointGraphShortestPaths::ShortestPathTree PointGraphShortestPaths::dijkstra(const unsigned int source) const
+    {
+        const unsigned int num_vertices = m_csr->numVertices();
+        ShortestPathTree tree{.costs        = std::vector<float>(num_vertices, std::numeric_limits<float>::infinity()),
+                              .lengths      = std::vector<float>(num_vertices, std::numeric_limits<float>::infinity()),
+                              .predecessors = std::vector<int>(num_vertices, -1)};
+
+        using QueueEntry = std::pair<float, unsigned int>;
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<>> open;
+        tree.costs[source]   = 0.0f;
+        tree.lengths[source] = 0.0f;
+        open.emplace(0.0f, source);
+        while(!open.empty())
+        {
+            const auto [cost, current] = open.top();
+            open.pop();
+            if(cost > tree.costs[current])
+            {
+                continue;
+            }
+
+            const PointGraphConfiguration& current_configuration = *m_csr->vertex(current)->payload();
+            for(unsigned int entry = m_csr->begin(current), end = m_csr->end(current); entry < end; ++entry)
+            {
+                const unsigned int successor = m_csr->neighbor(entry);
+                const float successor_cost   = cost + m_csr->cost(entry);
+                if(successor_cost < tree.costs[successor])
+                {
+                    tree.costs[successor]        = successor_cost;
+                    tree.predecessors[successor] = current;
+                    tree.lengths[successor] =
+                        tree.lengths[current] +
+                        current_configuration.euclideanDistance(*m_csr->vertex(successor)->payload());
+                    open.emplace(successor_cost, successor);
+                }
+            }
+        }
+        return tree;
+    }
+
+    std::optional<std::pair<const PointGraphShortestPaths::ShortestPathTree*, unsigned int>>
+    PointGraphShortestPaths::findTree(const unsigned int a, const unsigned int b) const
+    {
+        if(!contains(a, b))
+        {
+            return std::nullopt;
+        }
+        if(auto iter = m_source_indices.find(a); iter != m_source_indices.end())
+        {
+            return std::pair(&m_trees[iter->second], m_csr->index(b));
+        }
+        // The graph is undirected so the path from a to b is the reverse of the path from b to a
+        return std::pair(&m_trees[m_source_indices.at(b)], m_csr->index(a));
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -22,6 +22,12 @@
  */
 #include "grstapse/geometric_planning/graph/point/sampled_point_graph_environment.hpp"
 
+// Global
+#include <algorithm>
+#include <cmath>
+#include <limits>
+// External
+#include <robin_hood/robin_hood.hpp>
 // Local
 #include "grstapse/common/utilities/constants.hpp"
 #include "grstapse/geometric_planning/graph/point/point_graph_environment.hpp"
@@ -30,12 +36,43 @@ namespace grstapse
 {
     SampledPointGraphEnvironment::SampledPointGraphEnvironment()
         : GraphEnvironment(GraphType::e_sampled_point)
+        , m_topology(std::make_shared<PointGraphEnvironment>())
+        , m_num_samples(0)
     {}
 
     const std::shared_ptr<PointGraphEnvironment>& SampledPointGraphEnvironment::graph(unsigned int index) const
     {
-        assert(index < m_graphs.size());
-        return m_graphs[index];
+        assert(index < m_num_samples);
+        std::lock_guard lock(m_graphs_mutex);
+        std::shared_ptr<PointGraphEnvironment>& graph = m_graphs[index];
+        if(graph != nullptr)
+        {
+            return graph;
+        }
+
+        // The vertices get their own edge lists, but share the configurations with the topology
+        graph = std::make_shared<PointGraphEnvironment>();
+        for(const auto& [id, vertex]: m_topology->vertices())
+        {
+            graph->addVertex(id, vertex->payload());
+        }
+        const UndirectedGraphCsr<PointGraphConfiguration>& csr = *m_topology->csr();
+        std::vector<bool> added(csr.numEdges(), false);
+        for(unsigned int i = 0, num_vertices = csr.numVertices(); i < num_vertices; ++i)
+        {
+            for(unsigned int entry = csr.begin(i), end = csr.end(i); entry < end; ++entry)
+            {
+                const unsigned int edge_index = csr.edgeIndex(entry);
+                const float cost              = edgeCost(edge_index, index);
+                if(!added[edge_index] && !std::isinf(cost))
+                {
+                    added[edge_index] = true;
+                    graph->addEdge(csr.vertex(i)->id(), csr.vertex(csr.neighbor(entry))->id(), cost);
+                }
+            }
+        }
+        graph->freeze();
+        return graph;
     }
 
     float SampledPointGraphEnvironment::longestPath() const
@@ -46,23 +83,68 @@ namespace grstapse
 
     void from_json(const nlohmann::json& j, SampledPointGraphEnvironment& environment)
     {
-        auto pge_base = std::make_shared<PointGraphEnvironment>();
+        auto topology = std::make_shared<PointGraphEnvironment>();
         for(const nlohmann::json& vertex_j: j[constants::k_vertices])
         {
-            pge_base->addVertex(vertex_j[constants::k_id],
+            topology->addVertex(vertex_j[constants::k_id],
                                 std::make_shared<PointGraphConfiguration>(vertex_j[constants::k_id],
                                                                           vertex_j[constants::k_x],
                                                                           vertex_j[constants::k_y]));
         }
 
+        // Edges are keyed by (smaller id, larger id) as the same edge can be listed in either direction
+        using EdgeKey = std::pair<unsigned int, unsigned int>;
+        auto edge_key = [](unsigned int a, unsigned int b) -> EdgeKey
+        {
+            return std::pair(std::min(a, b), std::max(a, b));
+        };
+
+        // The topology is the union of the edges of the samples (with the cheapest cost of each edge)
+        std::vector<robin_hood::unordered_map<EdgeKey, float>> sample_costs;
+        robin_hood::unordered_map<EdgeKey, float> min_costs;
         for(const nlohmann::json& edges_j: j[constants::k_edges])
         {
-            auto pge = pge_base->shallowCopy();
+            robin_hood::unordered_map<EdgeKey, float>& costs = sample_costs.emplace_back();
             for(const nlohmann::json& edge_j: edges_j)
             {
-                pge->addEdge(edge_j[constants::k_vertex_a], edge_j[constants::k_vertex_b], edge_j[constants::k_cost]);
+                const EdgeKey key = edge_key(edge_j[constants::k_vertex_a], edge_j[constants::k_vertex_b]);
+                const float cost  = edge_j[constants::k_cost];
+                costs[key]        = cost;
+                if(auto iter = min_costs.find(key); iter == min_costs.end() || cost < iter->second)
+                {
+                    min_costs[key] = cost;
+                }
             }
-            environment.addGraph(pge);
         }
+        for(const auto& [key, cost]: min_costs)
+        {
+            topology->addEdge(key.first, key.second, cost);
+        }
+        topology->freeze();
+
+        // Fill in the cost of each edge in each sample
+        const UndirectedGraphCsr<PointGraphConfiguration>& csr = *topology->csr();
+        const unsigned int num_samples                         = sample_costs.size();
+        environment.m_edge_costs.assign(static_cast<std::size_t>(csr.numEdges()) * num_samples,
+                                        std::numeric_limits<float>::infinity());
+        for(unsigned int i = 0, num_vertices = csr.numVertices(); i < num_vertices; ++i)
+        {
+            for(unsigned int entry = csr.begin(i), end = csr.end(i); entry < end; ++entry)
+            {
+                const EdgeKey key = edge_key(csr.vertex(i)->id(), csr.vertex(csr.neighbor(entry))->id());
+                float* costs      = environment.m_edge_costs.data() + csr.edgeIndex(entry) * num_samples;
+                for(unsigned int sample = 0; sample < num_samples; ++sample)
+                {
+                    if(auto iter = sample_costs[sample].find(key); iter != sample_costs[sample].end())
+                    {
+                        costs[sample] = iter->second;
+                    }
+                }
+            }
+        }
+
+        environment.m_topology    = topology;
+        environment.m_num_samples = num_samples;
+        environment.m_graphs.assign(num_samples, nullptr);
     }
 }  // namespace grstapse
\ No newline at end of file
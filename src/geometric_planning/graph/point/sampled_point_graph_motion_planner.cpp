@@ -22,9 +22,15 @@
  */
 #include "grstapse/geometric_planning/graph/point/sampled_point_graph_motion_planner.hpp"
 
+// Global
+#include <algorithm>
 // Local
-#include "grstapse/geometric_planning/graph/point/point_graph_motion_planner.hpp"
+#include "grstapse/common/utilities/parallel_for.hpp"
+#include "grstapse/geometric_planning/graph/point/point_graph_configuration.hpp"
+#include "grstapse/geometric_planning/graph/point/point_graph_environment.hpp"
+#include "grstapse/geometric_planning/graph/point/point_graph_motion_planning_query_result.hpp"
 #include "grstapse/geometric_planning/graph/point/sampled_point_graph_environment.hpp"
+#include "grstapse/geometric_planning/graph/point/sampled_point_graph_shortest_paths.hpp"
 
 namespace grstapse
 {
@@ -32,14 +38,8 @@ namespace grstapse
         const std::shared_ptr<const MotionPlannerParametersBase>& parameters,
         const std::shared_ptr<SampledPointGraphEnvironment>& environment)
         : GraphMotionPlannerBase(parameters, environment)
-    {
-        m_sub_motion_planners.reserve(environment->numGraphs());
-        for(unsigned int i = 0, end = environment->numGraphs(); i < end; ++i)
-        {
-            m_sub_motion_planners.push_back(
-                std::make_shared<PointGraphMotionPlanner>(parameters, environment->graph(i)));
-        }
-    }
+        , m_sampled_environment(environment)
+    {}
 
     std::shared_ptr<const MotionPlanningQueryResultBase> SampledPointGraphMotionPlanner::query(
         unsigned int index,
@@ -47,8 +47,21 @@ namespace grstapse
         const std::shared_ptr<const PointGraphConfiguration>& initial_configuration,
         const std::shared_ptr<const PointGraphConfiguration>& goal_configuration)
     {
-        assert(index < std::dynamic_pointer_cast<SampledPointGraphEnvironment>(m_environment)->numGraphs());
-        return m_sub_motion_planners[index]->query(species, initial_configuration, goal_configuration);
+        assert(index < m_sampled_environment->numGraphs());
+        const auto [tree, reversed] = findOrComputeTree(initial_configuration->id(), goal_configuration->id());
+        std::vector<std::shared_ptr<PointGraphConfiguration>> path =
+            tree->path(reversed ? initial_configuration->id() : goal_configuration->id(), index);
+        if(path.empty())
+        {
+            return std::make_shared<PointGraphMotionPlanningQueryResult>(MotionPlannerQueryStatus::e_timeout);
+        }
+
+        // The graph is undirected so the path from a to b is the reverse of the path from b to a
+        if(reversed)
+        {
+            std::reverse(path.begin(), path.end());
+        }
+        return std::make_shared<PointGraphMotionPlanningQueryResult>(MotionPlannerQueryStatus::e_success, path);
     }
 
     bool SampledPointGraphMotionPlanner::isMemoized(
@@ -57,8 +70,9 @@ namespace grstapse
         const std::shared_ptr<const PointGraphConfiguration>& initial_configuration,
         const std::shared_ptr<const PointGraphConfiguration>& goal_configuration) const
     {
-        assert(index < std::dynamic_pointer_cast<SampledPointGraphEnvironment>(m_environment)->numGraphs());
-        return m_sub_motion_planners[index]->isMemoized(species, initial_configuration, goal_configuration);
+        assert(index < m_sampled_environment->numGraphs());
+        std::lock_guard lock(m_trees_mutex);
+        return m_trees.contains(initial_configuration->id()) || m_trees.contains(goal_configuration->id());
     }
 
     float SampledPointGraphMotionPlanner::durationQuery(
@@ -67,8 +81,58 @@ namespace grstapse
         const std::shared_ptr<const PointGraphConfiguration>& initial_configuration,
         const std::shared_ptr<const PointGraphConfiguration>& goal_configuration)
     {
-        assert(index < std::dynamic_pointer_cast<SampledPointGraphEnvironment>(m_environment)->numGraphs());
-        return m_sub_motion_planners[index]->durationQuery(species, initial_configuration, goal_configuration);
+        assert(index < m_sampled_environment->numGraphs());
+        const auto [tree, reversed] = findOrComputeTree(initial_configuration->id(), goal_configuration->id());
+        const std::optional<float> length =
+            tree->pathLength(reversed ? initial_configuration->id() : goal_configuration->id(), index);
+        if(!length.has_value())
+        {
+            return -1.0f;
+        }
+        return *length / species->speed();
+    }
+
+    std::pair<std::shared_ptr<const SampledPointGraphShortestPaths>, bool>
+    SampledPointGraphMotionPlanner::shortestPathTree(
+        const std::shared_ptr<const PointGraphConfiguration>& initial_configuration,
+        const std::shared_ptr<const PointGraphConfiguration>& goal_configuration)
+    {
+        return findOrComputeTree(initial_configuration->id(), goal_configuration->id());
+    }
+
+    void SampledPointGraphMotionPlanner::precompute(
+        const std::vector<std::shared_ptr<const ConfigurationBase>>& configurations)
+    {
+        std::vector<unsigned int> source_ids;
+        {
+            std::lock_guard lock(m_trees_mutex);
+            for(const std::shared_ptr<const ConfigurationBase>& configuration: configurations)
+            {
+                // Skip configurations from other environments and ones that already have a tree
+                if(auto pgc = std::dynamic_pointer_cast<const PointGraphConfiguration>(configuration);
+                   pgc != nullptr && m_sampled_environment->topology()->vertices().contains(pgc->id()) &&
+                   !m_trees.contains(pgc->id()) &&
+                   std::find(source_ids.begin(), source_ids.end(), pgc->id()) == source_ids.end())
+                {
+                    source_ids.push_back(pgc->id());
+                }
+            }
+        }
+
+        std::vector<std::shared_ptr<const SampledPointGraphShortestPaths>> trees(source_ids.size());
+        parallelFor(
+            0,
+            source_ids.size(),
+            [this, &source_ids, &trees](const unsigned int i)
+            {
+                trees[i] = std::make_shared<const SampledPointGraphShortestPaths>(m_sampled_environment, source_ids[i]);
+            });
+
+        std::lock_guard lock(m_trees_mutex);
+        for(const std::shared_ptr<const SampledPointGraphShortestPaths>& tree: trees)
+        {
+            m_trees.emplace(tree->sourceId(), tree);
+        }
     }
 
     std::shared_ptr<const MotionPlanningQueryResultBase> SampledPointGraphMotionPlanner::computeMotionPlan(
@@ -80,4 +144,26 @@ namespace grstapse
         throw std::logic_error("Not implemented");
     }
 
+    std::pair<std::shared_ptr<const SampledPointGraphShortestPaths>, bool>
+    SampledPointGraphMotionPlanner::findOrComputeTree(const unsigned int a, const unsigned int b)
+    {
+        {
+            std::lock_guard lock(m_trees_mutex);
+            if(auto iter = m_trees.find(a); iter != m_trees.end())
+            {
+                return {iter->second, false};
+            }
+            if(auto iter = m_trees.find(b); iter != m_trees.end())
+            {
+                return {iter->second, true};
+            }
+        }
+
+        // Computed without holding the lock so that queries from other sources are not blocked (a concurrent query
+        // from the same source may compute a duplicate tree, only one of which is kept)
+        auto tree = std::make_shared<const SampledPointGraphShortestPaths>(m_sampled_environment, a);
+        std::lock_guard lock(m_trees_mutex);
+        return {m_trees.emplace(a, tree).first->second, false};
+    }
+
 }  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,181 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/geometric_planning/graph/point/sampled_point_graph_shortest_paths.hpp"
+
+// Global
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <tuple>
+// Local
+#include "grstapse/geometric_planning/graph/point/point_graph_environment.hpp"
+#include "grstapse/geometric_planning/graph/point/sampled_point_graph_environment.hpp"
+
+namespace grstapse
+{
+    namespace
+    {
+        //! \returns The bits of \p a where \p mask is set and the bits of \p b elsewhere
+        inline float blend(const std::int32_t mask, const float a, const float b)
+        {
+            return std::bit_cast<float>((std::bit_cast<std::int32_t>(a) & mask) |
+                                        (std::bit_cast<std::int32_t>(b) & ~mask));
+        }
+
+        /**!
+         * Relaxes the edge from the vertex with dense index \p current to a successor for every sample
+         *
+         * The samples are selected with integer masks rather than with branches or ?: because gcc keeps a float ?:
+         * whose arm does arithmetic as control flow (under -ftrapping-math), which stops it vectorizing the loop. The
+         * costs are non-negative, so they order the same as their bit patterns and the key is an integer min.
+         *
+         * \returns The cheapest cost of the successor over all the samples if the edge improved any of them
+         */
+        std::optional<float> relaxSamples(const float* __restrict current_costs,
+                                          const float* __restrict current_lengths,
+                                          const float* __restrict edge_costs,
+                                          const float distance,
+                                          const int current,
+                                          float* __restrict successor_costs,
+                                          float* __restrict successor_lengths,
+                                          int* __restrict successor_predecessors,
+                                          const unsigned int num_samples)
+        {
+            std::int32_t improved = 0;
+            std::int32_t key      = std::bit_cast<std::int32_t>(std::numeric_limits<float>::infinity());
+            for(unsigned int sample = 0; sample < num_samples; ++sample)
+            {
+                const float cost        = current_costs[sample] + edge_costs[sample];
+                const float length      = current_lengths[sample] + distance;
+                const std::int32_t mask = -static_cast<std::int32_t>(cost < successor_costs[sample]);
+                successor_lengths[sample]      = blend(mask, length, successor_lengths[sample]);
+                successor_predecessors[sample] = (current & mask) | (successor_predecessors[sample] & ~mask);
+                successor_costs[sample]        = std::min(cost, successor_costs[sample]);
+                improved |= mask;
+                key = std::min(key, std::bit_cast<std::int32_t>(successor_costs[sample]));
+            }
+            if(improved == 0)
+            {
+                return std::nullopt;
+            }
+            return std::bit_cast<float>(key);
+        }
+    }  // namespace
+
+    SampledPointGraphShortestPaths::SampledPointGraphShortestPaths(
+        const std::shared_ptr<const SampledPointGraphEnvironment>& environment,
+        const unsigned int source_id)
+        : m_csr(environment->topology()->csr())
+        , m_source_id(source_id)
+        , m_num_samples(environment->numGraphs())
+    {
+        const unsigned int num_vertices = m_csr->numVertices();
+        const unsigned int num_samples  = m_num_samples;
+        const std::size_t num_labels    = static_cast<std::size_t>(num_vertices) * num_samples;
+        m_costs.assign(num_labels, std::numeric_limits<float>::infinity());
+        m_lengths.assign(num_labels, std::numeric_limits<float>::infinity());
+        m_predecessors.assign(num_labels, -1);
+
+        const unsigned int source = m_csr->index(source_id);
+        std::fill_n(m_costs.begin() + source * num_samples, num_samples, 0.0f);
+        std::fill_n(m_lengths.begin() + source * num_samples, num_samples, 0.0f);
+
+        // Queue entries are (cheapest sample cost, vertex index, version); an entry is stale once the vertex has been
+        // improved again (or expanded) after it was pushed
+        using QueueEntry = std::tuple<float, unsigned int, unsigned int>;
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<>> open;
+        std::vector<unsigned int> versions(num_vertices, 0);
+        open.emplace(0.0f, source, 0);
+        while(!open.empty())
+        {
+            const auto [key, current, version] = open.top();
+            open.pop();
+            if(version != versions[current])
+            {
+                continue;
+            }
+            ++versions[current];
+
+            const float* current_costs   = m_costs.data() + current * num_samples;
+            const float* current_lengths = m_lengths.data() + current * num_samples;
+            const PointGraphConfiguration& current_configuration = *m_csr->vertex(current)->payload();
+            for(unsigned int entry = m_csr->begin(current), end = m_csr->end(current); entry < end; ++entry)
+            {
+                const unsigned int successor = m_csr->neighbor(entry);
+                const float distance = current_configuration.euclideanDistance(*m_csr->vertex(successor)->payload());
+                const float* edge_costs = environment->edgeCosts(m_csr->edgeIndex(entry));
+                assert(successor != current);
+                if(const std::optional<float> new_key = relaxSamples(current_costs,
+                                                                     current_lengths,
+                                                                     edge_costs,
+                                                                     distance,
+                                                                     static_cast<int>(current),
+                                                                     m_costs.data() + successor * num_samples,
+                                                                     m_lengths.data() + successor * num_samples,
+                                                                     m_predecessors.data() + successor * num_samples,
+                                                                     num_samples))
+                {
+                    open.emplace(*new_key, successor, ++versions[successor]);
+                }
+            }
+        }
+    }
+
+    std::optional<float> SampledPointGraphShortestPaths::pathLength(const unsigned int id,
+                                                                    const unsigned int sample) const
+    {
+        assert(sample < m_num_samples);
+        const std::size_t label = static_cast<std::size_t>(m_csr->index(id)) * m_num_samples + sample;
+        if(std::isinf(m_costs[label]))
+        {
+            return std::nullopt;
+        }
+        return m_lengths[label];
+    }
+
+    std::vector<std::shared_ptr<PointGraphConfiguration>> SampledPointGraphShortestPaths::path(
+        const unsigned int id,
+        const unsigned int sample) const
+    {
+        assert(sample < m_num_samples);
+        const int target = m_csr->index(id);
+        if(std::isinf(m_costs[static_cast<std::size_t>(target) * m_num_samples + sample]))
+        {
+            return {};
+        }
+
+        // Walk from the target to the source
+        std::vector<std::shared_ptr<PointGraphConfiguration>> rv;
+        for(int index = target; index != -1;)
+        {
+            rv.push_back(m_csr->vertex(index)->payload());
+            index = m_predecessors[static_cast<std::size_t>(index) * m_num_samples + sample];
+        }
+        std::reverse(rv.begin(), rv.end());
+        return rv;
+    }
+}  // namespace grstapse
\ No newline at end of file
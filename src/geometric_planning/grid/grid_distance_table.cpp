@@ -0,0 +1,85 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/geometric_planning/grid/grid_distance_table.hpp"
+
+// Global
+#include <array>
+
+// Local
+#include "grstapse/geometric_planning/grid/grid_cell.hpp"
+#include "grstapse/geometric_planning/grid/grid_map.hpp"
+
+namespace grstapse
+{
+    namespace
+    {
+        //! North, South, East, and West
+        constexpr std::array<std::array<int, 2>, 4> k_moves = {{{0, 1}, {0, -1}, {1, 0}, {-1, 0}}};
+    }  // namespace
+
+    GridDistanceTable::GridDistanceTable(const GridMap& map, const GridCell& goal)
+        : m_width(map.width())
+        , m_distances(map.width() * map.height(), k_unreachable)
+    {
+        assert(goal.x() < map.width() && goal.y() < map.height());
+        if(map.isObstacle(goal))
+        {
+            return;
+        }
+
+        // Moves are reversible so a forward search from the goal gives the distances to it
+        std::vector<unsigned int> frontier;
+        frontier.reserve(m_distances.size());
+        const unsigned int start = goal.y() * m_width + goal.x();
+        m_distances[start]       = 0;
+        frontier.push_back(start);
+        for(std::size_t i = 0; i < frontier.size(); ++i)
+        {
+            const unsigned int cell     = frontier[i];
+            const unsigned int x        = cell % m_width;
+            const unsigned int y        = cell / m_width;
+            const unsigned int distance = m_distances[cell] + 1;
+            for(const auto& [dx, dy]: k_moves)
+            {
+                const int nx = static_cast<int>(x) + dx;
+                const int ny = static_cast<int>(y) + dy;
+                if(nx < 0 || ny < 0 || nx >= static_cast<int>(map.width()) || ny >= static_cast<int>(map.height()) ||
+                   map.isObstacle(nx, ny))
+                {
+                    continue;
+                }
+                const unsigned int next = ny * m_width + nx;
+                if(m_distances[next] == k_unreachable)
+                {
+                    m_distances[next] = distance;
+                    frontier.push_back(next);
+                }
+            }
+        }
+    }
+
+    unsigned int GridDistanceTable::distance(const GridCell& cell) const
+    {
+        return distance(cell.x(), cell.y());
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,236 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/geometric_planning/grid/grid_jump_point_search.hpp"
+
+// Global
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <tuple>
+
+// External
+#include <robin_hood/robin_hood.hpp>
+
+// Local
+#include "grstapse/geometric_planning/grid/grid_map.hpp"
+
+namespace grstapse
+{
+    namespace
+    {
+        //! Best known cost and predecessor of a jump point
+        struct JumpPoint
+        {
+            unsigned int g;
+            int parent_x;
+            int parent_y;
+        };
+
+        //! \returns -1, 0, or 1 depending on the sign of \p value
+        int sign(int value)
+        {
+            return (value > 0) - (value < 0);
+        }
+    }  // namespace
+
+    GridJumpPointSearch::GridJumpPointSearch(const std::shared_ptr<const GridMap>& map)
+        : m_map(map)
+    {}
+
+    std::vector<GridCell> GridJumpPointSearch::search(const GridCell& initial, const GridCell& goal) const
+    {
+        if(isBlocked(initial.x(), initial.y()) || isBlocked(goal.x(), goal.y()))
+        {
+            return {};
+        }
+
+        const unsigned int width = m_map->width();
+        auto key                 = [width](int x, int y) -> std::uint64_t
+        {
+            return static_cast<std::uint64_t>(y) * width + x;
+        };
+        auto heuristic = [&goal](int x, int y) -> unsigned int
+        {
+            return std::abs(x - static_cast<int>(goal.x())) + std::abs(y - static_cast<int>(goal.y()));
+        };
+
+        // Open list entries are (f, h, x, y); ties are broken towards the goal
+        using OpenEntry = std::tuple<unsigned int, unsigned int, int, int>;
+        std::priority_queue<OpenEntry, std::vector<OpenEntry>, std::greater<>> open;
+        robin_hood::unordered_map<std::uint64_t, JumpPoint> jump_points;
+
+        auto push = [&](int x, int y, unsigned int g, int parent_x, int parent_y)
+        {
+            auto [iter, inserted] = jump_points.try_emplace(key(x, y), JumpPoint{g, parent_x, parent_y});
+            if(!inserted)
+            {
+                if(iter->second.g <= g)
+                {
+                    return;
+                }
+                iter->second = JumpPoint{g, parent_x, parent_y};
+            }
+            const unsigned int h = heuristic(x, y);
+            open.emplace(g + h, h, x, y);
+        };
+
+        push(initial.x(), initial.y(), 0, -1, -1);
+        while(!open.empty())
+        {
+            const auto [f, h, x, y] = open.top();
+            open.pop();
+            const JumpPoint current = jump_points.at(key(x, y));
+            if(f - h > current.g)
+            {
+                continue;
+            }
+
+            if(x == static_cast<int>(goal.x()) && y == static_cast<int>(goal.y()))
+            {
+                // Walk back through the jump points, filling in the straight segments between them
+                std::vector<GridCell> rv;
+                int cx = x;
+                int cy = y;
+                for(JumpPoint jp = current; jp.parent_x >= 0; jp = jump_points.at(key(jp.parent_x, jp.parent_y)))
+                {
+                    const int dx = sign(jp.parent_x - cx);
+                    const int dy = sign(jp.parent_y - cy);
+                    for(; cx != jp.parent_x || cy != jp.parent_y; cx += dx, cy += dy)
+                    {
+                        rv.emplace_back(cx, cy);
+                    }
+                }
+                rv.push_back(initial);
+                std::reverse(rv.begin(), rv.end());
+                return rv;
+            }
+
+            // Prune the successors based on the direction the jump point was reached from
+            const bool start = current.parent_x < 0;
+            const int dx     = start ? 0 : sign(x - current.parent_x);
+            const int dy     = start ? 0 : sign(y - current.parent_y);
+
+            // Horizontal moves: natural when starting or moving vertically, otherwise only straight ahead
+            for(const int direction: {1, -1})
+            {
+                if(start || dy != 0 || direction == dx)
+                {
+                    if(std::optional<int> jx = jumpHorizontal(x, y, direction, goal); jx.has_value())
+                    {
+                        push(*jx, y, current.g + std::abs(*jx - x), x, y);
+                    }
+                }
+            }
+
+            // Vertical moves: natural when starting or moving vertically, otherwise only when forced
+            for(const int direction: {1, -1})
+            {
+                const bool natural = start || direction == dy;
+                const bool forced  = dx != 0 && !isBlocked(x, y + direction) && isBlocked(x - dx, y + direction);
+                if(natural || forced)
+                {
+                    if(std::optional<int> jy = jumpVertical(x, y, direction, goal); jy.has_value())
+                    {
+                        push(x, *jy, current.g + std::abs(*jy - y), x, y);
+                    }
+                }
+            }
+        }
+        return {};
+    }
+
+    bool GridJumpPointSearch::isBlocked(int x, int y) const
+    {
+        return x < 0 || y < 0 || x >= static_cast<int>(m_map->width()) || y >= static_cast<int>(m_map->height()) ||
+               m_map->isObstacle(x, y);
+    }
+
+    std::optional<int> GridJumpPointSearch::jumpHorizontal(int x, int y, int dx, const GridCell& goal) const
+    {
+        constexpr unsigned int k_bits = GridMap::k_word_size;
+        const std::uint64_t all       = ~std::uint64_t(0);
+        const int start               = x + dx;
+        if(start < 0 || start >= static_cast<int>(m_map->width()))
+        {
+            return std::nullopt;
+        }
+
+        // Stop at the first obstacle (failure), forced neighbor, or the goal. A cell has a forced neighbor above it if
+        // the cell above it is free while the cell above the previous cell (in the direction of travel) is blocked.
+        int k              = start / k_bits;
+        std::uint64_t mask = dx > 0 ? all << (start % k_bits) : all >> (k_bits - 1 - start % k_bits);
+        while(k >= 0 && k < static_cast<int>(m_map->wordsPerRow()))
+        {
+            const std::uint64_t obstacles = m_map->word(k, y);
+            const std::uint64_t above     = m_map->word(k, y + 1);
+            const std::uint64_t below     = m_map->word(k, y - 1);
+            std::uint64_t previous_above;
+            std::uint64_t previous_below;
+            if(dx > 0)
+            {
+                previous_above = (above << 1) | (m_map->word(k - 1, y + 1) >> (k_bits - 1));
+                previous_below = (below << 1) | (m_map->word(k - 1, y - 1) >> (k_bits - 1));
+            }
+            else
+            {
+                previous_above = (above >> 1) | (m_map->word(k + 1, y + 1) << (k_bits - 1));
+                previous_below = (below >> 1) | (m_map->word(k + 1, y - 1) << (k_bits - 1));
+            }
+            const std::uint64_t forced = (~above & previous_above) | (~below & previous_below);
+            const std::uint64_t goal_bit =
+                static_cast<int>(goal.y()) == y && static_cast<int>(goal.x() / k_bits) == k
+                    ? std::uint64_t(1) << (goal.x() % k_bits)
+                    : 0;
+
+            if(const std::uint64_t events = (obstacles | forced | goal_bit) & mask; events != 0)
+            {
+                const unsigned int bit =
+                    dx > 0 ? std::countr_zero(events) : k_bits - 1 - std::countl_zero(events);
+                if((obstacles >> bit) & 1)
+                {
+                    return std::nullopt;
+                }
+                return k * k_bits + bit;
+            }
+            k += dx;
+            mask = all;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<int> GridJumpPointSearch::jumpVertical(int x, int y, int dy, const GridCell& goal) const
+    {
+        for(y += dy; !isBlocked(x, y); y += dy)
+        {
+            if((x == static_cast<int>(goal.x()) && y == static_cast<int>(goal.y())) ||
+               jumpHorizontal(x, y, 1, goal).has_value() || jumpHorizontal(x, y, -1, goal).has_value())
+            {
+                return y;
+            }
+        }
+        return std::nullopt;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -22,19 +22,72 @@
  */
 #include "grstapse/geometric_planning/grid/grid_map.hpp"
 
+// Global
+#include <algorithm>
+#include <bit>
+
 namespace grstapse
 {
     GridMap::GridMap(unsigned int width, unsigned int height, const robin_hood::unordered_set<GridCell>& obstacles)
+        : m_width(width)
+        , m_height(height)
+        , m_words_per_row((width + k_word_size - 1) / k_word_size)
+        , m_words(m_words_per_row * height, 0)
     {
-        m_map.resize(width);
-        for(std::vector<bool>& internal: m_map)
+        // Pad the end of each row with obstacles
+        if(const unsigned int used = width % k_word_size; used != 0)
         {
-            internal.resize(height, false);
+            const std::uint64_t padding = ~std::uint64_t(0) << used;
+            for(unsigned int y = 0; y < height; ++y)
+            {
+                m_words[y * m_words_per_row + m_words_per_row - 1] = padding;
+            }
         }
+
         for(const GridCell& cell: obstacles)
         {
             assert(cell.x() < width && cell.y() < height);
-            m_map[cell.x()][cell.y()] = true;
+            m_words[cell.y() * m_words_per_row + cell.x() / k_word_size] |= std::uint64_t(1)
+                                                                            << (cell.x() % k_word_size);
+        }
+    }
+
+    unsigned int GridMap::nextObstacle(unsigned int x, unsigned int y) const
+    {
+        assert(y < m_height);
+        if(x >= m_width)
+        {
+            return m_width;
+        }
+
+        int k              = x / k_word_size;
+        std::uint64_t bits = word(k, y) & (~std::uint64_t(0) << (x % k_word_size));
+        while(bits == 0)
+        {
+            bits = word(++k, y);
+        }
+        // Padding bits are obstacles, so the first one past the grid is the width
+        return std::min(k * k_word_size + std::countr_zero(bits), m_width);
+    }
+
+    int GridMap::previousObstacle(unsigned int x, unsigned int y) const
+    {
+        assert(y < m_height);
+        if(x >= m_width)
+        {
+            x = m_width - 1;
+        }
+
+        int k              = x / k_word_size;
+        std::uint64_t bits = word(k, y) & (~std::uint64_t(0) >> (k_word_size - 1 - x % k_word_size));
+        while(bits == 0)
+        {
+            if(--k < 0)
+            {
+                return -1;
+            }
+            bits = word(k, y);
         }
+        return k * k_word_size + (k_word_size - 1 - std::countl_zero(bits));
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -27,19 +27,4 @@ namespace grstapse
     ConflictBase::ConflictBase(const std::array<unsigned int, 2>& agents)
         : m_agents(agents)
     {}
-
-    const std::array<unsigned int, 2>& ConflictBase::agents() const
-    {
-        return m_agents;
-    }
-
-    unsigned int ConflictBase::agent1() const
-    {
-        return m_agents[0];
-    }
-
-    unsigned int ConflictBase::agent2() const
-    {
-        return m_agents[1];
-    }
 }  // namespace grstapse
\ No newline at end of file
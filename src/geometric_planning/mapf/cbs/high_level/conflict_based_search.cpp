@@ -22,21 +22,41 @@
  */
 #include "grstapse/geometric_planning/mapf/cbs/conflict_based_search.hpp"
 
+// Global
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+// External
+#include <fmt/format.h>
 // Local
+#include "grstapse/common/utilities/error.hpp"
+#include "grstapse/common/utilities/parallel_for.hpp"
 #include "grstapse/common/utilities/time_keeper.hpp"
+#include "grstapse/geometric_planning/grid/grid_cell.hpp"
+#include "grstapse/geometric_planning/grid/grid_distance_table.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/conflict_based_search_parameters.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/high_level/conflict_base.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/high_level/constraint_tree_node.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/high_level/constraint_tree_node_root.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/high_level/edge_conflict.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/high_level/positive_edge_constraint.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/high_level/positive_vertex_constraint.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/high_level/vertex_conflict.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/high_level/vertex_constraint.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/constraint_table.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/multi_valued_decision_diagram.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/low_level/space_time_a_star_with_constraints.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/space_time_a_star_with_constraints_parameters.hpp"
+#include "grstapse/geometric_planning/mapf/ecbs/conflict_avoidance_table.hpp"
+#include "grstapse/geometric_planning/mapf/ecbs/space_time_focal_search_with_constraints.hpp"
+#include "grstapse/geometric_planning/mapf/grid_path.hpp"
 
 namespace grstapse
 {
     ConflictBaseSearch::ConflictBaseSearch(const std::shared_ptr<const ConflictBasedSearchParameters>& parameters)
         : Base(parameters)
+        , m_focal_lower_bound(0)
     {}
 
     std::shared_ptr<ConstraintTreeNodeBase> ConflictBaseSearch::createRootNode()
@@ -51,18 +71,26 @@ namespace grstapse
     {
         auto cbs_parameters           = std::dynamic_pointer_cast<const ConflictBasedSearchParameters>(m_parameters);
         const unsigned int num_robots = cbs_parameters->numberOfRobots();
+        const bool enhanced           = cbs_parameters->isEnhanced();
+        computeDistanceTables();
         if(!computeLowLevelSolution(root))
         {
             return SearchResults<ConstraintTreeNodeBase, ConflictBasedSearchStatistics>(nullptr, Base::m_statistics);
         }
+        root->detectConflicts();
         Base::m_statistics->incrementNumberOfHighLevelNodesGenerated();
         m_open.push(root->id(), root);
+        if(enhanced)
+        {
+            m_focal_lower_bound = root->lowerBound();
+            pushFocal(root);
+        }
 
         while(!m_open.empty())
         {
-            std::shared_ptr<ConstraintTreeNodeBase> base = m_open.pop();
+            std::shared_ptr<ConstraintTreeNodeBase> base = enhanced ? popFocal() : m_open.pop();
 
-            std::unique_ptr<const ConflictBase> conflict = base->getFirstConflict();
+            std::unique_ptr<const ConflictBase> conflict = selectConflict(*base);
             if(conflict == nullptr)
             {
                 return SearchResults<ConstraintTreeNodeBase, ConflictBasedSearchStatistics>(base, Base::m_statistics);
@@ -70,69 +98,454 @@ namespace grstapse
             base->setStatus(SearchNodeStatus::e_closed);
 
             robin_hood::unordered_map<unsigned int, std::shared_ptr<ConstraintBase>> constraints =
-                conflict->createConstraints();
+                cbs_parameters->disjoint_splitting ? conflict->createDisjointConstraints()
+                                                   : conflict->createConstraints();
+            std::vector<unsigned int> robots;
+            std::vector<std::vector<unsigned int>> violating_robots;
+            std::vector<std::shared_ptr<ConstraintTreeNode>> candidates;
+            robots.reserve(constraints.size());
+            violating_robots.reserve(constraints.size());
+            candidates.reserve(constraints.size());
             for(const auto& [robot, constraint]: constraints)
             {
                 auto child = std::make_shared<ConstraintTreeNode>(num_robots, cbs_parameters->cost_type, base);
                 child->setConstraint(robot, constraint);
                 Base::m_statistics->incrementNumberOfHighLevelNodesGenerated();
-                if(computeLowLevelSolution(child, robot))
+                robots.push_back(robot);
+                violating_robots.push_back(robotsViolatingPositiveConstraint(*base, *constraint, robot));
+                candidates.push_back(child);
+            }
+
+            // The children only read from base so their low level searches are independent
+            std::vector<char> found(candidates.size(), false);
+            parallelFor(
+                0,
+                candidates.size(),
+                [this, num_robots, &cbs_parameters, &robots, &violating_robots, &candidates, &found](
+                    const unsigned int i)
                 {
-                    m_open.push(child->id(), child);
-                    child->setStatus(SearchNodeStatus::e_open);
-                }
+                    if(!computeLowLevelSolution(candidates[i], robots[i]))
+                    {
+                        return;
+                    }
+                    candidates[i]->detectConflicts();
+
+                    // A positive constraint is a negative one for every other robot, so each robot whose path breaks
+                    // it is replanned as well (a node only holds the path of one robot, so each gets its own node)
+                    for(const unsigned int robot: violating_robots[i])
+                    {
+                        auto child =
+                            std::make_shared<ConstraintTreeNode>(num_robots, cbs_parameters->cost_type, candidates[i]);
+                        child->setConstraint(robot, nullptr);
+                        if(!computeLowLevelSolution(child, robot))
+                        {
+                            return;
+                        }
+                        child->detectConflicts();
+                        candidates[i] = child;
+                    }
+                    found[i] = true;
+                },
+                cbs_parameters->num_threads);
+
+            std::vector<std::shared_ptr<ConstraintTreeNodeBase>> children;
+            children.reserve(candidates.size());
+            for(unsigned int i = 0; i < candidates.size(); ++i)
+            {
                 Base::m_statistics->incrementNumberOfHighLevelNodesEvaluated();
+                if(!found[i])
+                {
+                    continue;
+                }
+
+                // Adopt the child's path without its constraint if it costs the same and has fewer conflicts
+                const std::shared_ptr<ConstraintTreeNode>& child = candidates[i];
+                const unsigned int robot                         = robots[i];
+                if(cbs_parameters->bypass && !enhanced && violating_robots[i].empty() &&
+                   child->lowLevelSolution(robot)->size() == base->lowLevelSolution(robot)->size() &&
+                   child->conflicts().size() < base->conflicts().size())
+                {
+                    children = {createBypassNode(base, child, robot)};
+                    break;
+                }
+                children.push_back(child);
+            }
+
+            for(const std::shared_ptr<ConstraintTreeNodeBase>& child: children)
+            {
+                m_open.push(child->id(), child);
+                child->setStatus(SearchNodeStatus::e_open);
+                if(enhanced)
+                {
+                    pushFocal(child);
+                }
+            }
+            if(enhanced && !m_open.empty())
+            {
+                updateFocal();
             }
         }
 
         return SearchResults<ConstraintTreeNodeBase, ConflictBasedSearchStatistics>(nullptr, Base::m_statistics);
     }
 
+    SearchResults<ConstraintTreeNodeBase, ConflictBasedSearchStatistics> ConflictBaseSearch::searchFromSolution(
+        const std::vector<std::shared_ptr<const GridPath>>& previous_solution,
+        const robin_hood::unordered_set<unsigned int>& changed_robots)
+    {
+        TimerRunner timer_runner(m_parameters->timer_name);
+        auto cbs_parameters           = std::dynamic_pointer_cast<const ConflictBasedSearchParameters>(m_parameters);
+        const unsigned int num_robots = cbs_parameters->numberOfRobots();
+        if(previous_solution.size() != num_robots)
+        {
+            throw createLogicError("The previous solution must contain a path for each robot");
+        }
+
+        m_root = createRootNode();
+        for(unsigned int robot = 0; robot < num_robots; ++robot)
+        {
+            if(changed_robots.contains(robot))
+            {
+                continue;
+            }
+
+            const std::shared_ptr<const GridPath>& path = previous_solution[robot];
+            const GridCell& initial_state               = *cbs_parameters->initialStates()[robot];
+            const GridCell& goal_state                  = *cbs_parameters->goalStates()[robot];
+            if(path == nullptr || path->size() == 0 ||
+               path->cell(0) != GridPath::pack(initial_state.x(), initial_state.y()) ||
+               path->back() != GridPath::pack(goal_state.x(), goal_state.y()))
+            {
+                throw createLogicError(
+                    fmt::format("The previous path of unchanged robot {0:d} does not connect its start and goal",
+                                robot));
+            }
+            m_root->setLowLevelSolution(robot, path);
+        }
+        return searchFromNode(m_root);
+    }
+
     bool ConflictBaseSearch::computeLowLevelSolution(const std::shared_ptr<ConstraintTreeNodeBase>& node)
     {
-        auto cbs_parameters = std::dynamic_pointer_cast<const ConflictBasedSearchParameters>(m_parameters);
-        for(unsigned int i = 0, num_robots = cbs_parameters->numberOfRobots(); i < num_robots; ++i)
+        auto cbs_parameters           = std::dynamic_pointer_cast<const ConflictBasedSearchParameters>(m_parameters);
+        const unsigned int num_robots = cbs_parameters->numberOfRobots();
+
+        // Robots seeded with a previous path (see searchFromSolution) keep it
+        auto plan = [this, &node, &cbs_parameters](const unsigned int robot) -> bool
         {
-            if(!computeLowLevelSolution(node, i))
+            if(node->lowLevelSolution(robot) == nullptr)
             {
-                return false;
+                return computeLowLevelSolution(node, robot);
+            }
+            if(cbs_parameters->prioritize_conflicts && !cbs_parameters->isEnhanced())
+            {
+                const ConstraintTable constraints(node->constraintList(robot).get(),
+                                                  node->positiveConstraintList().get(),
+                                                  robot);
+                node->setMultiValuedDecisionDiagram(
+                    robot,
+                    createMultiValuedDecisionDiagram(robot, node->lowLevelSolution(robot)->size(), constraints));
+            }
+            return true;
+        };
+
+        // Each robot avoids the paths of the robots planned before it in ECBS, so those searches stay sequential
+        if(cbs_parameters->isEnhanced())
+        {
+            for(unsigned int i = 0; i < num_robots; ++i)
+            {
+                if(!plan(i))
+                {
+                    return false;
+                }
             }
+            return true;
         }
-        return true;
+
+        // Each robot writes to its own slot of the root so the searches are independent
+        std::vector<char> found(num_robots, false);
+        parallelFor(
+            0,
+            num_robots,
+            [&plan, &found](const unsigned int i)
+            {
+                found[i] = plan(i);
+            },
+            cbs_parameters->num_threads);
+        return std::all_of(found.begin(),
+                           found.end(),
+                           [](const char f)
+                           {
+                               return f;
+                           });
     }
 
     bool ConflictBaseSearch::computeLowLevelSolution(const std::shared_ptr<ConstraintTreeNodeBase>& node,
                                                      unsigned int robot)
     {
         auto cbs_parameters = std::dynamic_pointer_cast<const ConflictBasedSearchParameters>(m_parameters);
-        std::shared_ptr<const SpaceTimeAStarParameters> low_level_parameters;
-        if(m_parameters->has_timeout)
-        {
-            low_level_parameters = std::make_shared<const SpaceTimeAStarParameters>(
-                cbs_parameters->low_level_timer_name,
-                true,
-                m_parameters->timeout - TimeKeeper::instance().time(m_parameters->timer_name));
-        }
-        else
+        const float timeout = m_parameters->has_timeout
+                                ? m_parameters->timeout - TimeKeeper::instance().time(m_parameters->timer_name)
+                                : std::numeric_limits<float>::max();
+        auto constraints    = std::make_shared<const ConstraintTable>(node->constraintList(robot).get(),
+                                                               node->positiveConstraintList().get(),
+                                                               robot);
+
+        if(cbs_parameters->isEnhanced())
         {
-            low_level_parameters =
-                std::make_shared<const SpaceTimeAStarParameters>(cbs_parameters->low_level_timer_name);
+            auto conflict_avoidance_table = std::make_shared<ConflictAvoidanceTable>();
+            for(unsigned int other = 0, num_robots = cbs_parameters->numberOfRobots(); other < num_robots; ++other)
+            {
+                // The robots after this one have not been planned yet at the root
+                if(other != robot && node->lowLevelSolution(other) != nullptr)
+                {
+                    conflict_avoidance_table->addPath(*node->lowLevelSolution(other));
+                }
+            }
+            SpaceTimeFocalSearchWithConstraints low_level(
+                std::make_shared<const FocalAStarParameters>(cbs_parameters->low_level_timer_name,
+                                                             cbs_parameters->suboptimality_weight,
+                                                             false,
+                                                             m_parameters->has_timeout,
+                                                             timeout),
+                cbs_parameters->map(),
+                cbs_parameters->initialStates()[robot],
+                cbs_parameters->goalStates()[robot],
+                constraints,
+                conflict_avoidance_table,
+                m_distance_tables[robot]);
+            SearchResults<TemporalGridCellNode, SearchStatisticsCommon> result = low_level.search();
+            addLowLevelStatistics(*result.statistics());
+            if(!result.foundGoal())
+            {
+                return false;
+            }
+            node->setLowLevelSolution(robot, result.goal());
+
+            // The minimum f in the open set bounds the goal time and constraints are only ever added to a robot
+            const unsigned int parent_lower_bound =
+                node->parent() != nullptr ? node->parent()->lowLevelLowerBound(robot) : 0;
+            const unsigned int lower_bound =
+                std::max(parent_lower_bound, static_cast<unsigned int>(std::ceil(low_level.lowerBound())) + 1);
+            node->setLowLevelLowerBound(
+                robot,
+                std::min(lower_bound, node->lowLevelSolution(robot)->size()));
+            return true;
         }
-        SpaceTimeAStarWithConstraints low_level(low_level_parameters,
-                                                cbs_parameters->map(),
-                                                cbs_parameters->initialStates()[robot],
-                                                cbs_parameters->goalStates()[robot],
-                                                node->constraints(robot));
+
+        SpaceTimeAStarWithConstraints low_level(
+            std::make_shared<const SpaceTimeAStarParameters>(cbs_parameters->low_level_timer_name,
+                                                             m_parameters->has_timeout,
+                                                             timeout),
+            cbs_parameters->map(),
+            cbs_parameters->initialStates()[robot],
+            cbs_parameters->goalStates()[robot],
+            constraints,
+            m_distance_tables[robot]);
         SearchResults<TemporalGridCellNode, SearchStatisticsCommon> result = low_level.search();
-        std::shared_ptr<SearchStatisticsCommon> low_level_statistics       = result.statistics();
-        Base::m_statistics->incrementNumberOfLowLevelNodesGenerated(low_level_statistics->numberOfNodesGenerated());
-        Base::m_statistics->incrementNumberOfLowLevelNodesEvaluated(low_level_statistics->numberOfNodesEvaluated());
-        Base::m_statistics->incrementNumberOfLowLevelNodesExpanded(low_level_statistics->numberOfNodesExpanded());
+        addLowLevelStatistics(*result.statistics());
         if(!result.foundGoal())
         {
             return false;
         }
         node->setLowLevelSolution(robot, result.goal());
+        if(cbs_parameters->prioritize_conflicts)
+        {
+            node->setMultiValuedDecisionDiagram(
+                robot,
+                createMultiValuedDecisionDiagram(robot, node->lowLevelSolution(robot)->size(), *constraints));
+        }
         return true;
     }
+
+    std::shared_ptr<const MultiValuedDecisionDiagram> ConflictBaseSearch::createMultiValuedDecisionDiagram(
+        unsigned int robot,
+        unsigned int duration,
+        const ConstraintTable& constraints) const
+    {
+        auto cbs_parameters = std::dynamic_pointer_cast<const ConflictBasedSearchParameters>(m_parameters);
+        return std::make_shared<const MultiValuedDecisionDiagram>(*cbs_parameters->map(),
+                                                                  *cbs_parameters->initialStates()[robot],
+                                                                  *cbs_parameters->goalStates()[robot],
+                                                                  duration,
+                                                                  constraints,
+                                                                  m_distance_tables[robot].get());
+    }
+
+    void ConflictBaseSearch::computeDistanceTables()
+    {
+        auto cbs_parameters           = std::dynamic_pointer_cast<const ConflictBasedSearchParameters>(m_parameters);
+        const unsigned int num_robots = cbs_parameters->numberOfRobots();
+        if(m_distance_tables.size() == num_robots)
+        {
+            return;
+        }
+
+        // The map is static so the tables are shared by every constraint tree node
+        m_distance_tables.resize(num_robots);
+        parallelFor(
+            0,
+            num_robots,
+            [this, &cbs_parameters](const unsigned int robot)
+            {
+                m_distance_tables[robot] =
+                    std::make_shared<const GridDistanceTable>(*cbs_parameters->map(),
+                                                              *cbs_parameters->goalStates()[robot]);
+            },
+            cbs_parameters->num_threads);
+    }
+
+    void ConflictBaseSearch::addLowLevelStatistics(const SearchStatisticsCommon& low_level_statistics)
+    {
+        std::lock_guard<std::mutex> lock(m_statistics_mutex);
+        Base::m_statistics->incrementNumberOfLowLevelNodesGenerated(low_level_statistics.numberOfNodesGenerated());
+        Base::m_statistics->incrementNumberOfLowLevelNodesEvaluated(low_level_statistics.numberOfNodesEvaluated());
+        Base::m_statistics->incrementNumberOfLowLevelNodesExpanded(low_level_statistics.numberOfNodesExpanded());
+    }
+
+    void ConflictBaseSearch::pushFocal(const std::shared_ptr<ConstraintTreeNodeBase>& node)
+    {
+        auto cbs_parameters = std::dynamic_pointer_cast<const ConflictBasedSearchParameters>(m_parameters);
+        if(static_cast<float>(node->cost()) <= cbs_parameters->suboptimality_weight * m_focal_lower_bound)
+        {
+            m_focal.emplace(node->conflicts().size(), node->cost(), node->id(), node);
+        }
+    }
+
+    std::shared_ptr<ConstraintTreeNodeBase> ConflictBaseSearch::popFocal()
+    {
+        // The open node with the lowest lower bound costs at most w times it whenever w >= 1
+        if(m_focal.empty())
+        {
+            std::shared_ptr<ConstraintTreeNodeBase> node = m_open.pop();
+            m_focal_lower_bound                          = node->lowerBound();
+            return node;
+        }
+        std::shared_ptr<ConstraintTreeNodeBase> node = std::get<3>(*m_focal.begin());
+        m_focal.erase(m_focal.begin());
+        m_open.erase(node->id());
+        return node;
+    }
+
+    void ConflictBaseSearch::updateFocal()
+    {
+        auto cbs_parameters = std::dynamic_pointer_cast<const ConflictBasedSearchParameters>(m_parameters);
+        const float w       = cbs_parameters->suboptimality_weight;
+
+        const unsigned int previous_bound = m_focal_lower_bound;
+        m_focal_lower_bound               = m_open.top()->lowerBound();
+        if(m_focal_lower_bound <= previous_bound)
+        {
+            return;
+        }
+
+        // The cost of a node is at least its lower bound so the ordered traversal stops at the first node out of reach
+        for(auto it = m_open.ordered_begin(), end = m_open.ordered_end(); it != end; ++it)
+        {
+            const std::shared_ptr<ConstraintTreeNodeBase> node = it->payload();
+            if(static_cast<float>(node->lowerBound()) > w * m_focal_lower_bound)
+            {
+                break;
+            }
+            const float cost = static_cast<float>(node->cost());
+            if(cost > w * previous_bound && cost <= w * m_focal_lower_bound)
+            {
+                m_focal.emplace(node->conflicts().size(), node->cost(), node->id(), node);
+            }
+        }
+    }
+
+    std::unique_ptr<const ConflictBase> ConflictBaseSearch::selectConflict(const ConstraintTreeNodeBase& node) const
+    {
+        auto cbs_parameters = std::dynamic_pointer_cast<const ConflictBasedSearchParameters>(m_parameters);
+        if(!cbs_parameters->prioritize_conflicts || cbs_parameters->isEnhanced())
+        {
+            return node.getFirstConflict();
+        }
+
+        // Cardinal before semi-cardinal before non-cardinal conflicts, then the earliest
+        const ConflictRecord* best           = nullptr;
+        ConflictCardinality best_cardinality = ConflictCardinality::e_non_cardinal;
+        for(const ConflictRecord& conflict: node.conflicts())
+        {
+            const ConflictCardinality cardinality =
+                conflict.cardinality(*node.multiValuedDecisionDiagram(conflict.agents[0]),
+                                     *node.multiValuedDecisionDiagram(conflict.agents[1]));
+            if(best == nullptr || cardinality < best_cardinality ||
+               (cardinality == best_cardinality && conflict < *best))
+            {
+                best             = &conflict;
+                best_cardinality = cardinality;
+            }
+        }
+        return best == nullptr ? nullptr : best->createConflict();
+    }
+
+    std::vector<unsigned int> ConflictBaseSearch::robotsViolatingPositiveConstraint(
+        const ConstraintTreeNodeBase& node,
+        const ConstraintBase& constraint,
+        const unsigned int replanned_robot) const
+    {
+        auto cbs_parameters = std::dynamic_pointer_cast<const ConflictBasedSearchParameters>(m_parameters);
+        const auto* vertex_constraint = dynamic_cast<const PositiveVertexConstraint*>(&constraint);
+        const auto* edge_constraint   = dynamic_cast<const PositiveEdgeConstraint*>(&constraint);
+        if(vertex_constraint == nullptr && edge_constraint == nullptr)
+        {
+            return {};
+        }
+        const unsigned int forced_robot =
+            vertex_constraint != nullptr ? vertex_constraint->robot() : edge_constraint->robot();
+
+        // A robot that has finished stays on its last cell
+        std::vector<unsigned int> rv;
+        for(unsigned int robot = 0, num_robots = cbs_parameters->numberOfRobots(); robot < num_robots; ++robot)
+        {
+            if(robot == replanned_robot || robot == forced_robot)
+            {
+                continue;
+            }
+
+            const GridPath& path = *node.lowLevelSolution(robot);
+            bool violates        = false;
+            if(vertex_constraint != nullptr)
+            {
+                violates = path.cellOrLast(vertex_constraint->time()) ==
+                           GridPath::pack(vertex_constraint->x(), vertex_constraint->y());
+            }
+            else
+            {
+                // Neither end of the edge at the time the forced robot is there, nor the edge in the other direction
+                const uint64_t from = GridPath::pack(edge_constraint->x1(), edge_constraint->y1());
+                const uint64_t to   = GridPath::pack(edge_constraint->x2(), edge_constraint->y2());
+                const uint64_t cell = path.cellOrLast(edge_constraint->time());
+                const uint64_t next = path.cellOrLast(edge_constraint->time() + 1);
+                violates            = cell == from || next == to || (cell == to && next == from);
+            }
+            if(violates)
+            {
+                rv.push_back(robot);
+            }
+        }
+        return rv;
+    }
+
+    std::shared_ptr<ConstraintTreeNodeBase> ConflictBaseSearch::createBypassNode(
+        const std::shared_ptr<ConstraintTreeNodeBase>& node,
+        const std::shared_ptr<const ConstraintTreeNodeBase>& child,
+        unsigned int robot) const
+    {
+        auto cbs_parameters = std::dynamic_pointer_cast<const ConflictBasedSearchParameters>(m_parameters);
+        auto bypass         = std::make_shared<ConstraintTreeNode>(cbs_parameters->numberOfRobots(),
+                                                           cbs_parameters->cost_type,
+                                                           node);
+        bypass->setConstraint(robot, nullptr);
+        bypass->setLowLevelSolution(robot, child->lowLevelSolution(robot));
+        if(cbs_parameters->prioritize_conflicts)
+        {
+            // Same constraints and cost level as node
+            bypass->setMultiValuedDecisionDiagram(robot, node->multiValuedDecisionDiagram(robot));
+        }
+        bypass->detectConflicts();
+        return bypass;
+    }
 }  // namespace grstapse
\ No newline at end of file
@@ -32,10 +32,25 @@ namespace grstapse
         const std::string& high_level_timer_name,
         const std::string& low_level_timer_name,
         bool has_timeout,
-        float timeout)
+        float timeout,
+        bool prioritize_conflicts,
+        bool bypass,
+        float suboptimality_weight,
+        unsigned int num_threads,
+        bool disjoint_splitting)
         : MultiAgentPathFindingParameters{.map = map, .initial_states = initial_states, .goal_states = goal_states}
         , SearchParameters{.has_timeout = has_timeout, .timeout = timeout, .timer_name = high_level_timer_name}
         , cost_type(cost_type)
         , low_level_timer_name(low_level_timer_name)
+        , prioritize_conflicts(prioritize_conflicts)
+        , bypass(bypass)
+        , suboptimality_weight(suboptimality_weight)
+        , num_threads(num_threads)
+        , disjoint_splitting(disjoint_splitting)
     {}
+
+    bool ConflictBasedSearchParameters::isEnhanced() const
+    {
+        return suboptimality_weight > 1.0f;
+    }
 }  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,74 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/geometric_planning/mapf/cbs/high_level/conflict_record.hpp"
+
+// Global
+#include <tuple>
+// Local
+#include "grstapse/geometric_planning/mapf/cbs/high_level/edge_conflict.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/high_level/vertex_conflict.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/multi_valued_decision_diagram.hpp"
+
+namespace grstapse
+{
+    std::unique_ptr<const ConflictBase> ConflictRecord::createConflict() const
+    {
+        if(is_edge)
+        {
+            return std::make_unique<const EdgeConflict>(agents, time, x1, y1, x2, y2);
+        }
+        return std::make_unique<const VertexConflict>(agents, time, x1, y1);
+    }
+
+    ConflictCardinality ConflictRecord::cardinality(const MultiValuedDecisionDiagram& mdd0,
+                                                    const MultiValuedDecisionDiagram& mdd1) const
+    {
+        bool cardinal0;
+        bool cardinal1;
+        if(is_edge)
+        {
+            cardinal0 = mdd0.isSingleton(time, x1, y1) && mdd0.isSingleton(time + 1, x2, y2);
+            cardinal1 = mdd1.isSingleton(time, x2, y2) && mdd1.isSingleton(time + 1, x1, y1);
+        }
+        else
+        {
+            cardinal0 = mdd0.isSingleton(time, x1, y1);
+            cardinal1 = mdd1.isSingleton(time, x1, y1);
+        }
+
+        if(cardinal0 && cardinal1)
+        {
+            return ConflictCardinality::e_cardinal;
+        }
+        if(cardinal0 || cardinal1)
+        {
+            return ConflictCardinality::e_semi_cardinal;
+        }
+        return ConflictCardinality::e_non_cardinal;
+    }
+
+    bool ConflictRecord::operator<(const ConflictRecord& rhs) const
+    {
+        return std::tie(time, is_edge, agents) < std::tie(rhs.time, rhs.is_edge, rhs.agents);
+    }
+}  // namespace grstapse
\ No newline at end of file
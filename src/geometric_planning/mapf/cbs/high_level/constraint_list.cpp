@@ -2,7 +2,7 @@
  * Graphically Recursive Simultaneous Task Allocation, Planning,
  * Scheduling, and Execution
  *
- * Copyright (C) 2020-2021
+ * Copyright (C) 2020-2022
  *
  * Author: Andrew Messing
  * Author: Glen Neville
@@ -20,16 +20,14 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
-#pragma once
+#include "grstapse/geometric_planning/mapf/cbs/high_level/constraint_list.hpp"
 
 namespace grstapse
 {
-    class EnhancedCConstraintTreeNodeBase
-        : public SearchNodeBase<EnhancedCConstraintTreeNodeBase>
-        , public MutablePriorityQueueable<unsigned int>
-    {
-       public:
-        EnhancedCConstraintTreeNodeBase();
-    };
-
+    ConstraintList::ConstraintList(const std::shared_ptr<const ConstraintBase>& constraint,
+                                   const std::shared_ptr<const ConstraintList>& next)
+        : m_constraint(constraint)
+        , m_next(next)
+        , m_size(next == nullptr ? 1 : next->size() + 1)
+    {}
 }  // namespace grstapse
\ No newline at end of file
@@ -23,28 +23,42 @@
 #include "grstapse/geometric_planning/mapf/cbs/high_level/constraint_tree_node.hpp"
 
 // Global
+#include <algorithm>
 #include <cassert>
 
 // Local
-#include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_node.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/high_level/constraint_list.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/high_level/positive_edge_constraint.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/high_level/positive_vertex_constraint.hpp"
+#include "grstapse/geometric_planning/mapf/grid_path.hpp"
 
 namespace grstapse
 {
+    namespace
+    {
+        //! \returns Whether \p constraint requires a robot to be somewhere (disjoint splitting)
+        [[nodiscard]] bool isPositive(const ConstraintBase& constraint)
+        {
+            return dynamic_cast<const PositiveVertexConstraint*>(&constraint) != nullptr ||
+                   dynamic_cast<const PositiveEdgeConstraint*>(&constraint) != nullptr;
+        }
+    }  // namespace
+
     ConstraintTreeNode::ConstraintTreeNode(unsigned int num_robots,
                                            ConstraintTreeNodeCostType cost_type,
                                            const std::shared_ptr<const ConstraintTreeNodeBase>& parent)
         : ConstraintTreeNodeBase(num_robots, cost_type, parent)
+        , m_lower_bound(0)
     {}
 
-    void ConstraintTreeNode::setLowLevelSolution(unsigned int robot,
-                                                 const std::shared_ptr<const TemporalGridCellNode>& leaf)
+    void ConstraintTreeNode::setLowLevelSolution(unsigned int robot, const std::shared_ptr<const GridPath>& path)
     {
         assert(robot < m_num_robots && robot == m_constraint_robot);
-        m_low_level_solution = trace<TemporalGridCellNode>(leaf);
+        m_low_level_solution = path;
+        m_lower_bound        = path->size();
     }
 
-    const std::vector<std::shared_ptr<const TemporalGridCellNode>>& ConstraintTreeNode::lowLevelSolution(
-        unsigned int robot) const
+    const std::shared_ptr<const GridPath>& ConstraintTreeNode::lowLevelSolution(unsigned int robot) const
     {
         assert(robot < m_num_robots);
         if(robot == m_constraint_robot)
@@ -54,33 +68,172 @@ namespace grstapse
         return m_parent->lowLevelSolution(robot);
     }
 
-    void ConstraintTreeNode::setConstraint(unsigned int robot, const std::shared_ptr<const ConstraintBase>& constraint)
+    void ConstraintTreeNode::setMultiValuedDecisionDiagram(
+        unsigned int robot,
+        const std::shared_ptr<const MultiValuedDecisionDiagram>& mdd)
     {
-        assert(robot < m_num_robots);
-        m_constraint_robot = robot;
-        m_constraint       = constraint;
+        assert(robot < m_num_robots && robot == m_constraint_robot);
+        m_mdd = mdd;
     }
 
-    const robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>> ConstraintTreeNode::constraints(
+    const std::shared_ptr<const MultiValuedDecisionDiagram>& ConstraintTreeNode::multiValuedDecisionDiagram(
         unsigned int robot) const
     {
-        robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>> rv;
+        assert(robot < m_num_robots);
         if(robot == m_constraint_robot)
         {
-            rv.insert(m_constraint);
+            return m_mdd;
         }
-        m_parent->constraintsInsert(robot, rv);
-        return rv;
+        return m_parent->multiValuedDecisionDiagram(robot);
     }
 
-    void ConstraintTreeNode::constraintsInsert(
-        unsigned int robot,
-        robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>>& us) const
+    void ConstraintTreeNode::setLowLevelLowerBound(unsigned int robot, unsigned int lower_bound)
+    {
+        assert(robot < m_num_robots && robot == m_constraint_robot);
+        m_lower_bound = lower_bound;
+    }
+
+    unsigned int ConstraintTreeNode::lowLevelLowerBound(unsigned int robot) const
+    {
+        assert(robot < m_num_robots);
+        if(robot == m_constraint_robot)
+        {
+            return m_lower_bound;
+        }
+        return m_parent->lowLevelLowerBound(robot);
+    }
+
+    void ConstraintTreeNode::setConstraint(unsigned int robot, const std::shared_ptr<const ConstraintBase>& constraint)
+    {
+        assert(robot < m_num_robots);
+        m_constraint_robot     = robot;
+        m_constraints          = m_parent->constraintList(robot);
+        m_positive_constraints = m_parent->positiveConstraintList();
+        if(constraint == nullptr)
+        {
+            return;
+        }
+        if(isPositive(*constraint))
+        {
+            m_positive_constraints = std::make_shared<const ConstraintList>(constraint, m_positive_constraints);
+            return;
+        }
+        m_constraints = std::make_shared<const ConstraintList>(constraint, m_constraints);
+    }
+
+    const std::shared_ptr<const ConstraintList>& ConstraintTreeNode::constraintList(unsigned int robot) const
     {
+        assert(robot < m_num_robots);
         if(robot == m_constraint_robot)
         {
-            us.insert(m_constraint);
+            return m_constraints;
+        }
+        return m_parent->constraintList(robot);
+    }
+
+    const std::shared_ptr<const ConstraintList>& ConstraintTreeNode::positiveConstraintList() const
+    {
+        return m_positive_constraints;
+    }
+
+    void ConstraintTreeNode::detectConflicts()
+    {
+        if(!m_parent->hasDetectedConflicts())
+        {
+            ConstraintTreeNodeBase::detectConflicts();
+            return;
+        }
+
+        const std::vector<const GridPath*> solutions = lowLevelSolutions();
+        unsigned int max_time                        = 0;
+        unsigned int parent_max_time                 = m_parent->lowLevelSolution(m_constraint_robot)->size();
+        for(unsigned int robot = 0; robot < m_num_robots; ++robot)
+        {
+            const unsigned int duration = solutions[robot]->size();
+            max_time                    = std::max(max_time, duration);
+            if(robot != m_constraint_robot)
+            {
+                parent_max_time = std::max(parent_max_time, duration);
+            }
+        }
+
+        m_conflicts.clear();
+        for(const ConflictRecord& conflict: m_parent->conflicts())
+        {
+            // Both robots have finished by the new makespan, so the conflict duplicates the one at max_time - 1
+            if(conflict.involves(m_constraint_robot) || conflict.time >= max_time)
+            {
+                continue;
+            }
+            m_conflicts.push_back(conflict);
+
+            // Both robots have finished and stay in conflict until the new makespan
+            if(!conflict.is_edge && conflict.time + 1 == parent_max_time)
+            {
+                for(unsigned int t = parent_max_time; t < max_time; ++t)
+                {
+                    m_conflicts.push_back(conflict);
+                    m_conflicts.back().time = t;
+                }
+            }
+        }
+
+        const GridPath& solution_r = *m_low_level_solution;
+        for(unsigned int t = 0; t < max_time; ++t)
+        {
+            // Check vertex collisions
+            const uint64_t cell_r = solution_r.cellOrLast(t);
+            for(unsigned int robot = 0; robot < m_num_robots; ++robot)
+            {
+                if(robot != m_constraint_robot && solutions[robot]->cellOrLast(t) == cell_r)
+                {
+                    m_conflicts.push_back(ConflictRecord{.agents  = {std::min(robot, m_constraint_robot),
+                                                                     std::max(robot, m_constraint_robot)},
+                                                         .time    = t,
+                                                         .is_edge = false,
+                                                         .x1      = GridPath::x(cell_r),
+                                                         .y1      = GridPath::y(cell_r),
+                                                         .x2      = GridPath::x(cell_r),
+                                                         .y2      = GridPath::y(cell_r)});
+                }
+            }
+
+            // Check edge collisions (a waiting robot cannot swap with another without a vertex collision)
+            if(t + 1 >= solution_r.size())
+            {
+                continue;
+            }
+            const uint64_t next_r = solution_r.cell(t + 1);
+            if(next_r == cell_r)
+            {
+                continue;
+            }
+            for(unsigned int robot = 0; robot < m_num_robots; ++robot)
+            {
+                const GridPath& solution = *solutions[robot];
+                if(robot == m_constraint_robot || t + 1 >= solution.size())
+                {
+                    continue;
+                }
+                const uint64_t cell = solution.cell(t);
+                const uint64_t next = solution.cell(t + 1);
+
+                // If the robots swap vertices (would be on the same edge in different directions)
+                if(cell == next_r && next == cell_r)
+                {
+                    const uint64_t from = robot < m_constraint_robot ? cell : cell_r;
+                    const uint64_t to   = robot < m_constraint_robot ? next : next_r;
+                    m_conflicts.push_back(ConflictRecord{.agents  = {std::min(robot, m_constraint_robot),
+                                                                     std::max(robot, m_constraint_robot)},
+                                                         .time    = t,
+                                                         .is_edge = true,
+                                                         .x1      = GridPath::x(from),
+                                                         .y1      = GridPath::y(from),
+                                                         .x2      = GridPath::x(to),
+                                                         .y2      = GridPath::y(to)});
+                }
+            }
         }
-        m_parent->constraintsInsert(robot, us);
+        m_conflicts_detected = true;
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -23,18 +23,51 @@
 #include "grstapse/geometric_planning/mapf/cbs/high_level/constraint_tree_node_base.hpp"
 
 // Global
+#include <algorithm>
 #include <iostream>
+#include <utility>
+
+// External
+#include <boost/functional/hash.hpp>
 
 // Local
 #include "grstapse/common/utilities/error.hpp"
 #include "grstapse/geometric_planning/grid/grid_map.hpp"
-#include "grstapse/geometric_planning/mapf/cbs/high_level/edge_conflict.hpp"
-#include "grstapse/geometric_planning/mapf/cbs/high_level/vertex_conflict.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/high_level/conflict_base.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/high_level/constraint_list.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_node.hpp"
+#include "grstapse/geometric_planning/mapf/grid_path.hpp"
 
 namespace grstapse
 {
-    unsigned int ConstraintTreeNodeBase::s_next_id = 0;
+    namespace
+    {
+        //! (from cell, to cell)
+        using EdgeKey = std::pair<uint64_t, uint64_t>;
+
+        struct EdgeKeyHash
+        {
+            [[nodiscard]] std::size_t operator()(const EdgeKey& key) const
+            {
+                std::size_t seed = 0;
+                boost::hash_combine(seed, key.first);
+                boost::hash_combine(seed, key.second);
+                return seed;
+            }
+        };
+
+        //! \returns The earliest of \p conflicts (with respect to time and then vertex before edge conflicts)
+        [[nodiscard]] std::unique_ptr<const ConflictBase> firstConflict(const std::vector<ConflictRecord>& conflicts)
+        {
+            if(conflicts.empty())
+            {
+                return nullptr;
+            }
+            return std::min_element(conflicts.begin(), conflicts.end())->createConflict();
+        }
+    }  // namespace
+
+    std::atomic<unsigned int> ConstraintTreeNodeBase::s_next_id = 0;
 
     ConstraintTreeNodeBase::ConstraintTreeNodeBase(unsigned int num_robots,
                                                    ConstraintTreeNodeCostType cost,
@@ -42,8 +75,26 @@ namespace grstapse
         : SearchNodeBase<ConstraintTreeNodeBase>(s_next_id++, parent)
         , m_num_robots(num_robots)
         , m_cost_type(cost)
+        , m_conflicts_detected(false)
     {}
 
+    void ConstraintTreeNodeBase::setLowLevelSolution(unsigned int robot,
+                                                     const std::shared_ptr<const TemporalGridCellNode>& leaf)
+    {
+        setLowLevelSolution(robot, std::make_shared<const GridPath>(leaf));
+    }
+
+    robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>> ConstraintTreeNodeBase::constraints(
+        unsigned int robot) const
+    {
+        robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>> rv;
+        for(const ConstraintList* list = constraintList(robot).get(); list != nullptr; list = list->next().get())
+        {
+            rv.insert(list->constraint());
+        }
+        return rv;
+    }
+
     unsigned int ConstraintTreeNodeBase::cost() const
     {
         switch(m_cost_type)
@@ -62,8 +113,7 @@ namespace grstapse
         unsigned int rv = 0;
         for(unsigned int robot = 0; robot < m_num_robots; ++robot)
         {
-            const auto& low_level_solution = lowLevelSolution(robot);
-            rv                             = std::max(rv, static_cast<unsigned int>(low_level_solution.size()));
+            rv = std::max(rv, lowLevelSolution(robot)->size());
         }
         return rv;
     }
@@ -73,97 +123,147 @@ namespace grstapse
         unsigned int rv = 0;
         for(unsigned int robot = 0; robot < m_num_robots; ++robot)
         {
-            const auto& low_level_solution = lowLevelSolution(robot);
-            rv += static_cast<unsigned int>(low_level_solution.size());
+            rv += lowLevelSolution(robot)->size();
+        }
+        return rv;
+    }
+
+    unsigned int ConstraintTreeNodeBase::lowerBound() const
+    {
+        unsigned int rv = 0;
+        for(unsigned int robot = 0; robot < m_num_robots; ++robot)
+        {
+            switch(m_cost_type)
+            {
+                case ConstraintTreeNodeCostType::e_makespan:
+                    rv = std::max(rv, lowLevelLowerBound(robot));
+                    break;
+                case ConstraintTreeNodeCostType::e_sum_of_costs:
+                    rv += lowLevelLowerBound(robot);
+                    break;
+                default:
+                    throw createLogicError("Unknown cost type");
+            }
         }
         return rv;
     }
 
     std::unique_ptr<const ConflictBase> ConstraintTreeNodeBase::getFirstConflict() const
     {
-        unsigned int max_time = makespan();
+        if(m_conflicts_detected)
+        {
+            return firstConflict(m_conflicts);
+        }
+        return firstConflict(findAllConflicts());
+    }
+
+    void ConstraintTreeNodeBase::detectConflicts()
+    {
+        m_conflicts          = findAllConflicts();
+        m_conflicts_detected = true;
+    }
+
+    std::vector<ConflictRecord> ConstraintTreeNodeBase::findAllConflicts() const
+    {
+        const std::vector<const GridPath*> solutions = lowLevelSolutions();
+        unsigned int max_time                        = 0;
+        for(const GridPath* solution: solutions)
+        {
+            max_time = std::max(max_time, solution->size());
+        }
 
+        std::vector<ConflictRecord> rv;
+
+        // The robots that occupy the same cell (or edge) during a timestep are chained together through next_robot
+        const unsigned int no_robot = m_num_robots;
+        std::vector<unsigned int> next_robot(m_num_robots);
+        robin_hood::unordered_flat_map<uint64_t, unsigned int> cells;
+        robin_hood::unordered_flat_map<EdgeKey, unsigned int, EdgeKeyHash> edges;
+        cells.reserve(m_num_robots);
+        edges.reserve(m_num_robots);
         for(unsigned int t = 0; t < max_time; ++t)
         {
             // Check vertex collisions
-            for(unsigned int robot_i = 0; robot_i < m_num_robots; ++robot_i)
+            cells.clear();
+            for(unsigned int robot_j = 0; robot_j < m_num_robots; ++robot_j)
             {
-                std::shared_ptr<const GridCell> state_i = getStateOrLast(robot_i, t);
-
-                // If robot i has finished its path
-                //                if(state_i == nullptr)
-                //                {
-                //                    continue;
-                //                }
-                for(unsigned int robot_j = robot_i + 1; robot_j < m_num_robots; ++robot_j)
+                const uint64_t cell_j = solutions[robot_j]->cellOrLast(t);
+                auto [itr, inserted]  = cells.try_emplace(cell_j, robot_j);
+                if(inserted)
                 {
-                    std::shared_ptr<const GridCell> state_j = getStateOrLast(robot_j, t);
-
-                    // If robot j has finished its path
-                    //                    if(state_j == nullptr)
-                    //                    {
-                    //                        continue;
-                    //                    }
-
-                    // If robot i and j are at the same GridCell at the same time
-                    if(*state_i == *state_j)
-                    {
-                        return std::move(
-                            std::make_unique<const VertexConflict>(std::array<unsigned int, 2>{robot_i, robot_j},
-                                                                   t,
-                                                                   state_i->x(),
-                                                                   state_i->y()));
-                    }
+                    next_robot[robot_j] = no_robot;
+                    continue;
+                }
+                for(unsigned int robot_i = itr->second; robot_i != no_robot; robot_i = next_robot[robot_i])
+                {
+                    rv.push_back(ConflictRecord{.agents  = {robot_i, robot_j},
+                                                .time    = t,
+                                                .is_edge = false,
+                                                .x1      = GridPath::x(cell_j),
+                                                .y1      = GridPath::y(cell_j),
+                                                .x2      = GridPath::x(cell_j),
+                                                .y2      = GridPath::y(cell_j)});
                 }
+                next_robot[robot_j] = itr->second;
+                itr->second         = robot_j;
             }
 
-            // Check edge collisions
-            if(t < max_time - 1)
+            // Check edge collisions (a waiting robot cannot swap with another without a vertex collision)
+            edges.clear();
+            for(unsigned int robot_j = 0; robot_j < m_num_robots; ++robot_j)
             {
-                for(unsigned int robot_i = 0; robot_i < m_num_robots; ++robot_i)
+                const GridPath& solution_j = *solutions[robot_j];
+                if(t + 1 >= solution_j.size())
                 {
-                    std::shared_ptr<const GridCell> state_ia = getState(robot_i, t);
-                    std::shared_ptr<const GridCell> state_ib = getState(robot_i, t + 1);
+                    continue;
+                }
+                const uint64_t from = solution_j.cell(t);
+                const uint64_t to   = solution_j.cell(t + 1);
+                if(from == to)
+                {
+                    continue;
+                }
 
-                    // If robot i has finished its path
-                    if(state_ia == nullptr || state_ib == nullptr)
-                    {
-                        continue;
-                    }
-                    for(unsigned int robot_j = robot_i + 1; robot_j < m_num_robots; ++robot_j)
+                // If robot i and j swap vertices (would be on the same edge in different directions)
+                if(auto reverse = edges.find(EdgeKey(to, from)); reverse != edges.end())
+                {
+                    for(unsigned int robot_i = reverse->second; robot_i != no_robot; robot_i = next_robot[robot_i])
                     {
-                        std::shared_ptr<const GridCell> state_ja = getState(robot_j, t);
-                        std::shared_ptr<const GridCell> state_jb = getState(robot_j, t + 1);
-
-                        // If robot j has finished its path
-                        if(state_ja == nullptr || state_jb == nullptr)
-                        {
-                            continue;
-                        }
-
-                        // If robot i and j swap vertices (would be on the same edge in different directions)
-                        if(*state_ia == *state_jb && *state_ib == *state_ja)
-                        {
-                            return std::move(
-                                std::make_unique<const EdgeConflict>(std::array<unsigned int, 2>{robot_i, robot_j},
-                                                                     t,
-                                                                     state_ia->x(),
-                                                                     state_ia->y(),
-                                                                     state_ib->x(),
-                                                                     state_ib->y()));
-                        }
+                        // Robot i moves from 'to' to 'from'
+                        rv.push_back(ConflictRecord{.agents  = {robot_i, robot_j},
+                                                    .time    = t,
+                                                    .is_edge = true,
+                                                    .x1      = GridPath::x(to),
+                                                    .y1      = GridPath::y(to),
+                                                    .x2      = GridPath::x(from),
+                                                    .y2      = GridPath::y(from)});
                     }
                 }
+
+                auto [itr, inserted] = edges.try_emplace(EdgeKey(from, to), robot_j);
+                next_robot[robot_j]  = inserted ? no_robot : itr->second;
+                itr->second          = robot_j;
             }
         }
+        return rv;
+    }
 
-        return nullptr;
+    std::vector<const GridPath*> ConstraintTreeNodeBase::lowLevelSolutions() const
+    {
+        std::vector<const GridPath*> rv;
+        rv.reserve(m_num_robots);
+        for(unsigned int robot = 0; robot < m_num_robots; ++robot)
+        {
+            rv.push_back(lowLevelSolution(robot).get());
+        }
+        return rv;
     }
 
     unsigned int ConstraintTreeNodeBase::priority() const
     {
-        return cost();
+        return lowerBound();
     }
+
     void ConstraintTreeNodeBase::display(const std::shared_ptr<const GridMap>& map) const
     {
         unsigned int max_time       = makespan();
@@ -215,20 +315,10 @@ namespace grstapse
 
                     unsigned int num_r = 0;
                     unsigned int robot;
+                    const uint64_t cell = GridPath::pack(x, y);
                     for(unsigned int r = 0; r < m_num_robots; ++r)
                     {
-                        const auto& low_level_solution = lowLevelSolution(r);
-                        if(t >= low_level_solution.size())
-                        {
-                            if(low_level_solution.back()->x() == x && low_level_solution.back()->y() == y)
-                            {
-                                ++num_r;
-                                robot = r;
-                            }
-                            continue;
-                        }
-
-                        if(low_level_solution[t]->x() == x && low_level_solution[t]->y() == y)
+                        if(lowLevelSolution(r)->cellOrLast(t) == cell)
                         {
                             ++num_r;
                             robot = r;
@@ -259,29 +349,4 @@ namespace grstapse
             std::cout << std::endl;
         }
     }
-
-    std::shared_ptr<const GridCell> ConstraintTreeNodeBase::getStateOrLast(unsigned int robot, unsigned int time) const
-    {
-        assert(robot < m_num_robots);
-        if(time < lowLevelSolution(robot).size())
-        {
-            return std::dynamic_pointer_cast<const GridCell>(lowLevelSolution(robot)[time]);
-        }
-        return std::dynamic_pointer_cast<const GridCell>(lowLevelSolution(robot).back());
-    }
-
-    std::shared_ptr<const GridCell> ConstraintTreeNodeBase::getState(unsigned int robot, unsigned int time) const
-    {
-        assert(robot < m_num_robots);
-        if(time < lowLevelSolution(robot).size())
-        {
-            return std::dynamic_pointer_cast<const GridCell>(lowLevelSolution(robot)[time]);
-        }
-        return nullptr;
-    }
-    std::shared_ptr<const GridCell> ConstraintTreeNodeBase::getLastState(unsigned int robot) const
-    {
-        assert(robot < m_num_robots);
-        return std::dynamic_pointer_cast<const GridCell>(lowLevelSolution(robot).back());
-    }
 }  // namespace grstapse
\ No newline at end of file
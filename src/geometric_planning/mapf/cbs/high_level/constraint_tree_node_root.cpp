@@ -27,43 +27,76 @@
 
 // Local
 #include "grstapse/common/utilities/error.hpp"
-#include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_node.hpp"
+#include "grstapse/geometric_planning/mapf/grid_path.hpp"
 
 namespace grstapse
 {
+    namespace
+    {
+        //! The root has no constraints
+        const std::shared_ptr<const ConstraintList> k_no_constraints = nullptr;
+    }  // namespace
+
     ConstraintTreeNodeRoot::ConstraintTreeNodeRoot(unsigned int num_robot, ConstraintTreeNodeCostType cost_type)
         : ConstraintTreeNodeBase(num_robot, cost_type, nullptr)
         , m_low_level_solutions(num_robot)
+        , m_mdds(num_robot)
+        , m_lower_bounds(num_robot, 0)
     {}
 
-    void ConstraintTreeNodeRoot::setLowLevelSolution(unsigned int robot,
-                                                     const std::shared_ptr<const TemporalGridCellNode>& leaf)
+    void ConstraintTreeNodeRoot::setLowLevelSolution(unsigned int robot, const std::shared_ptr<const GridPath>& path)
     {
         assert(robot < m_num_robots);
-        m_low_level_solutions[robot] = trace(leaf);
+        m_low_level_solutions[robot] = path;
+        m_lower_bounds[robot]        = path->size();
     }
 
-    const std::vector<std::shared_ptr<const TemporalGridCellNode>>& ConstraintTreeNodeRoot::lowLevelSolution(
-        unsigned int robot) const
+    const std::shared_ptr<const GridPath>& ConstraintTreeNodeRoot::lowLevelSolution(unsigned int robot) const
     {
         assert(robot < m_num_robots);
         return m_low_level_solutions[robot];
     }
+
+    void ConstraintTreeNodeRoot::setMultiValuedDecisionDiagram(
+        unsigned int robot,
+        const std::shared_ptr<const MultiValuedDecisionDiagram>& mdd)
+    {
+        assert(robot < m_num_robots);
+        m_mdds[robot] = mdd;
+    }
+
+    const std::shared_ptr<const MultiValuedDecisionDiagram>& ConstraintTreeNodeRoot::multiValuedDecisionDiagram(
+        unsigned int robot) const
+    {
+        assert(robot < m_num_robots);
+        return m_mdds[robot];
+    }
+
+    void ConstraintTreeNodeRoot::setLowLevelLowerBound(unsigned int robot, unsigned int lower_bound)
+    {
+        assert(robot < m_num_robots);
+        m_lower_bounds[robot] = lower_bound;
+    }
+
+    unsigned int ConstraintTreeNodeRoot::lowLevelLowerBound(unsigned int robot) const
+    {
+        assert(robot < m_num_robots);
+        return m_lower_bounds[robot];
+    }
+
     void ConstraintTreeNodeRoot::setConstraint(unsigned int robot,
                                                const std::shared_ptr<const ConstraintBase>& constraint)
     {
         throw createLogicError("Cannot set a constraint for the root Constraint Tree Node");
     }
 
-    const robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>> ConstraintTreeNodeRoot::constraints(
-        unsigned int robot) const
+    const std::shared_ptr<const ConstraintList>& ConstraintTreeNodeRoot::constraintList(unsigned int robot) const
     {
-        return robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>>();
+        return k_no_constraints;
     }
-    void ConstraintTreeNodeRoot::constraintsInsert(
-        unsigned int robot,
-        robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>>& us) const
+
+    const std::shared_ptr<const ConstraintList>& ConstraintTreeNodeRoot::positiveConstraintList() const
     {
-        return;
+        return k_no_constraints;
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -24,6 +24,7 @@
 
 // Local
 #include "grstapse/geometric_planning/mapf/cbs/high_level/edge_constraint.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/high_level/positive_edge_constraint.hpp"
 
 namespace grstapse
 {
@@ -43,4 +44,12 @@ namespace grstapse
             {m_agents[0], std::make_shared<EdgeConstraint>(m_time, m_x1, m_y1, m_x2, m_y2)},
             {m_agents[1], std::make_shared<EdgeConstraint>(m_time, m_x2, m_y2, m_x1, m_y1)}};
     }
+
+    robin_hood::unordered_map<unsigned int, std::shared_ptr<ConstraintBase>> EdgeConflict::createDisjointConstraints()
+        const
+    {
+        return robin_hood::unordered_map<unsigned int, std::shared_ptr<ConstraintBase>>{
+            {m_agents[0], std::make_shared<EdgeConstraint>(m_time, m_x1, m_y1, m_x2, m_y2)},
+            {m_agents[1], std::make_shared<PositiveEdgeConstraint>(m_agents[0], m_time, m_x1, m_y1, m_x2, m_y2)}};
+    }
 }  // namespace grstapse
\ No newline at end of file
@@ -23,6 +23,7 @@
 #include "grstapse/geometric_planning/mapf/cbs/high_level/vertex_conflict.hpp"
 
 // Local
+#include "grstapse/geometric_planning/mapf/cbs/high_level/positive_vertex_constraint.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/high_level/vertex_constraint.hpp"
 
 namespace grstapse
@@ -42,4 +43,12 @@ namespace grstapse
             {m_agents[0], vertex_constraint},
             {m_agents[1], vertex_constraint}};
     }
+
+    robin_hood::unordered_map<unsigned int, std::shared_ptr<ConstraintBase>> VertexConflict::createDisjointConstraints()
+        const
+    {
+        return robin_hood::unordered_map<unsigned int, std::shared_ptr<ConstraintBase>>{
+            {m_agents[0], std::make_shared<VertexConstraint>(m_time, m_x, m_y)},
+            {m_agents[1], std::make_shared<PositiveVertexConstraint>(m_agents[0], m_time, m_x, m_y)}};
+    }
 }  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,173 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/geometric_planning/mapf/cbs/low_level/constraint_table.hpp"
+
+// Global
+#include <algorithm>
+// External
+#include <boost/functional/hash.hpp>
+// Local
+#include "grstapse/common/utilities/error.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/high_level/constraint_list.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/high_level/edge_constraint.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/high_level/positive_edge_constraint.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/high_level/positive_vertex_constraint.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/high_level/vertex_constraint.hpp"
+
+namespace grstapse
+{
+    ConstraintTable::ConstraintTable(
+        const robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>>& constraints)
+    {
+        for(const std::shared_ptr<const ConstraintBase>& constraint: constraints)
+        {
+            insert(constraint);
+        }
+    }
+
+    ConstraintTable::ConstraintTable(const ConstraintList* constraints)
+    {
+        for(const ConstraintList* list = constraints; list != nullptr; list = list->next().get())
+        {
+            insert(list->constraint());
+        }
+    }
+
+    ConstraintTable::ConstraintTable(const ConstraintList* constraints,
+                                     const ConstraintList* positive_constraints,
+                                     unsigned int robot)
+        : ConstraintTable(constraints)
+    {
+        for(const ConstraintList* list = positive_constraints; list != nullptr; list = list->next().get())
+        {
+            insertPositive(list->constraint(), robot);
+        }
+    }
+
+    void ConstraintTable::insert(const std::shared_ptr<const ConstraintBase>& constraint)
+    {
+        if(auto vertex_constraint = std::dynamic_pointer_cast<const VertexConstraint>(constraint))
+        {
+            insertVertex(vertex_constraint->time(), vertex_constraint->x(), vertex_constraint->y());
+            return;
+        }
+
+        if(auto edge_constraint = std::dynamic_pointer_cast<const EdgeConstraint>(constraint))
+        {
+            const uint64_t from = cellKey(edge_constraint->x1(), edge_constraint->y1());
+            const uint64_t to   = cellKey(edge_constraint->x2(), edge_constraint->y2());
+            m_edges.emplace(VertexKey(edge_constraint->time(), from), to);
+            return;
+        }
+        throw createLogicError("Unknown type of constraint");
+    }
+
+    void ConstraintTable::insertPositive(const std::shared_ptr<const ConstraintBase>& constraint, unsigned int robot)
+    {
+        if(auto vertex_constraint = std::dynamic_pointer_cast<const PositiveVertexConstraint>(constraint))
+        {
+            if(vertex_constraint->robot() == robot)
+            {
+                insertMustVisit(vertex_constraint->time(), vertex_constraint->x(), vertex_constraint->y());
+            }
+            else
+            {
+                insertVertex(vertex_constraint->time(), vertex_constraint->x(), vertex_constraint->y());
+            }
+            return;
+        }
+
+        if(auto edge_constraint = std::dynamic_pointer_cast<const PositiveEdgeConstraint>(constraint))
+        {
+            const unsigned int time = edge_constraint->time();
+            if(edge_constraint->robot() == robot)
+            {
+                // Being at both ends at consecutive times means traversing the edge
+                insertMustVisit(time, edge_constraint->x1(), edge_constraint->y1());
+                insertMustVisit(time + 1, edge_constraint->x2(), edge_constraint->y2());
+            }
+            else
+            {
+                insertVertex(time, edge_constraint->x1(), edge_constraint->y1());
+                insertVertex(time + 1, edge_constraint->x2(), edge_constraint->y2());
+                m_edges.emplace(VertexKey(time, cellKey(edge_constraint->x2(), edge_constraint->y2())),
+                                cellKey(edge_constraint->x1(), edge_constraint->y1()));
+            }
+            return;
+        }
+        throw createLogicError("Unknown type of positive constraint");
+    }
+
+    void ConstraintTable::insertVertex(const unsigned int time, const unsigned int x, const unsigned int y)
+    {
+        const uint64_t cell = cellKey(x, y);
+        m_vertices.emplace(time, cell);
+        unsigned int& latest = m_latest_vertex_constraint[cell];
+        latest               = std::max(latest, time);
+    }
+
+    void ConstraintTable::insertMustVisit(const unsigned int time, const unsigned int x, const unsigned int y)
+    {
+        const uint64_t cell  = cellKey(x, y);
+        auto [itr, inserted] = m_must_visit.try_emplace(time, cell);
+        if(!inserted && itr->second != cell)
+        {
+            itr->second = k_nowhere;
+        }
+    }
+
+    unsigned int ConstraintTable::latestVertexConstraint(const unsigned int x, const unsigned int y) const
+    {
+        const uint64_t cell = cellKey(x, y);
+        unsigned int rv     = 0;
+        if(auto itr = m_latest_vertex_constraint.find(cell); itr != m_latest_vertex_constraint.end())
+        {
+            rv = itr->second;
+        }
+
+        // A robot that finishes at (x, y) cannot visit a different cell afterwards
+        for(const auto& [time, must_visit]: m_must_visit)
+        {
+            if(must_visit != cell)
+            {
+                rv = std::max(rv, time);
+            }
+        }
+        return rv;
+    }
+
+    std::size_t ConstraintTable::VertexKeyHash::operator()(const VertexKey& key) const
+    {
+        std::size_t seed = 0;
+        boost::hash_combine(seed, key.first);
+        boost::hash_combine(seed, key.second);
+        return seed;
+    }
+
+    std::size_t ConstraintTable::EdgeKeyHash::operator()(const EdgeKey& key) const
+    {
+        std::size_t seed = VertexKeyHash()(key.first);
+        boost::hash_combine(seed, key.second);
+        return seed;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -24,11 +24,14 @@
 
 // Local
 #include "grstapse/geometric_planning/grid/grid_map.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/constraint_table.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_cardinal_edge_applier.hpp"
 
 namespace grstapse
 {
-    GridCellCardinalsPlusWaitGenerator::GridCellCardinalsPlusWaitGenerator(const std::shared_ptr<const GridMap>& map)
+    GridCellCardinalsPlusWaitGenerator::GridCellCardinalsPlusWaitGenerator(
+        const std::shared_ptr<const GridMap>& map,
+        const std::shared_ptr<const ConstraintTable>& constraints)
         : Base({
               std::make_shared<const TemporalGridCellCardinalEdgeApplier>(0, 1),   //  North
               std::make_shared<const TemporalGridCellCardinalEdgeApplier>(0, -1),  // South
@@ -37,6 +40,7 @@ namespace grstapse
               std::make_shared<const TemporalGridCellCardinalEdgeApplier>(0, 0)    // Wait
           })
         , m_map(map)
+        , m_constraints(constraints)
     {}
 
     bool GridCellCardinalsPlusWaitGenerator::isValidNode(const std::shared_ptr<const TemporalGridCellNode>& node) const
@@ -55,7 +59,10 @@ namespace grstapse
         {
             return false;
         }
-        return true;
+
+        const std::shared_ptr<const TemporalGridCellNode>& parent = node->parent();
+        return m_constraints == nullptr || parent == nullptr ||
+               !m_constraints->isEdgeConstrained(parent->time(), parent->x(), parent->y(), node->x(), node->y());
     }
 
 }  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,168 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/geometric_planning/mapf/cbs/low_level/multi_valued_decision_diagram.hpp"
+
+// Global
+#include <algorithm>
+#include <array>
+#include <limits>
+// External
+#include <fmt/format.h>
+// Local
+#include "grstapse/common/utilities/error.hpp"
+#include "grstapse/geometric_planning/grid/grid_cell.hpp"
+#include "grstapse/geometric_planning/grid/grid_distance_table.hpp"
+#include "grstapse/geometric_planning/grid/grid_map.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/constraint_table.hpp"
+
+namespace grstapse
+{
+    namespace
+    {
+        //! North, South, East, West, and Wait
+        constexpr std::array<std::array<int, 2>, 5> k_moves = {{{0, 1}, {0, -1}, {1, 0}, {-1, 0}, {0, 0}}};
+    }  // namespace
+
+    MultiValuedDecisionDiagram::MultiValuedDecisionDiagram(const GridMap& map,
+                                                           const GridCell& initial,
+                                                           const GridCell& goal,
+                                                           const unsigned int duration,
+                                                           const ConstraintTable& constraints,
+                                                           const GridDistanceTable* distances)
+        : m_map_width(map.width())
+        , m_goal(goal.y() * map.width() + goal.x())
+    {
+        if(duration == 0)
+        {
+            throw createLogicError("A multi-valued decision diagram needs at least one timestep");
+        }
+        const unsigned int last       = duration - 1;
+        constexpr unsigned int k_none = std::numeric_limits<unsigned int>::max();
+
+        // Calls callback(neighbor index, neighbor x, neighbor y) for each valid move out of (x, y)
+        auto for_each_move = [&map](unsigned int x, unsigned int y, auto&& callback)
+        {
+            for(const auto& [dx, dy]: k_moves)
+            {
+                const int nx = static_cast<int>(x) + dx;
+                const int ny = static_cast<int>(y) + dy;
+                if(nx < 0 || ny < 0 || nx >= static_cast<int>(map.width()) || ny >= static_cast<int>(map.height()) ||
+                   map.isObstacle(nx, ny))
+                {
+                    continue;
+                }
+                callback(ny * map.width() + nx, static_cast<unsigned int>(nx), static_cast<unsigned int>(ny));
+            }
+        };
+
+        // Forward pass: the cells reachable at each time that can still reach the goal by the last timestep
+        std::vector<std::vector<unsigned int>> reachable(duration);
+        // The last level each cell was added to
+        std::vector<unsigned int> stamp(map.width() * map.height(), k_none);
+        reachable[0].push_back(initial.y() * m_map_width + initial.x());
+        for(unsigned int t = 0; t < last; ++t)
+        {
+            for(const unsigned int cell: reachable[t])
+            {
+                const unsigned int x = cell % m_map_width;
+                const unsigned int y = cell / m_map_width;
+                for_each_move(x,
+                              y,
+                              [&](unsigned int next, unsigned int nx, unsigned int ny)
+                              {
+                                  const unsigned int distance =
+                                      distances != nullptr ? distances->distance(nx, ny)
+                                                           : (nx > goal.x() ? nx - goal.x() : goal.x() - nx) +
+                                                                 (ny > goal.y() ? ny - goal.y() : goal.y() - ny);
+                                  if(stamp[next] == t + 1 || distance > last - t - 1 ||
+                                     constraints.isVertexConstrained(t + 1, nx, ny) ||
+                                     constraints.isEdgeConstrained(t, x, y, nx, ny))
+                                  {
+                                      return;
+                                  }
+                                  stamp[next] = t + 1;
+                                  reachable[t + 1].push_back(next);
+                              });
+            }
+        }
+        if(std::find(reachable[last].begin(), reachable[last].end(), m_goal) == reachable[last].end())
+        {
+            throw createLogicError(fmt::format("The goal cannot be reached in {0:d} timesteps", duration));
+        }
+
+        // Backward pass: only keep the cells that lead to the goal at the last timestep
+        m_levels.resize(duration);
+        m_levels[last].push_back(m_goal);
+        std::fill(stamp.begin(), stamp.end(), k_none);
+        stamp[m_goal] = last;
+        for(unsigned int t = last; t-- > 0;)
+        {
+            for(const unsigned int cell: reachable[t])
+            {
+                const unsigned int x = cell % m_map_width;
+                const unsigned int y = cell / m_map_width;
+                bool leads_to_goal   = false;
+                for_each_move(x,
+                              y,
+                              [&](unsigned int next, unsigned int nx, unsigned int ny)
+                              {
+                                  if(stamp[next] == t + 1 && !constraints.isEdgeConstrained(t, x, y, nx, ny))
+                                  {
+                                      leads_to_goal = true;
+                                  }
+                              });
+                if(leads_to_goal)
+                {
+                    m_levels[t].push_back(cell);
+                }
+            }
+            for(const unsigned int cell: m_levels[t])
+            {
+                stamp[cell] = t;
+            }
+            std::sort(m_levels[t].begin(), m_levels[t].end());
+        }
+    }
+
+    bool MultiValuedDecisionDiagram::isSingleton(const unsigned int time,
+                                                 const unsigned int x,
+                                                 const unsigned int y) const
+    {
+        const unsigned int cell = y * m_map_width + x;
+        if(time >= m_levels.size())
+        {
+            return cell == m_goal;
+        }
+        return m_levels[time].size() == 1 && m_levels[time].front() == cell;
+    }
+
+    bool MultiValuedDecisionDiagram::contains(const unsigned int time, const unsigned int x, const unsigned int y) const
+    {
+        const unsigned int cell = y * m_map_width + x;
+        if(time >= m_levels.size())
+        {
+            return cell == m_goal;
+        }
+        return std::binary_search(m_levels[time].begin(), m_levels[time].end(), cell);
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -2,7 +2,7 @@
  * Graphically Recursive Simultaneous Task Allocation, Planning,
  * Scheduling, and Execution
  *
- * Copyright (C) 2020-2021
+ * Copyright (C) 2020-2022
  *
  * Author: Andrew Messing
  * Author: Glen Neville
@@ -22,59 +22,18 @@
  */
 #include "grstapse/geometric_planning/mapf/cbs/low_level/prune_constraints.hpp"
 
-// External
-#include <robin_hood/robin_hood.hpp>
-
 // Local
-#include "grstapse/common/utilities/error.hpp"
-#include "grstapse/geometric_planning/mapf/cbs/high_level/edge_constraint.hpp"
-#include "grstapse/geometric_planning/mapf/cbs/high_level/vertex_constraint.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/constraint_table.hpp"
 
 namespace grstapse
 {
-    PruneConstraints::PruneConstraints(
-        const robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>>& constraints)
+    PruneConstraints::PruneConstraints(const std::shared_ptr<const ConstraintTable>& constraints)
         : m_constraints(constraints)
     {}
 
     bool PruneConstraints::operator()(const std::shared_ptr<const TemporalGridCellNode>& node) const
     {
-        for(std::shared_ptr<const ConstraintBase> constraint: m_constraints)
-        {
-            auto vertex_constraint = std::dynamic_pointer_cast<const VertexConstraint>(constraint);
-            if(vertex_constraint)
-            {
-                if(prune(node, vertex_constraint))
-                {
-                    return true;
-                }
-                continue;
-            }
-
-            auto edge_constraint = std::dynamic_pointer_cast<const EdgeConstraint>(constraint);
-            if(edge_constraint)
-            {
-                if(prune(node, edge_constraint))
-                {
-                    return true;
-                }
-                continue;
-            }
-            throw createLogicError("Unknown type of constraint");
-        }
-        return false;
-    }
-
-    bool PruneConstraints::prune(const std::shared_ptr<const TemporalGridCellNode>& node,
-                                 const std::shared_ptr<const EdgeConstraint>& constraint) const
-    {
-        std::shared_ptr<const TemporalGridCellNode> parent = node->parent();
-        return EdgeConstraint(parent->time(), parent->x(), parent->y(), node->x(), node->y()) == *constraint;
-    }
-
-    bool PruneConstraints::prune(const std::shared_ptr<const TemporalGridCellNode>& node,
-                                 const std::shared_ptr<const VertexConstraint>& constraint) const
-    {
-        return VertexConstraint(node->time(), node->x(), node->y()) == *constraint;
+        return m_constraints->isVertexConstrained(node->time(), node->x(), node->y()) ||
+               !m_constraints->canReachMustVisit(node->time(), node->x(), node->y());
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -23,30 +23,62 @@
 #include "grstapse/geometric_planning/mapf/cbs/low_level/space_time_a_star_with_constraints.hpp"
 
 // Local
-#include "grstapse/common/search/null_memoization.hpp"
 #include "grstapse/geometric_planning/grid/grid_cell_manhattan_distance.hpp"
+#include "grstapse/geometric_planning/grid/grid_cell_true_distance.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/constraint_table.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/low_level/grid_cell_cardinals_plus_wait_generator.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/low_level/prune_constraints.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/low_level/space_time_a_star_with_constraints_parameters.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_goal_check_with_constraints.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_memoization.hpp"
 #include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_path_cost.hpp"
 
 namespace grstapse
 {
+    namespace
+    {
+        //! \returns The true distance heuristic if \p distances are given and the manhattan distance otherwise
+        std::shared_ptr<const HeuristicBase<TemporalGridCellNode>> createHeuristic(
+            const std::shared_ptr<const GridCell>& goal,
+            const std::shared_ptr<const GridDistanceTable>& distances)
+        {
+            if(distances != nullptr)
+            {
+                return std::make_shared<const GridCellTrueDistance<TemporalGridCellNode>>(distances);
+            }
+            return std::make_shared<const GridCellManhattanDistance<TemporalGridCellNode>>(goal);
+        }
+    }  // namespace
+
     SpaceTimeAStarWithConstraints::SpaceTimeAStarWithConstraints(
         const std::shared_ptr<const SpaceTimeAStarParameters>& parameters,
         const std::shared_ptr<const GridMap>& map,
         const std::shared_ptr<const GridCell>& initial,
         const std::shared_ptr<const GridCell>& goal,
         const robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>>& constraints)
+        : SpaceTimeAStarWithConstraints(parameters,
+                                        map,
+                                        initial,
+                                        goal,
+                                        std::make_shared<const ConstraintTable>(constraints))
+    {}
+
+    SpaceTimeAStarWithConstraints::SpaceTimeAStarWithConstraints(
+        const std::shared_ptr<const SpaceTimeAStarParameters>& parameters,
+        const std::shared_ptr<const GridMap>& map,
+        const std::shared_ptr<const GridCell>& initial,
+        const std::shared_ptr<const GridCell>& goal,
+        const std::shared_ptr<const ConstraintTable>& constraints,
+        const std::shared_ptr<const GridDistanceTable>& distances)
         : Base{.parameters = parameters,
                .functors   = {.path_cost = std::make_shared<const TemporalGridCellPathCost>(),
-                              .heuristic = std::make_shared<const GridCellManhattanDistance<TemporalGridCellNode>>(goal),
-                              .successor_generator = std::make_shared<const GridCellCardinalsPlusWaitGenerator>(map),
+                              .heuristic = createHeuristic(goal, distances),
+                              .successor_generator =
+                                std::make_shared<const GridCellCardinalsPlusWaitGenerator>(map, constraints),
                               .goal_check =
-                                std::make_shared<const TemporalGridCellGoalCheckWithConstraints>(goal, constraints),
-                              .memoization    = std::make_shared<const NullMemoization<TemporalGridCellNode>>(),
-                              .pruning_method = std::make_shared<const PruneConstraints>(constraints)}}
+                                std::make_shared<const TemporalGridCellGoalCheckWithConstraints>(goal, *constraints),
+                              .memoization       = std::make_shared<const TemporalGridCellMemoization>(map),
+                              .prepruning_method = std::make_shared<const PruneConstraints>(constraints)}}
         , m_initial(initial)
     {}
 
@@ -23,26 +23,16 @@
 #include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_goal_check_with_constraints.hpp"
 
 // Local
-#include "grstapse/geometric_planning/mapf/cbs/high_level/edge_constraint.hpp"
-#include "grstapse/geometric_planning/mapf/cbs/high_level/vertex_constraint.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/constraint_table.hpp"
 
 namespace grstapse
 {
     TemporalGridCellGoalCheckWithConstraints::TemporalGridCellGoalCheckWithConstraints(
         const std::shared_ptr<const GridCell>& goal,
-        const robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>>& constraints)
+        const ConstraintTable& constraints)
         : m_goal(goal)
-        , m_latest_goal_constraint(0)
-    {
-        for(std::shared_ptr<const ConstraintBase> constraint: constraints)
-        {
-            auto vertex_constraint = std::dynamic_pointer_cast<const VertexConstraint>(constraint);
-            if(vertex_constraint && vertex_constraint->x() == m_goal->x() && vertex_constraint->y() == m_goal->y())
-            {
-                m_latest_goal_constraint = std::max(m_latest_goal_constraint, vertex_constraint->time());
-            }
-        }
-    }
+        , m_latest_goal_constraint(constraints.latestVertexConstraint(goal->x(), goal->y()))
+    {}
 
     bool TemporalGridCellGoalCheckWithConstraints::operator()(
         const std::shared_ptr<const TemporalGridCellNode>& node) const
@@ -0,0 +1,52 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_memoization.hpp"
+
+// Global
+#include <algorithm>
+#include <limits>
+// Local
+#include "grstapse/geometric_planning/grid/grid_map.hpp"
+
+namespace grstapse
+{
+    namespace
+    {
+        constexpr unsigned int k_unique_bit = 1u << (std::numeric_limits<unsigned int>::digits - 1);
+    }  // namespace
+
+    TemporalGridCellMemoization::TemporalGridCellMemoization(const std::shared_ptr<const GridMap>& map)
+        : m_width(map->width())
+        , m_num_cells(std::max(1u, map->width() * map->height()))
+        , m_horizon(k_unique_bit / m_num_cells)
+    {}
+
+    unsigned int TemporalGridCellMemoization::operator()(const std::shared_ptr<const TemporalGridCellNode>& node) const
+    {
+        if(node->time() < m_horizon)
+        {
+            return node->time() * m_num_cells + node->y() * m_width + node->x();
+        }
+        return k_unique_bit | node->id();
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -28,14 +28,14 @@
 
 namespace grstapse
 {
-    unsigned int TemporalGridCellNode::s_next_id = 0;
+    std::atomic<unsigned int> TemporalGridCellNode::s_next_id = 0;
 
     TemporalGridCellNode::TemporalGridCellNode(unsigned int time,
                                                unsigned int x,
                                                unsigned int y,
                                                const std::shared_ptr<const TemporalGridCellNode>& parent)
         : TemporalGridCell(time, x, y)
-        , AStarSearchNodeBase<TemporalGridCellNode>(s_next_id++, parent)
+        , FocalAStarSearchNodeBase<TemporalGridCellNode>(s_next_id++, parent)
     {}
 
     unsigned int TemporalGridCellNode::hash() const
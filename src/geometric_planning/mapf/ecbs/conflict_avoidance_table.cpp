@@ -0,0 +1,101 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/geometric_planning/mapf/ecbs/conflict_avoidance_table.hpp"
+
+// External
+#include <boost/functional/hash.hpp>
+// Local
+#include "grstapse/geometric_planning/mapf/grid_path.hpp"
+
+namespace grstapse
+{
+    void ConflictAvoidanceTable::addPath(const GridPath& path)
+    {
+        if(path.size() == 0)
+        {
+            return;
+        }
+
+        // The last state is stored separately as the robot stays there once it has finished
+        for(unsigned int t = 0; t + 1 < path.size(); ++t)
+        {
+            const uint64_t from = path.cell(t);
+            const uint64_t to   = path.cell(t + 1);
+            ++m_vertices[VertexKey(t, from)];
+            if(from != to)
+            {
+                ++m_edges[EdgeKey(VertexKey(t, from), to)];
+            }
+        }
+        m_finished[path.back()].push_back(path.size() - 1);
+    }
+
+    unsigned int ConflictAvoidanceTable::numVertexConflicts(const unsigned int time,
+                                                            const unsigned int x,
+                                                            const unsigned int y) const
+    {
+        const uint64_t cell = GridPath::pack(x, y);
+        unsigned int rv     = 0;
+        if(auto itr = m_vertices.find(VertexKey(time, cell)); itr != m_vertices.end())
+        {
+            rv += itr->second;
+        }
+        if(auto itr = m_finished.find(cell); itr != m_finished.end())
+        {
+            for(const unsigned int finished: itr->second)
+            {
+                rv += finished <= time;
+            }
+        }
+        return rv;
+    }
+
+    unsigned int ConflictAvoidanceTable::numEdgeConflicts(const unsigned int time,
+                                                          const unsigned int x1,
+                                                          const unsigned int y1,
+                                                          const unsigned int x2,
+                                                          const unsigned int y2) const
+    {
+        const EdgeKey reverse(VertexKey(time, GridPath::pack(x2, y2)), GridPath::pack(x1, y1));
+        if(auto itr = m_edges.find(reverse); itr != m_edges.end())
+        {
+            return itr->second;
+        }
+        return 0;
+    }
+
+    std::size_t ConflictAvoidanceTable::VertexKeyHash::operator()(const VertexKey& key) const
+    {
+        std::size_t seed = 0;
+        boost::hash_combine(seed, key.first);
+        boost::hash_combine(seed, key.second);
+        return seed;
+    }
+
+    std::size_t ConflictAvoidanceTable::EdgeKeyHash::operator()(const EdgeKey& key) const
+    {
+        std::size_t seed = VertexKeyHash()(key.first);
+        boost::hash_combine(seed, key.second);
+        return seed;
+    }
+}  // namespace grstapse
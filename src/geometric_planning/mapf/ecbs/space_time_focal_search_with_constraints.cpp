@@ -0,0 +1,84 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/geometric_planning/mapf/ecbs/space_time_focal_search_with_constraints.hpp"
+
+// Local
+#include "grstapse/geometric_planning/grid/grid_cell_manhattan_distance.hpp"
+#include "grstapse/geometric_planning/grid/grid_cell_true_distance.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/constraint_table.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/grid_cell_cardinals_plus_wait_generator.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/prune_constraints.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_goal_check_with_constraints.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_memoization.hpp"
+#include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_path_cost.hpp"
+#include "grstapse/geometric_planning/mapf/ecbs/conflict_avoidance_table.hpp"
+#include "grstapse/geometric_planning/mapf/ecbs/temporal_grid_cell_conflict_count.hpp"
+
+namespace grstapse
+{
+    namespace
+    {
+        //! \returns The true distance heuristic if \p distances are given and the manhattan distance otherwise
+        std::shared_ptr<const HeuristicBase<TemporalGridCellNode>> createHeuristic(
+            const std::shared_ptr<const GridCell>& goal,
+            const std::shared_ptr<const GridDistanceTable>& distances)
+        {
+            if(distances != nullptr)
+            {
+                return std::make_shared<const GridCellTrueDistance<TemporalGridCellNode>>(distances);
+            }
+            return std::make_shared<const GridCellManhattanDistance<TemporalGridCellNode>>(goal);
+        }
+    }  // namespace
+
+    SpaceTimeFocalSearchWithConstraints::SpaceTimeFocalSearchWithConstraints(
+        const std::shared_ptr<const FocalAStarParameters>& parameters,
+        const std::shared_ptr<const GridMap>& map,
+        const std::shared_ptr<const GridCell>& initial,
+        const std::shared_ptr<const GridCell>& goal,
+        const std::shared_ptr<const ConstraintTable>& constraints,
+        const std::shared_ptr<const ConflictAvoidanceTable>& conflict_avoidance_table,
+        const std::shared_ptr<const GridDistanceTable>& distances)
+        : Base(parameters,
+               FocalAStarFunctors<TemporalGridCellNode>(
+                   std::make_shared<const TemporalGridCellPathCost>(),
+                   createHeuristic(goal, distances),
+                   std::make_shared<const TemporalGridCellConflictCount>(conflict_avoidance_table),
+                   std::make_shared<const GridCellCardinalsPlusWaitGenerator>(map, constraints),
+                   std::make_shared<const TemporalGridCellGoalCheckWithConstraints>(goal, *constraints),
+                   std::make_shared<const TemporalGridCellMemoization>(map),
+                   std::make_shared<const PruneConstraints>(constraints)))
+        , m_initial(initial)
+        , m_conflict_avoidance_table(conflict_avoidance_table)
+    {}
+
+    std::shared_ptr<TemporalGridCellNode> SpaceTimeFocalSearchWithConstraints::createRootNode()
+    {
+        auto root = std::make_shared<TemporalGridCellNode>(0, m_initial->x(), m_initial->y(), nullptr);
+        root->setG(0);
+        root->setH(0);
+        root->setFocalH(
+            static_cast<float>(m_conflict_avoidance_table->numVertexConflicts(0, m_initial->x(), m_initial->y())));
+        return root;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,52 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/geometric_planning/mapf/ecbs/temporal_grid_cell_conflict_count.hpp"
+
+// Local
+#include "grstapse/geometric_planning/mapf/ecbs/conflict_avoidance_table.hpp"
+
+namespace grstapse
+{
+    TemporalGridCellConflictCount::TemporalGridCellConflictCount(
+        const std::shared_ptr<const ConflictAvoidanceTable>& table)
+        : m_table(table)
+    {}
+
+    float TemporalGridCellConflictCount::computeStateHeuristic(const std::shared_ptr<TemporalGridCellNode>& node) const
+    {
+        const float parent_conflicts = node->parent() != nullptr ? node->parent()->focalH() : 0.0f;
+        return parent_conflicts + static_cast<float>(m_table->numVertexConflicts(node->time(), node->x(), node->y()));
+    }
+
+    float TemporalGridCellConflictCount::computeTransitionHeuristic(
+        const std::shared_ptr<TemporalGridCellNode>& node) const
+    {
+        const std::shared_ptr<const TemporalGridCellNode>& parent = node->parent();
+        if(parent == nullptr || (parent->x() == node->x() && parent->y() == node->y()))
+        {
+            return 0.0f;
+        }
+        return static_cast<float>(
+            m_table->numEdgeConflicts(parent->time(), parent->x(), parent->y(), node->x(), node->y()));
+    }
+}  // namespace grstapse
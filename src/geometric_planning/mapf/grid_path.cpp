@@ -0,0 +1,50 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/geometric_planning/mapf/grid_path.hpp"
+
+// Global
+#include <utility>
+
+// Local
+#include "grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_node.hpp"
+
+namespace grstapse
+{
+    GridPath::GridPath(const std::shared_ptr<const TemporalGridCellNode>& leaf)
+    {
+        // The time of the leaf is its index so the array is sized once and filled from the back
+        if(leaf == nullptr)
+        {
+            return;
+        }
+        m_cells.resize(leaf->time() + 1);
+        for(const TemporalGridCellNode* node = leaf.get(); node != nullptr; node = node->parent().get())
+        {
+            m_cells[node->time()] = pack(node->x(), node->y());
+        }
+    }
+
+    GridPath::GridPath(std::vector<uint64_t> cells)
+        : m_cells(std::move(cells))
+    {}
+}  // namespace grstapse
\ No newline at end of file
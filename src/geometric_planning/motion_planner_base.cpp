@@ -30,7 +30,7 @@
 
 namespace grstapse
 {
-    unsigned int MotionPlannerBase::s_num_failures = 0;
+    std::atomic<unsigned int> MotionPlannerBase::s_num_failures = 0;
 
     MotionPlannerBase::MotionPlannerBase(const std::shared_ptr<const MotionPlannerParametersBase>& parameters,
                                          const std::shared_ptr<EnvironmentBase>& environment)
@@ -52,10 +52,18 @@ namespace grstapse
         }
 
         // Compute and memoize
+        // Note: the lock is not held while computing so that queries can run concurrently (two threads may race to
+        //       compute the same query, in which case the first memoized result is kept)
         std::shared_ptr<const MotionPlanningQueryResultBase> result =
             computeMotionPlan(species, initial_configuration, goal_configuration);
-        auto iter = m_memoization.insert(
-            std::pair(species, std::make_tuple(initial_configuration, goal_configuration, result)));
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(std::shared_ptr<const MotionPlanningQueryResultBase> memoized =
+               findMemoized(species, initial_configuration, goal_configuration);
+           memoized != nullptr)
+        {
+            return memoized;
+        }
+        m_memoization.insert(std::pair(species, std::make_tuple(initial_configuration, goal_configuration, result)));
         return result;
     }
 
@@ -72,10 +80,26 @@ namespace grstapse
         return -1.0f;
     }
 
+    bool MotionPlannerBase::isMemoized(const std::shared_ptr<const Species>& species,
+                                       const std::shared_ptr<const ConfigurationBase>& initial_configuration,
+                                       const std::shared_ptr<const ConfigurationBase>& goal_configuration) const
+    {
+        return getMemoized(species, initial_configuration, goal_configuration) != nullptr;
+    }
+
     std::shared_ptr<const MotionPlanningQueryResultBase> MotionPlannerBase::getMemoized(
         const std::shared_ptr<const Species>& species,
         const std::shared_ptr<const ConfigurationBase>& initial_configuration,
         const std::shared_ptr<const ConfigurationBase>& goal_configuration) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return findMemoized(species, initial_configuration, goal_configuration);
+    }
+
+    std::shared_ptr<const MotionPlanningQueryResultBase> MotionPlannerBase::findMemoized(
+        const std::shared_ptr<const Species>& species,
+        const std::shared_ptr<const ConfigurationBase>& initial_configuration,
+        const std::shared_ptr<const ConfigurationBase>& goal_configuration) const
     {
         if(!m_memoization.contains(species))
         {
@@ -107,6 +131,7 @@ namespace grstapse
 
     void MotionPlannerBase::clearCache()
     {
+        std::lock_guard<std::mutex> lock(m_mutex);
         m_memoization.clear();
     }
 }  // namespace grstapse
\ No newline at end of file
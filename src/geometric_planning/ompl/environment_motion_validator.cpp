@@ -0,0 +1,130 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/geometric_planning/ompl/environment_motion_validator.hpp"
+
+// External
+#include <ompl/base/SpaceInformation.h>
+// Local
+#include "grstapse/geometric_planning/ompl/ompl_environment.hpp"
+
+namespace grstapse
+{
+    EnvironmentMotionValidator::EnvironmentMotionValidator(
+        const ompl::base::SpaceInformationPtr& space_information,
+        const std::shared_ptr<const OmplEnvironment>& environment,
+        const std::shared_ptr<const Species>& species)
+        : ompl::base::MotionValidator(space_information)
+        , m_environment(environment)
+        , m_species(species)
+    {}
+
+    bool EnvironmentMotionValidator::checkMotion(const ompl::base::State* s1, const ompl::base::State* s2) const
+    {
+        if(!si_->isValid(s2))
+        {
+            ++invalid_;
+            return false;
+        }
+
+        if(m_environment->isMotionFree(s1, s2, *m_species) || checkInterior(s1, s2))
+        {
+            ++valid_;
+            return true;
+        }
+        ++invalid_;
+        return false;
+    }
+
+    bool EnvironmentMotionValidator::checkMotion(const ompl::base::State* s1,
+                                                 const ompl::base::State* s2,
+                                                 std::pair<ompl::base::State*, double>& last_valid) const
+    {
+        const ompl::base::StateSpacePtr& state_space = si_->getStateSpace();
+        const unsigned int num_segments              = state_space->validSegmentCount(s1, s2);
+
+        bool result = true;
+        if(num_segments > 1 && !m_environment->isMotionFree(s1, s2, *m_species))
+        {
+            ompl::base::State* test = si_->allocState();
+            for(unsigned int j = 1; j < num_segments; ++j)
+            {
+                state_space->interpolate(s1, s2, static_cast<double>(j) / num_segments, test);
+                if(!si_->isValid(test))
+                {
+                    last_valid.second = static_cast<double>(j - 1) / num_segments;
+                    if(last_valid.first != nullptr)
+                    {
+                        state_space->interpolate(s1, s2, last_valid.second, last_valid.first);
+                    }
+                    result = false;
+                    break;
+                }
+            }
+            si_->freeState(test);
+        }
+
+        if(result && !si_->isValid(s2))
+        {
+            last_valid.second = static_cast<double>(num_segments - 1) / num_segments;
+            if(last_valid.first != nullptr)
+            {
+                state_space->interpolate(s1, s2, last_valid.second, last_valid.first);
+            }
+            result = false;
+        }
+
+        if(result)
+        {
+            ++valid_;
+        }
+        else
+        {
+            ++invalid_;
+        }
+        return result;
+    }
+
+    bool EnvironmentMotionValidator::checkInterior(const ompl::base::State* s1, const ompl::base::State* s2) const
+    {
+        const ompl::base::StateSpacePtr& state_space = si_->getStateSpace();
+        const unsigned int num_segments              = state_space->validSegmentCount(s1, s2);
+        if(num_segments <= 1)
+        {
+            return true;
+        }
+
+        bool result             = true;
+        ompl::base::State* test = si_->allocState();
+        for(unsigned int j = 1; j < num_segments; ++j)
+        {
+            state_space->interpolate(s1, s2, static_cast<double>(j) / num_segments, test);
+            if(!si_->isValid(test))
+            {
+                result = false;
+                break;
+            }
+        }
+        si_->freeState(test);
+        return result;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -29,7 +29,10 @@
 #include "grstapse/common/utilities/custom_json_conversions.hpp"
 #include "grstapse/common/utilities/error.hpp"
 #include "grstapse/common/utilities/json_field_validator.hpp"
+#include "grstapse/geometric_planning/ompl/quadtree_environment.hpp"
+#include "grstapse/geometric_planning/ompl/voxel_environment.hpp"
 #include "grstapse/geometric_planning/pgm_environment.hpp"
+#include "grstapse/species.hpp"
 
 namespace grstapse
 {
@@ -41,6 +44,25 @@ namespace grstapse
         , m_state_space_type(state_space_type)
     {}
 
+    bool OmplEnvironment::isValid(const ompl::base::State* state) const
+    {
+        return isValid(state, *m_species);
+    }
+
+    bool OmplEnvironment::isMotionFree(const ompl::base::State* from,
+                                       const ompl::base::State* to,
+                                       const Species& species) const
+    {
+        return false;
+    }
+
+    std::shared_ptr<ompl::base::MotionValidator> OmplEnvironment::createMotionValidator(
+        const ompl::base::SpaceInformationPtr& space_information,
+        const std::shared_ptr<const Species>& species) const
+    {
+        return nullptr;
+    }
+
     std::shared_ptr<OmplEnvironment> OmplEnvironment::deserializeFromJson(const nlohmann::json& j)
     {
         validate(j, {{constants::k_environment_type, nlohmann::json::value_t::string}});
@@ -51,6 +73,14 @@ namespace grstapse
             {
                 return j.get<std::shared_ptr<PgmEnvironment>>();
             }
+            case OmplEnvironmentType::e_quadtree:
+            {
+                return j.get<std::shared_ptr<QuadtreeEnvironment>>();
+            }
+            case OmplEnvironmentType::e_voxel:
+            {
+                return j.get<std::shared_ptr<VoxelEnvironment>>();
+            }
             default:
             {
                 throw createLogicError(fmt::format("Unknown environment type: {0:s}",
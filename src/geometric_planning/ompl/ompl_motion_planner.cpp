@@ -22,7 +22,16 @@
  */
 #include "grstapse/geometric_planning/ompl/ompl_motion_planner.hpp"
 
+// Global
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
 // External
+#include <fmt/format.h>
+#include <ompl/base/PlannerData.h>
+#include <ompl/base/PlannerDataStorage.h>
+#include <ompl/base/PlannerTerminationCondition.h>
 #include <ompl/base/terminationconditions/CostConvergenceTerminationCondition.h>
 #include <ompl/geometric/planners/prm/LazyPRM.h>
 #include <ompl/geometric/planners/prm/LazyPRMstar.h>
@@ -39,126 +48,259 @@
 #include "grstapse/geometric_planning/ompl/ompl_configuration.hpp"
 #include "grstapse/geometric_planning/ompl/ompl_environment.hpp"
 #include "grstapse/geometric_planning/ompl/ompl_motion_planner_parameters.hpp"
+#include "grstapse/geometric_planning/ompl/species_validity_checker.hpp"
 
 namespace grstapse {
     OmplMotionPlanner::OmplMotionPlanner(OmplMotionPlannerType ompl_motion_planner_type,
                                          const std::shared_ptr<const OmplMotionPlannerParameters> &parameters,
                                          const std::shared_ptr<OmplEnvironment> &environment)
-            : MotionPlannerBase(parameters, environment), m_simple_setup(nullptr),
-              m_ompl_motion_planner_type(ompl_motion_planner_type) {
+            : MotionPlannerBase(parameters, environment), m_ompl_motion_planner_type(ompl_motion_planner_type),
+              m_space_information(nullptr), m_fingerprint(0) {
         ompl::msg::noOutputHandler();
 
-        // Simple Setup
-        auto ompl_environment = std::dynamic_pointer_cast<OmplEnvironment>(m_environment);
-        m_simple_setup = std::make_unique<ompl::geometric::SimpleSetup>(ompl_environment->stateSpace());
-        m_simple_setup->setStateValidityChecker(ompl_environment);
-        std::shared_ptr<ompl::base::Planner> motion_planner;
-        switch (ompl_motion_planner_type) {
-            case OmplMotionPlannerType::e_prm: {
-                motion_planner = std::make_shared<ompl::geometric::PRM>(m_simple_setup->getSpaceInformation());
-                break;
-            }
-            case OmplMotionPlannerType::e_prm_star: {
-                motion_planner = std::make_shared<ompl::geometric::PRMstar>(m_simple_setup->getSpaceInformation());
-                break;
-            }
-            case OmplMotionPlannerType::e_lazy_prm: {
-                motion_planner = std::make_shared<ompl::geometric::LazyPRM>(m_simple_setup->getSpaceInformation());
-                break;
-            }
-            case OmplMotionPlannerType::e_lazy_prm_star: {
-                motion_planner = std::make_shared<ompl::geometric::LazyPRMstar>(m_simple_setup->getSpaceInformation());
-                break;
-            }
-            case OmplMotionPlannerType::e_rrt: {
-                motion_planner = std::make_shared<ompl::geometric::RRT>(m_simple_setup->getSpaceInformation());
-                break;
-            }
-            case OmplMotionPlannerType::e_rrt_star: {
-                motion_planner = std::make_shared<ompl::geometric::RRTstar>(m_simple_setup->getSpaceInformation());
-                break;
-            }
-            case OmplMotionPlannerType::e_parallel_rrt: {
-                motion_planner = std::make_shared<ompl::geometric::pRRT>(m_simple_setup->getSpaceInformation());
-                break;
-            }
-            case OmplMotionPlannerType::e_rrt_connect: {
-                motion_planner = std::make_shared<ompl::geometric::RRTConnect>(m_simple_setup->getSpaceInformation());
-                break;
-            }
-            case OmplMotionPlannerType::e_lazy_rrt: {
-                motion_planner = std::make_shared<ompl::geometric::LazyRRT>(m_simple_setup->getSpaceInformation());
-                break;
-            }
-            default: {
-                throw createLogicError("Unknown motion planner type");
-            }
+        if (m_ompl_motion_planner_type == OmplMotionPlannerType::e_unknown) {
+            throw createLogicError("Unknown motion planner type");
         }
-        m_simple_setup->setPlanner(motion_planner);
+        if (parameters->reuse_roadmap && m_ompl_motion_planner_type != OmplMotionPlannerType::e_prm &&
+            m_ompl_motion_planner_type != OmplMotionPlannerType::e_prm_star) {
+            throw createLogicError("Roadmap reuse is only supported by PRM and PRM*");
+        }
+
+        auto ompl_environment = std::dynamic_pointer_cast<OmplEnvironment>(m_environment);
+        m_space_information = std::make_shared<ompl::base::SpaceInformation>(ompl_environment->stateSpace());
+        m_space_information->setStateValidityChecker(ompl_environment);
+        m_space_information->setup();
     }
 
-    const std::shared_ptr<ompl::base::SpaceInformation> &OmplMotionPlanner::spaceInformation() const {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        return m_simple_setup->getSpaceInformation();
+    unsigned int OmplMotionPlanner::numIdlePlanners() const {
+        std::lock_guard<std::mutex> lock(m_pool_mutex);
+        unsigned int num_idle = 0;
+        for (const auto &[species_id, simple_setups]: m_idle_simple_setups) {
+            num_idle += simple_setups.size();
+        }
+        return num_idle;
     }
 
     std::shared_ptr<const MotionPlanningQueryResultBase> OmplMotionPlanner::computeMotionPlan(
             const std::shared_ptr<const Species> &species,
             const std::shared_ptr<const ConfigurationBase> &initial_configuration,
             const std::shared_ptr<const ConfigurationBase> &goal_configuration) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (!m_simple_setup) {
-            throw createLogicError("Motion planning not initialized");
-        }
-
         const auto initial_configuration_ompl =
                 std::dynamic_pointer_cast<const OmplConfiguration>(initial_configuration);
         const auto goal_configuration_ompl = std::dynamic_pointer_cast<const OmplConfiguration>(goal_configuration);
 
-        // Clears internal from previous query
-        m_simple_setup->getPlanner()->clearQuery();
-        m_simple_setup->getProblemDefinition()->clearSolutionPaths();
-
-        // Set start and goal
+        // All the planner instances share the state space
         ompl::base::ScopedStatePtr scoped_initial_state =
-                initial_configuration_ompl->convertToScopedStatePtr(m_simple_setup->getStateSpace());
+                initial_configuration_ompl->convertToScopedStatePtr(m_space_information->getStateSpace());
         if (!scoped_initial_state->satisfiesBounds()) {
             throw createLogicError("Initial state doesn't respect the bounds of the state space");
         }
-        m_simple_setup->setStartState(*scoped_initial_state);
-        m_simple_setup->setGoal(goal_configuration_ompl->convertToGoalPtr(m_simple_setup->getSpaceInformation()));
 
-        // Set the radius of the robot
-        m_environment->lock();
-        m_environment->setSpecies(species);
+        std::unique_ptr<ompl::geometric::SimpleSetup> simple_setup = acquireSimpleSetup(species);
+
+        // Clears internal from previous query
+        simple_setup->getPlanner()->clearQuery();
+        simple_setup->getProblemDefinition()->clearSolutionPaths();
+
+        // Set start and goal
+        simple_setup->setStartState(*scoped_initial_state);
+        simple_setup->setGoal(goal_configuration_ompl->convertToGoalPtr(simple_setup->getSpaceInformation()));
+
         const auto &ompl_mp_parameters = std::dynamic_pointer_cast<const OmplMotionPlannerParameters>(m_parameters);
-        const ompl::base::PlannerStatus status = m_simple_setup->solve(ompl::base::plannerOrTerminationCondition(
-                ompl::base::timedPlannerTerminationCondition(ompl_mp_parameters->timeout),
-                ompl::base::CostConvergenceTerminationCondition(m_simple_setup->getProblemDefinition(),
-                                                                ompl_mp_parameters->solutions_window,
-                                                                ompl_mp_parameters->convergence_epislon)));
-
-        if (m_simple_setup->haveSolutionPath()) {
-            if (std::dynamic_pointer_cast<const OmplMotionPlannerParameters>(m_parameters)->simplify_path) {
-                m_simple_setup->simplifySolution(
-                        std::dynamic_pointer_cast<const OmplMotionPlannerParameters>(
-                                m_parameters)->simplify_path_timeout);
-            }
-            // Clear the species from the environment
-            m_environment->setSpecies(nullptr);
-            m_environment->unlock();
-            const ompl::geometric::PathGeometric &path = m_simple_setup->getSolutionPath();
+        if (ompl_mp_parameters->reuse_roadmap) {
+            // The first solution is the shortest path on the roadmap
+            simple_setup->solve(ompl::base::plannerOrTerminationCondition(
+                    ompl::base::timedPlannerTerminationCondition(ompl_mp_parameters->timeout),
+                    ompl::base::exactSolnPlannerTerminationCondition(simple_setup->getProblemDefinition())));
+        } else {
+            simple_setup->solve(ompl::base::plannerOrTerminationCondition(
+                    ompl::base::timedPlannerTerminationCondition(ompl_mp_parameters->timeout),
+                    ompl::base::CostConvergenceTerminationCondition(simple_setup->getProblemDefinition(),
+                                                                    ompl_mp_parameters->solutions_window,
+                                                                    ompl_mp_parameters->convergence_epislon)));
+        }
+
+        std::shared_ptr<const MotionPlanningQueryResultBase> result;
+        if (simple_setup->haveSolutionPath()) {
+            if (ompl_mp_parameters->simplify_path) {
+                simple_setup->simplifySolution(ompl_mp_parameters->simplify_path_timeout);
+            }
+            const ompl::geometric::PathGeometric &path = simple_setup->getSolutionPath();
             auto path_ptr = std::make_shared<const ompl::geometric::PathGeometric>(path);
-            return std::make_shared<const OmplMotionPlanningQueryResult>(MotionPlannerQueryStatus::e_success, path_ptr);
+            result = std::make_shared<const OmplMotionPlanningQueryResult>(MotionPlannerQueryStatus::e_success,
+                                                                           path_ptr);
         } else {
-            // Clear the species from the environment
-            m_environment->setSpecies(nullptr);
-            m_environment->unlock();
             ++s_num_failures;
 #if DEBUG
             Logger::debug("Motion planning exceeded the time threshold");
 #endif
-            return std::make_shared<const OmplMotionPlanningQueryResult>(MotionPlannerQueryStatus::e_timeout, nullptr);
+            result = std::make_shared<const OmplMotionPlanningQueryResult>(MotionPlannerQueryStatus::e_timeout,
+                                                                           nullptr);
+        }
+
+        releaseSimpleSetup(species, std::move(simple_setup));
+        return result;
+    }
+
+    std::unique_ptr<ompl::geometric::SimpleSetup> OmplMotionPlanner::acquireSimpleSetup(
+            const std::shared_ptr<const Species> &species) {
+        {
+            std::lock_guard<std::mutex> lock(m_pool_mutex);
+            if (auto iter = m_idle_simple_setups.find(species->id());
+                    iter != m_idle_simple_setups.end() && !iter->second.empty()) {
+                std::unique_ptr<ompl::geometric::SimpleSetup> simple_setup = std::move(iter->second.back());
+                iter->second.pop_back();
+                return simple_setup;
+            }
+        }
+
+        // Note: created outside of the lock so that growing or loading a roadmap does not block other queries
+        return createSimpleSetup(species);
+    }
+
+    void OmplMotionPlanner::releaseSimpleSetup(const std::shared_ptr<const Species> &species,
+                                               std::unique_ptr<ompl::geometric::SimpleSetup> &&simple_setup) {
+        std::lock_guard<std::mutex> lock(m_pool_mutex);
+        m_idle_simple_setups[species->id()].push_back(std::move(simple_setup));
+    }
+
+    std::unique_ptr<ompl::geometric::SimpleSetup> OmplMotionPlanner::createSimpleSetup(
+            const std::shared_ptr<const Species> &species) {
+        auto ompl_environment = std::dynamic_pointer_cast<const OmplEnvironment>(m_environment);
+        auto simple_setup = std::make_unique<ompl::geometric::SimpleSetup>(ompl_environment->stateSpace());
+        simple_setup->setStateValidityChecker(std::make_shared<SpeciesValidityChecker>(
+                simple_setup->getSpaceInformation(), ompl_environment, species));
+        if (auto motion_validator =
+                    ompl_environment->createMotionValidator(simple_setup->getSpaceInformation(), species);
+            motion_validator != nullptr) {
+            simple_setup->getSpaceInformation()->setMotionValidator(motion_validator);
+        }
+        if (std::dynamic_pointer_cast<const OmplMotionPlannerParameters>(m_parameters)->reuse_roadmap) {
+            setupRoadmapPlanner(*simple_setup, species);
+        } else {
+            simple_setup->setPlanner(createPlanner(simple_setup->getSpaceInformation()));
+            setup(*simple_setup);
+        }
+        return simple_setup;
+    }
+
+    void OmplMotionPlanner::setupRoadmapPlanner(ompl::geometric::SimpleSetup &simple_setup,
+                                                const std::shared_ptr<const Species> &species) {
+        const auto &ompl_mp_parameters = std::dynamic_pointer_cast<const OmplMotionPlannerParameters>(m_parameters);
+        const bool star_strategy = m_ompl_motion_planner_type == OmplMotionPlannerType::e_prm_star;
+        const std::shared_ptr<ompl::base::SpaceInformation> &space_information = simple_setup.getSpaceInformation();
+
+        std::shared_ptr<Roadmap> roadmap;
+        {
+            std::lock_guard<std::mutex> lock(m_pool_mutex);
+            std::shared_ptr<Roadmap> &entry = m_roadmaps[species->boundingRadius()];
+            if (entry == nullptr) {
+                entry = std::make_shared<Roadmap>();
+            }
+            roadmap = entry;
+        }
+
+        // Load or grow (and then save) the roadmap
+        bool grown = false;
+        std::call_once(roadmap->loaded, [&]() {
+            const std::string filepath = ompl_mp_parameters->roadmap_directory.empty()
+                                         ? std::string()
+                                         : roadmapFilepath(species->boundingRadius());
+            if (!filepath.empty()) {
+                std::ifstream in(filepath, std::ios::binary);
+                if (in) {
+                    roadmap->data.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+                }
+            }
+            if (!roadmap->data.empty()) {
+                return;
+            }
+
+            auto prm = std::make_shared<ompl::geometric::PRM>(space_information, star_strategy);
+            simple_setup.setPlanner(prm);
+            setup(simple_setup);
+            prm->growRoadmap(ompl_mp_parameters->roadmap_construction_time);
+            grown = true;
+
+            ompl::base::PlannerData planner_data(space_information);
+            prm->getPlannerData(planner_data);
+            std::ostringstream out;
+            ompl::base::PlannerDataStorage().store(planner_data, out);
+            roadmap->data = out.str();
+
+            if (!filepath.empty()) {
+                std::filesystem::create_directories(ompl_mp_parameters->roadmap_directory);
+                std::ofstream file(filepath, std::ios::binary);
+                if (!file) {
+                    throw createLogicError(fmt::format("Unable to save roadmap to '{0:s}'", filepath));
+                }
+                file << roadmap->data;
+            }
+        });
+        if (grown) {
+            return;
+        }
+
+        // Copy the existing roadmap
+        ompl::base::PlannerData planner_data(space_information);
+        std::istringstream in(roadmap->data);
+        ompl::base::PlannerDataStorage().load(in, planner_data);
+        simple_setup.setPlanner(std::make_shared<ompl::geometric::PRM>(planner_data, star_strategy));
+        setup(simple_setup);
+    }
+
+    std::string OmplMotionPlanner::roadmapFilepath(const float bounding_radius) const {
+        const auto &ompl_mp_parameters = std::dynamic_pointer_cast<const OmplMotionPlannerParameters>(m_parameters);
+
+        // Note: fingerprinting hashes the whole map, and the map is read-only
+        std::call_once(m_fingerprint_flag, [this]() {
+            m_fingerprint = std::dynamic_pointer_cast<const OmplEnvironment>(m_environment)->fingerprint();
+        });
+        return fmt::format("{0:s}/{1:016x}_{2:s}_{3:.6f}.roadmap",
+                           ompl_mp_parameters->roadmap_directory,
+                           m_fingerprint,
+                           nlohmann::json(m_ompl_motion_planner_type).get<std::string>(),
+                           bounding_radius);
+    }
+
+    void OmplMotionPlanner::setup(ompl::geometric::SimpleSetup &simple_setup) {
+        std::lock_guard<std::mutex> lock(m_setup_mutex);
+        simple_setup.setup();
+    }
+
+    std::shared_ptr<ompl::base::Planner> OmplMotionPlanner::createPlanner(
+            const std::shared_ptr<ompl::base::SpaceInformation> &space_information) const {
+        switch (m_ompl_motion_planner_type) {
+            case OmplMotionPlannerType::e_prm: {
+                return std::make_shared<ompl::geometric::PRM>(space_information);
+            }
+            case OmplMotionPlannerType::e_prm_star: {
+                return std::make_shared<ompl::geometric::PRMstar>(space_information);
+            }
+            case OmplMotionPlannerType::e_lazy_prm: {
+                return std::make_shared<ompl::geometric::LazyPRM>(space_information);
+            }
+            case OmplMotionPlannerType::e_lazy_prm_star: {
+                return std::make_shared<ompl::geometric::LazyPRMstar>(space_information);
+            }
+            case OmplMotionPlannerType::e_rrt: {
+                return std::make_shared<ompl::geometric::RRT>(space_information);
+            }
+            case OmplMotionPlannerType::e_rrt_star: {
+                return std::make_shared<ompl::geometric::RRTstar>(space_information);
+            }
+            case OmplMotionPlannerType::e_parallel_rrt: {
+                return std::make_shared<ompl::geometric::pRRT>(space_information);
+            }
+            case OmplMotionPlannerType::e_rrt_connect: {
+                return std::make_shared<ompl::geometric::RRTConnect>(space_information);
+            }
+            case OmplMotionPlannerType::e_lazy_rrt: {
+                return std::make_shared<ompl::geometric::LazyRRT>(space_information);
+            }
+            default: {
+                throw createLogicError("Unknown motion planner type");
+            }
         }
     }
 }  // namespace grstapse
\ No newline at end of file
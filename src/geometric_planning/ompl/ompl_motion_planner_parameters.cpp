@@ -35,6 +35,8 @@ namespace grstapse
         , connection_range(0.1f)
         , solutions_window(10)
         , convergence_epislon(0.1)
+        , reuse_roadmap(false)
+        , roadmap_construction_time(1.0f)
     {}
 
     OmplMotionPlannerParameters::OmplMotionPlannerParameters(const float timeout,
@@ -49,6 +51,8 @@ namespace grstapse
         , connection_range(connection_range)
         , solutions_window(solutions_window)
         , convergence_epislon(convergence_epislon)
+        , reuse_roadmap(false)
+        , roadmap_construction_time(1.0f)
     {}
 
     std::shared_ptr<const OmplMotionPlannerParameters> OmplMotionPlannerParameters::loadJson(const nlohmann::json& j)
@@ -71,6 +75,18 @@ namespace grstapse
         {
             j.at(constants::k_convergence_epislon).get_to(rv->convergence_epislon);
         }
+        if(j.contains(constants::k_reuse_roadmap))
+        {
+            j.at(constants::k_reuse_roadmap).get_to(rv->reuse_roadmap);
+        }
+        if(j.contains(constants::k_roadmap_construction_time))
+        {
+            j.at(constants::k_roadmap_construction_time).get_to(rv->roadmap_construction_time);
+        }
+        if(j.contains(constants::k_roadmap_directory))
+        {
+            j.at(constants::k_roadmap_directory).get_to(rv->roadmap_directory);
+        }
         rv->internalLoadJson(j);
         return rv;
     }
@@ -22,21 +22,34 @@
  */
 #include "grstapse/geometric_planning/pgm_environment.hpp"
 
+// Global
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <queue>
 // External
 #include <ompl/base/spaces/DubinsStateSpace.h>
 #include <ompl/base/spaces/SE2StateSpace.h>
 #include <yaml-cpp/yaml.h>
 // Local
 #include "grstapse/common/utilities/constants.hpp"
+#include "grstapse/common/utilities/distance_transform.hpp"
 #include "grstapse/common/utilities/json_field_validator.hpp"
 #include "grstapse/common/utilities/logger.hpp"
+#include "grstapse/common/utilities/pgm_registry.hpp"
 #include "grstapse/geometric_planning/ompl/ompl_enums.hpp"
 #include "grstapse/species.hpp"
 
 namespace grstapse
 {
     PgmEnvironment::PgmEnvironment()
-        : OmplEnvironment{.environment_type = OmplEnvironmentType::e_pgm, .state_space_type = OmplStateSpaceType::e_se2}
+        : PgmEnvironment(OmplEnvironmentType::e_pgm)
+    {}
+
+    PgmEnvironment::PgmEnvironment(const OmplEnvironmentType environment_type)
+        : OmplEnvironment{.environment_type = environment_type, .state_space_type = OmplStateSpaceType::e_se2}
     {
         m_state_space = std::make_shared<ompl::base::SE2StateSpace>();
     }
@@ -50,7 +63,7 @@ namespace grstapse
         , m_origin_x(origin_x)
         , m_origin_y(origin_y)
     {
-        m_pgm.loadFile(filepath.c_str());
+        m_pgm = PgmRegistry::instance().load(filepath);
 
         m_state_space = std::make_shared<ompl::base::SE2StateSpace>();
         ompl::base::RealVectorBounds bounds(2);
@@ -59,17 +72,17 @@ namespace grstapse
         m_state_space->as<ompl::base::SE2StateSpace>()->setBounds(bounds);
     }
 
-    bool PgmEnvironment::isValid(const ompl::base::State* state) const
+    bool PgmEnvironment::isValid(const ompl::base::State* state, const Species& species) const
     {
-        const auto [cx, cy] = toCell(state->as<ompl::base::RealVectorStateSpace::StateType>()->values[0],
-                                     state->as<ompl::base::RealVectorStateSpace::StateType>()->values[1]);
+        const auto* se2_state = state->as<ompl::base::SE2StateSpace::StateType>();
+        const auto [cx, cy]   = toCell(se2_state->getX(), se2_state->getY());
 
-        const int cr = static_cast<int>(m_species->boundingRadius() / m_resolution);
+        const int cr = static_cast<int>(species.boundingRadius() / m_resolution);
 
         for(int x = cx - cr, xend = cx + cr; x <= xend; ++x)
         {
             // Outside the map
-            if(x < 0 || x >= m_pgm.width())
+            if(x < 0 || x >= m_pgm->width())
             {
                 continue;
             }
@@ -77,7 +90,7 @@ namespace grstapse
             for(int y = cy - cr, yend = cy + cr; y <= yend; ++y)
             {
                 // Outside the map
-                if(y < 0 || y >= m_pgm.height())
+                if(y < 0 || y >= m_pgm->height())
                 {
                     continue;
                 }
@@ -88,7 +101,7 @@ namespace grstapse
                     continue;
                 }
 
-                const unsigned int p = m_pgm.pixel(y, x);
+                const unsigned int p = m_pgm->pixel(y, x);
                 if(p < 127)
                 {
                     return false;
@@ -103,12 +116,12 @@ namespace grstapse
         // Perimeter of map
         float longest_path = 2 * (maxY() - minY()) + 2 * (maxX() - minX());
 
-        for(unsigned int x = 0, x_end = m_pgm.width(); x < x_end; ++x)
+        for(unsigned int x = 0, x_end = m_pgm->width(); x < x_end; ++x)
         {
-            for(unsigned int y = 0, y_end = m_pgm.height(); y < y_end; ++y)
+            for(unsigned int y = 0, y_end = m_pgm->height(); y < y_end; ++y)
             {
                 // Obstacle
-                if (m_pgm.pixel(y, x) < 127) {
+                if (m_pgm->pixel(y, x) < 127) {
                     // Perimeter of cell
                     longest_path += m_resolution * 4;
                 }
@@ -118,6 +131,143 @@ namespace grstapse
         return longest_path;
     }
 
+    uint64_t PgmEnvironment::fingerprint() const
+    {
+        // FNV-1a
+        uint64_t hash = 14695981039346656037ULL;
+        auto combine  = [&hash](const uint64_t value)
+        {
+            for(unsigned int byte = 0; byte < sizeof(uint64_t); ++byte)
+            {
+                hash ^= (value >> (8 * byte)) & 0xFF;
+                hash *= 1099511628211ULL;
+            }
+        };
+
+        combine(m_pgm->width());
+        combine(m_pgm->height());
+        for(const uint8_t p: m_pgm->pixels())
+        {
+            combine(p);
+        }
+        combine(std::bit_cast<uint32_t>(m_resolution));
+        combine(std::bit_cast<uint32_t>(m_origin_x));
+        combine(std::bit_cast<uint32_t>(m_origin_y));
+        if(std::dynamic_pointer_cast<ompl::base::DubinsStateSpace>(m_state_space) != nullptr)
+        {
+            combine(std::bit_cast<uint32_t>(m_turning_radius));
+        }
+        return hash;
+    }
+
+    std::vector<uint8_t> PgmEnvironment::inflatedOccupancy(const float bounding_radius) const
+    {
+        const int width  = m_pgm->width();
+        const int height = m_pgm->height();
+        const int cr     = static_cast<int>(bounding_radius / m_resolution);
+
+        // Squared euclidean distance to the nearest obstacle pixel
+        std::vector<uint8_t> obstacles(width * height);
+        for(int y = 0; y < height; ++y)
+        {
+            for(int x = 0; x < width; ++x)
+            {
+                obstacles[y * width + x] = m_pgm->pixel(y, x) < 127;
+            }
+        }
+        const std::array<unsigned int, 2> dimensions{static_cast<unsigned int>(width),
+                                                     static_cast<unsigned int>(height)};
+        const std::vector<float> squared_distances = squaredDistanceTransform(obstacles, dimensions);
+
+        // Same as isValid: in collision if an obstacle pixel is strictly inside the circle
+        std::vector<uint8_t> occupancy(width * height);
+        for(int i = 0, end = width * height; i < end; ++i)
+        {
+            occupancy[i] = squared_distances[i] < static_cast<float>(cr * cr);
+        }
+        return occupancy;
+    }
+
+    std::vector<float> PgmEnvironment::geodesicDistances(const std::vector<uint8_t>& occupancy,
+                                                         const float x,
+                                                         const float y) const
+    {
+        std::vector<float> distances;
+        geodesicDistances(occupancy, x, y, distances);
+        return distances;
+    }
+
+    void PgmEnvironment::geodesicDistances(const std::vector<uint8_t>& occupancy,
+                                           const float x,
+                                           const float y,
+                                           std::vector<float>& distances) const
+    {
+        const int width = m_pgm->width();
+        distances.assign(occupancy.size(), std::numeric_limits<float>::infinity());
+
+        const auto [sx, sy] = toCell(x, y);
+        if(!inMap(sx, sy) || occupancy[sy * width + sx])
+        {
+            return;
+        }
+
+        const float diagonal = m_resolution * std::numbers::sqrt2_v<float>;
+        constexpr std::array<std::pair<int, int>, 8> k_neighbors{
+            {{-1, -1}, {0, -1}, {1, -1}, {-1, 0}, {1, 0}, {-1, 1}, {0, 1}, {1, 1}}};
+
+        using Entry = std::pair<float, int>;  //!< (distance, cell index)
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+        distances[sy * width + sx] = 0.0f;
+        open.emplace(0.0f, sy * width + sx);
+        while(!open.empty())
+        {
+            const auto [distance, index] = open.top();
+            open.pop();
+            if(distance > distances[index])
+            {
+                continue;
+            }
+
+            const int cx = index % width;
+            const int cy = index / width;
+            for(const auto& [dx, dy]: k_neighbors)
+            {
+                const int nx = cx + dx;
+                const int ny = cy + dy;
+                if(!inMap(nx, ny))
+                {
+                    continue;
+                }
+                const int neighbor = ny * width + nx;
+                if(occupancy[neighbor])
+                {
+                    continue;
+                }
+                const float neighbor_distance = distance + (dx != 0 && dy != 0 ? diagonal : m_resolution);
+                if(neighbor_distance < distances[neighbor])
+                {
+                    distances[neighbor] = neighbor_distance;
+                    open.emplace(neighbor_distance, neighbor);
+                }
+            }
+        }
+    }
+
+    float PgmEnvironment::geodesicLowerBound(const std::vector<float>& distances, const float x, const float y) const
+    {
+        const auto [cx, cy] = toCell(x, y);
+        if(!inMap(cx, cy))
+        {
+            return std::numeric_limits<float>::infinity();
+        }
+
+        // An 8-connected path overestimates the euclidean distance by at most 1 / cos(pi / 8) and snapping each
+        // endpoint to the center of its cell changes the length by at most half of a cell diagonal
+        constexpr float k_octile_overestimate = 1.0823922f;
+        const float distance                  = distances[cy * m_pgm->width() + cx];
+        return std::max(0.0f, distance / k_octile_overestimate - m_resolution * std::numbers::sqrt2_v<float>);
+    }
+
     void from_json(const nlohmann::json& j, PgmEnvironment& e)
     {
         validate(j, {{constants::k_yaml_filepath, nlohmann::json::value_t::string}});
@@ -133,7 +283,7 @@ namespace grstapse
             e.m_origin_y      = origin[1].as<float>();
         }
         const std::string pgm_filepath = yaml_filepath.substr(0, yaml_filepath.find_last_of('/') + 1) + image_filename;
-        e.m_pgm.loadFile(pgm_filepath.c_str());
+        e.m_pgm = PgmRegistry::instance().load(pgm_filepath);
 
         if(auto j_itr = j.find(constants::k_dubins); j_itr != j.end() && (*j_itr).get<bool>())
         {
@@ -0,0 +1,196 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/geometric_planning/ompl/quadtree_environment.hpp"
+
+// Global
+#include <algorithm>
+// External
+#include <ompl/base/spaces/DubinsStateSpace.h>
+#include <ompl/base/spaces/SE2StateSpace.h>
+// Local
+#include "grstapse/geometric_planning/ompl/environment_motion_validator.hpp"
+#include "grstapse/species.hpp"
+
+namespace grstapse
+{
+    QuadtreeEnvironment::QuadtreeEnvironment()
+        : PgmEnvironment(OmplEnvironmentType::e_quadtree)
+    {}
+
+    QuadtreeEnvironment::QuadtreeEnvironment(const std::string& filepath,
+                                             const float resolution,
+                                             const float origin_x,
+                                             const float origin_y)
+        : PgmEnvironment(filepath, resolution, origin_x, origin_y)
+    {
+        m_environment_type = OmplEnvironmentType::e_quadtree;
+        buildLevels();
+    }
+
+    bool QuadtreeEnvironment::isValid(const ompl::base::State* state, const Species& species) const
+    {
+        const auto* se2_state = state->as<ompl::base::SE2StateSpace::StateType>();
+        const auto [cx, cy]   = toCell(se2_state->getX(), se2_state->getY());
+        const int cr          = static_cast<int>(species.boundingRadius() / m_resolution);
+
+        // The bounding square of the robot contains its circle
+        if(isRegionFree(cx - cr, cy - cr, cx + cr, cy + cr))
+        {
+            return true;
+        }
+        return PgmEnvironment::isValid(state, species);
+    }
+
+    std::shared_ptr<ompl::base::MotionValidator> QuadtreeEnvironment::createMotionValidator(
+        const ompl::base::SpaceInformationPtr& space_information,
+        const std::shared_ptr<const Species>& species) const
+    {
+        return std::make_shared<EnvironmentMotionValidator>(space_information, shared_from_this(), species);
+    }
+
+    bool QuadtreeEnvironment::isMotionFree(const ompl::base::State* from,
+                                           const ompl::base::State* to,
+                                           const Species& species) const
+    {
+        if(std::dynamic_pointer_cast<ompl::base::DubinsStateSpace>(m_state_space) != nullptr)
+        {
+            return false;
+        }
+
+        const auto* from_state      = from->as<ompl::base::SE2StateSpace::StateType>();
+        const auto* to_state        = to->as<ompl::base::SE2StateSpace::StateType>();
+        const auto [from_x, from_y] = toCell(from_state->getX(), from_state->getY());
+        const auto [to_x, to_y]     = toCell(to_state->getX(), to_state->getY());
+        const int cr                = static_cast<int>(species.boundingRadius() / m_resolution);
+
+        // Every state on the segment maps to a cell inside of the bounding box of the cells of its endpoints
+        return isRegionFree(std::min(from_x, to_x) - cr,
+                            std::min(from_y, to_y) - cr,
+                            std::max(from_x, to_x) + cr,
+                            std::max(from_y, to_y) + cr);
+    }
+
+    bool QuadtreeEnvironment::isRegionFree(int min_cx, int min_cy, int max_cx, int max_cy) const
+    {
+        min_cx = std::max(min_cx, 0);
+        min_cy = std::max(min_cy, 0);
+        max_cx = std::min(max_cx, m_level_widths.front() - 1);
+        max_cy = std::min(max_cy, m_level_heights.front() - 1);
+        if(min_cx > max_cx || min_cy > max_cy)
+        {
+            return true;
+        }
+        return isRegionFree(m_levels.size() - 1, 0, 0, min_cx, min_cy, max_cx, max_cy);
+    }
+
+    bool QuadtreeEnvironment::isRegionFree(const unsigned int level,
+                                           const int x,
+                                           const int y,
+                                           const int min_cx,
+                                           const int min_cy,
+                                           const int max_cx,
+                                           const int max_cy) const
+    {
+        if(x >= m_level_widths[level] || y >= m_level_heights[level] ||
+           !m_levels[level][y * m_level_widths[level] + x])
+        {
+            return true;
+        }
+
+        // Pixels covered by this block
+        const int block_min_x = x << level;
+        const int block_min_y = y << level;
+        const int block_max_x = ((x + 1) << level) - 1;
+        const int block_max_y = ((y + 1) << level) - 1;
+        if(block_max_x < min_cx || block_min_x > max_cx || block_max_y < min_cy || block_min_y > max_cy)
+        {
+            return true;
+        }
+
+        // The block contains an obstacle and is either a single pixel or entirely inside of the rectangle
+        if(level == 0 ||
+           (block_min_x >= min_cx && block_max_x <= max_cx && block_min_y >= min_cy && block_max_y <= max_cy))
+        {
+            return false;
+        }
+
+        for(int child_y = 2 * y; child_y <= 2 * y + 1; ++child_y)
+        {
+            for(int child_x = 2 * x; child_x <= 2 * x + 1; ++child_x)
+            {
+                if(!isRegionFree(level - 1, child_x, child_y, min_cx, min_cy, max_cx, max_cy))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    void QuadtreeEnvironment::buildLevels()
+    {
+        m_levels.clear();
+        m_level_widths.clear();
+        m_level_heights.clear();
+
+        int width  = m_pgm->width();
+        int height = m_pgm->height();
+        std::vector<uint8_t> level(width * height);
+        for(int y = 0; y < height; ++y)
+        {
+            for(int x = 0; x < width; ++x)
+            {
+                level[y * width + x] = m_pgm->pixel(y, x) < 127;
+            }
+        }
+        m_levels.push_back(std::move(level));
+        m_level_widths.push_back(width);
+        m_level_heights.push_back(height);
+
+        while(width > 1 || height > 1)
+        {
+            const std::vector<uint8_t>& finer = m_levels.back();
+            const int coarser_width           = (width + 1) / 2;
+            const int coarser_height          = (height + 1) / 2;
+            std::vector<uint8_t> coarser(coarser_width * coarser_height, 0);
+            for(int y = 0; y < height; ++y)
+            {
+                for(int x = 0; x < width; ++x)
+                {
+                    coarser[(y / 2) * coarser_width + x / 2] |= finer[y * width + x];
+                }
+            }
+            width  = coarser_width;
+            height = coarser_height;
+            m_levels.push_back(std::move(coarser));
+            m_level_widths.push_back(width);
+            m_level_heights.push_back(height);
+        }
+    }
+
+    void from_json(const nlohmann::json& j, QuadtreeEnvironment& e)
+    {
+        from_json(j, static_cast<PgmEnvironment&>(e));
+        e.buildLevels();
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,42 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/geometric_planning/ompl/species_validity_checker.hpp"
+
+// Local
+#include "grstapse/geometric_planning/ompl/ompl_environment.hpp"
+
+namespace grstapse
+{
+    SpeciesValidityChecker::SpeciesValidityChecker(const ompl::base::SpaceInformationPtr& space_information,
+                                                   const std::shared_ptr<const OmplEnvironment>& environment,
+                                                   const std::shared_ptr<const Species>& species)
+        : ompl::base::StateValidityChecker(space_information)
+        , m_environment(environment)
+        , m_species(species)
+    {}
+
+    bool SpeciesValidityChecker::isValid(const ompl::base::State* state) const
+    {
+        return m_environment->isValid(state, *m_species);
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,194 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/geometric_planning/ompl/voxel_environment.hpp"
+
+// Global
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <numbers>
+// External
+#include <ompl/base/spaces/SE3StateSpace.h>
+// Local
+#include "grstapse/common/utilities/constants.hpp"
+#include "grstapse/common/utilities/distance_transform.hpp"
+#include "grstapse/common/utilities/json_field_validator.hpp"
+#include "grstapse/geometric_planning/ompl/environment_motion_validator.hpp"
+#include "grstapse/geometric_planning/ompl/ompl_enums.hpp"
+#include "grstapse/species.hpp"
+
+namespace grstapse
+{
+    VoxelEnvironment::VoxelEnvironment()
+        : OmplEnvironment{.environment_type = OmplEnvironmentType::e_voxel,
+                          .state_space_type = OmplStateSpaceType::e_se3}
+    {
+        m_state_space = std::make_shared<ompl::base::SE3StateSpace>();
+    }
+
+    VoxelEnvironment::VoxelEnvironment(const std::string& filepath)
+        : VoxelEnvironment(VoxelGrid(filepath))
+    {}
+
+    VoxelEnvironment::VoxelEnvironment(VoxelGrid grid)
+        : VoxelEnvironment()
+    {
+        m_grid = std::move(grid);
+        initialize();
+    }
+
+    bool VoxelEnvironment::isValid(const ompl::base::State* state, const Species& species) const
+    {
+        const auto* se3_state = state->as<ompl::base::SE3StateSpace::StateType>();
+        return clearance(se3_state->getX(), se3_state->getY(), se3_state->getZ()) >= species.boundingRadius();
+    }
+
+    bool VoxelEnvironment::isMotionFree(const ompl::base::State* from,
+                                        const ompl::base::State* to,
+                                        const Species& species) const
+    {
+        const auto* from_state     = from->as<ompl::base::SE3StateSpace::StateType>();
+        const auto* to_state       = to->as<ompl::base::SE3StateSpace::StateType>();
+        const float from_clearance = clearance(from_state->getX(), from_state->getY(), from_state->getZ());
+        const float to_clearance   = clearance(to_state->getX(), to_state->getY(), to_state->getZ());
+
+        // Points are snapped to the center of their voxel, which can move them by up to a voxel diagonal relative to
+        // each other
+        const float margin     = species.boundingRadius() + m_grid.resolution() * std::numbers::sqrt3_v<float>;
+        const float from_slack = from_clearance - margin;
+        const float to_slack   = to_clearance - margin;
+        const float dx         = to_state->getX() - from_state->getX();
+        const float dy         = to_state->getY() - from_state->getY();
+        const float dz         = to_state->getZ() - from_state->getZ();
+        const float length     = std::sqrt(dx * dx + dy * dy + dz * dz);
+        const auto& dimensions = m_grid.dimensions();
+        const auto& origin     = m_grid.origin();
+        auto in_grid           = [&](const ompl::base::SE3StateSpace::StateType* state)
+        {
+            return state->getX() >= origin[0] && state->getY() >= origin[1] && state->getZ() >= origin[2] &&
+                   state->getX() < origin[0] + dimensions[0] * m_grid.resolution() &&
+                   state->getY() < origin[1] + dimensions[1] * m_grid.resolution() &&
+                   state->getZ() < origin[2] + dimensions[2] * m_grid.resolution();
+        };
+
+        // Every point of the motion is within (a fraction of) its length of one of the endpoints. The grid is convex,
+        // so the whole motion stays inside of it
+        return in_grid(from_state) && in_grid(to_state) && from_slack >= 0.0f && to_slack >= 0.0f &&
+               from_slack + to_slack >= length;
+    }
+
+    std::shared_ptr<ompl::base::MotionValidator> VoxelEnvironment::createMotionValidator(
+        const ompl::base::SpaceInformationPtr& space_information,
+        const std::shared_ptr<const Species>& species) const
+    {
+        return std::make_shared<EnvironmentMotionValidator>(space_information, shared_from_this(), species);
+    }
+
+    float VoxelEnvironment::longestPath() const
+    {
+        // Edges of the bounding box of the map
+        const auto& dimensions = m_grid.dimensions();
+        float longest_path     = 4 * m_grid.resolution() * (dimensions[0] + dimensions[1] + dimensions[2]);
+
+        for(const uint8_t occupied: m_grid.occupancy())
+        {
+            // Obstacle
+            if(occupied)
+            {
+                // Edges of the voxel
+                longest_path += m_grid.resolution() * 12;
+            }
+        }
+
+        return longest_path;
+    }
+
+    uint64_t VoxelEnvironment::fingerprint() const
+    {
+        // FNV-1a
+        uint64_t hash = 14695981039346656037ULL;
+        auto combine  = [&hash](const uint64_t value)
+        {
+            for(unsigned int byte = 0; byte < sizeof(uint64_t); ++byte)
+            {
+                hash ^= (value >> (8 * byte)) & 0xFF;
+                hash *= 1099511628211ULL;
+            }
+        };
+
+        for(const unsigned int dimension: m_grid.dimensions())
+        {
+            combine(dimension);
+        }
+        for(const uint8_t occupied: m_grid.occupancy())
+        {
+            combine(occupied != 0);
+        }
+        combine(std::bit_cast<uint32_t>(m_grid.resolution()));
+        for(const float coordinate: m_grid.origin())
+        {
+            combine(std::bit_cast<uint32_t>(coordinate));
+        }
+        return hash;
+    }
+
+    float VoxelEnvironment::clearance(const float x, const float y, const float z) const
+    {
+        const auto& dimensions = m_grid.dimensions();
+        const auto& origin     = m_grid.origin();
+        const float vx         = std::floor((x - origin[0]) / m_grid.resolution());
+        const float vy         = std::floor((y - origin[1]) / m_grid.resolution());
+        const float vz         = std::floor((z - origin[2]) / m_grid.resolution());
+        if(!(vx >= 0.0f && vy >= 0.0f && vz >= 0.0f && vx < dimensions[0] && vy < dimensions[1] &&
+             vz < dimensions[2]))
+        {
+            return std::numeric_limits<float>::infinity();
+        }
+        return m_clearance[m_grid.index(vx, vy, vz)];
+    }
+
+    void VoxelEnvironment::initialize()
+    {
+        m_clearance = squaredDistanceTransform(m_grid.occupancy(), m_grid.dimensions());
+        for(float& clearance: m_clearance)
+        {
+            clearance = std::sqrt(clearance) * m_grid.resolution();
+        }
+
+        const auto& dimensions = m_grid.dimensions();
+        const auto& origin     = m_grid.origin();
+        ompl::base::RealVectorBounds bounds(3);
+        bounds.low  = {origin[0], origin[1], origin[2]};
+        bounds.high = {origin[0] + dimensions[0] * m_grid.resolution(),
+                       origin[1] + dimensions[1] * m_grid.resolution(),
+                       origin[2] + dimensions[2] * m_grid.resolution()};
+        m_state_space->as<ompl::base::SE3StateSpace>()->setBounds(bounds);
+    }
+
+    void from_json(const nlohmann::json& j, VoxelEnvironment& e)
+    {
+        validate(j, {{constants::k_voxel_filepath, nlohmann::json::value_t::string}});
+        e.m_grid.loadFile(j.at(constants::k_voxel_filepath).get<std::string>());
+        e.initialize();
+    }
+}  // namespace grstapse
\ No newline at end of file
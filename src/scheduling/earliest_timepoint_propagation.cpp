@@ -0,0 +1,104 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/scheduling/earliest_timepoint_propagation.hpp"
+
+// Global
+#include <algorithm>
+
+namespace grstapse
+{
+    float propagateEarliestTimepoints(const std::vector<float>& durations,
+                                      const std::vector<float>& release_times,
+                                      const std::vector<TemporalArc>& arcs,
+                                      std::vector<std::pair<float, float>>& timepoints)
+    {
+        const unsigned int num_tasks = durations.size();
+
+        // Compressed adjacency list of the outgoing arcs for each task
+        std::vector<unsigned int> arc_offsets(num_tasks + 1, 0);
+        std::vector<unsigned int> in_degree(num_tasks, 0);
+        for(const TemporalArc& arc: arcs)
+        {
+            ++arc_offsets[arc.predecessor + 1];
+            ++in_degree[arc.successor];
+        }
+        for(unsigned int i = 0; i < num_tasks; ++i)
+        {
+            arc_offsets[i + 1] += arc_offsets[i];
+        }
+        std::vector<unsigned int> outgoing(arcs.size());
+        std::vector<unsigned int> insert_position(arc_offsets.begin(), arc_offsets.end() - 1);
+        for(unsigned int arc_nr = 0, end = arcs.size(); arc_nr < end; ++arc_nr)
+        {
+            outgoing[insert_position[arcs[arc_nr].predecessor]++] = arc_nr;
+        }
+
+        std::vector<float> start(release_times.begin(), release_times.end());
+        start.resize(num_tasks, 0.0f);
+
+        // Kahn's algorithm
+        std::vector<unsigned int> ready;
+        ready.reserve(num_tasks);
+        for(unsigned int i = 0; i < num_tasks; ++i)
+        {
+            if(in_degree[i] == 0)
+            {
+                ready.push_back(i);
+            }
+        }
+
+        unsigned int num_processed = 0;
+        float makespan             = 0.0f;
+        while(!ready.empty())
+        {
+            const unsigned int task = ready.back();
+            ready.pop_back();
+            ++num_processed;
+
+            const float finish = start[task] + durations[task];
+            makespan           = std::max(makespan, finish);
+            for(unsigned int k = arc_offsets[task]; k < arc_offsets[task + 1]; ++k)
+            {
+                const TemporalArc& arc = arcs[outgoing[k]];
+                start[arc.successor]   = std::max(start[arc.successor], finish + arc.lag);
+                if(--in_degree[arc.successor] == 0)
+                {
+                    ready.push_back(arc.successor);
+                }
+            }
+        }
+
+        // Cycle
+        if(num_processed != num_tasks)
+        {
+            return -1.0f;
+        }
+
+        timepoints.resize(num_tasks);
+        for(unsigned int i = 0; i < num_tasks; ++i)
+        {
+            timepoints[i] = std::pair(start[i], start[i] + durations[i]);
+        }
+        return makespan;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,77 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/scheduling/makespan_distribution.hpp"
+
+// Global
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+// Local
+#include "grstapse/common/utilities/error.hpp"
+
+namespace grstapse
+{
+    MakespanDistribution::MakespanDistribution(std::vector<float> makespans)
+        : m_sorted_makespans(std::move(makespans))
+        , m_num_infeasible(0)
+    {
+        for(float& makespan: m_sorted_makespans)
+        {
+            if(makespan < 0.0f)
+            {
+                makespan = std::numeric_limits<float>::infinity();
+                ++m_num_infeasible;
+            }
+        }
+        std::sort(m_sorted_makespans.begin(), m_sorted_makespans.end());
+    }
+
+    float MakespanDistribution::quantile(const float alpha) const
+    {
+        if(m_sorted_makespans.empty())
+        {
+            throw createLogicError("Quantile requested from an empty makespan distribution");
+        }
+
+        // Note: epsilon so that floating point error in alpha * n does not require an extra sample
+        const float num_required = std::ceil(alpha * m_sorted_makespans.size() - 1e-4f);
+        const unsigned int index =
+            std::clamp(static_cast<int>(num_required) - 1, 0, static_cast<int>(m_sorted_makespans.size()) - 1);
+        return m_sorted_makespans[index];
+    }
+
+    float MakespanDistribution::mean() const
+    {
+        if(m_sorted_makespans.empty())
+        {
+            throw createLogicError("Mean requested from an empty makespan distribution");
+        }
+        if(m_num_infeasible > 0)
+        {
+            return std::numeric_limits<float>::infinity();
+        }
+        return std::accumulate(m_sorted_makespans.begin(), m_sorted_makespans.end(), 0.0) /
+               m_sorted_makespans.size();
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -27,6 +27,7 @@
 // Local
 #include "grstapse/common/utilities/constants.hpp"
 #include "grstapse/common/utilities/error.hpp"
+#include "grstapse/common/utilities/logger.hpp"
 #include "grstapse/geometric_planning/configuration_base.hpp"
 #include "grstapse/geometric_planning/ompl/ompl_environment.hpp"
 #include "grstapse/geometric_planning/ompl/ompl_motion_planner.hpp"
@@ -40,7 +41,9 @@
 namespace grstapse {
     DeterministicMilpScheduler::DeterministicMilpScheduler(
             const std::shared_ptr<const SchedulerProblemInputs> &problem_inputs)
-            : DeterministicMilpSchedulerBase(problem_inputs, m_placeholder_reduced_mutex_constraints) {
+            : DeterministicMilpSchedulerBase(problem_inputs, m_placeholder_reduced_mutex_constraints),
+              m_repair_schedule(nullptr),
+              m_repair_inputs(nullptr) {
         if (!s_environment_setup) {
             initGurobi(
                     std::dynamic_pointer_cast<const MilpSchedulerParameters>(m_problem_inputs->schedulerParameters()));
@@ -60,6 +63,89 @@ namespace grstapse {
             }
         }
 
+        return solveIteratively();
+    }
+
+    std::shared_ptr<const DeterministicSchedule> DeterministicMilpScheduler::repairSchedule(
+            const DeterministicSchedule &schedule,
+            const float current_time,
+            const std::vector<TaskExecutionStatus> &task_statuses,
+            const std::vector<float> &task_durations) {
+        const unsigned int num_tasks = m_problem_inputs->numberOfPlanTasks();
+        if (m_tasks_timepoints.size() != num_tasks) {
+            throw createLogicError("A schedule can only be repaired by the scheduler that computed it");
+        }
+
+        ScheduleRepairInputs inputs{.current_time = current_time,
+                                    .task_statuses = task_statuses,
+                                    .task_durations = task_durations};
+
+        inputs.initial_transition_durations.reserve(num_tasks);
+        for (const TaskTransitionInfo &task_transition_info: m_initial_transition_info) {
+            float earliest_start = 0.0f;
+            for (const RobotTaskTransitionInfo &robot_task_transition_info: task_transition_info) {
+                if (robot_task_transition_info.computation_status == TransitionComputationStatus::e_failed) {
+                    earliest_start = -1.0f;
+                    break;
+                }
+                earliest_start = std::max(earliest_start, robot_task_transition_info.duration);
+            }
+            inputs.initial_transition_durations.push_back(earliest_start);
+        }
+
+        // Note: a failed transition has a negative lag, which makes the ordering infeasible
+        inputs.precedence_constraints.reserve(m_problem_inputs->precedenceConstraints().size() +
+                                              m_mp_induced_precedence_constraints.size());
+        for (const auto &[predecessor, successor]: m_problem_inputs->precedenceConstraints()) {
+            inputs.precedence_constraints.push_back(TemporalArc{
+                    .predecessor = predecessor,
+                    .successor = successor,
+                    .lag = checkTransitionFeasibility(predecessor, successor).second});
+        }
+        for (const auto &[predecessor, successor]: m_mp_induced_precedence_constraints) {
+            inputs.precedence_constraints.push_back(TemporalArc{
+                    .predecessor = predecessor,
+                    .successor = successor,
+                    .lag = checkTransitionFeasibility(predecessor, successor).second});
+        }
+        inputs.mutex_transition_durations.reserve(schedule.precedenceSetMutexConstraints().size());
+        for (const auto &[predecessor, successor]: schedule.precedenceSetMutexConstraints()) {
+            inputs.mutex_transition_durations.push_back(checkTransitionFeasibility(predecessor, successor).second);
+        }
+
+        if (std::shared_ptr<const DeterministicSchedule> repaired_schedule = schedule.repair(inputs);
+                repaired_schedule != nullptr) {
+            return repaired_schedule;
+        }
+
+#ifdef DEBUG
+        Logger::debug("Schedule repair: ordering is infeasible, re-solving the MILP");
+#endif
+
+        // The ordering has become infeasible, so fall back to the MILP
+        for (unsigned int task_nr = 0; task_nr < num_tasks; ++task_nr) {
+            if (!task_durations.empty() && task_durations[task_nr] >= 0.0f) {
+                m_task_durations[task_nr] = task_durations[task_nr];
+            }
+            if (task_statuses[task_nr] == TaskExecutionStatus::e_in_progress) {
+                m_task_durations[task_nr] =
+                        std::max(m_task_durations[task_nr], current_time - schedule.taskStart(task_nr));
+            }
+        }
+
+        m_repair_schedule = &schedule;
+        m_repair_inputs = &inputs;
+        m_repair_ordering.clear();
+        m_repair_ordering.insert(schedule.precedenceSetMutexConstraints().begin(),
+                                 schedule.precedenceSetMutexConstraints().end());
+        std::shared_ptr<const DeterministicSchedule> repaired_schedule = solveIteratively();
+        m_repair_schedule = nullptr;
+        m_repair_inputs = nullptr;
+        m_repair_ordering.clear();
+        return repaired_schedule;
+    }
+
+    std::shared_ptr<const DeterministicSchedule> DeterministicMilpScheduler::solveIteratively() {
         while (true) {
             ++s_num_iterations;
             GRBModel model(s_environment);
@@ -83,6 +169,30 @@ namespace grstapse {
         }
     }
 
+    bool DeterministicMilpScheduler::createTaskDurationsOtherIterations(GRBModel &model) {
+        if (!DeterministicMilpSchedulerBase::createTaskDurationsOtherIterations(model)) {
+            return false;
+        }
+
+        if (m_repair_schedule != nullptr) {
+            // Tasks that have started are fixed in place, pending tasks are warm started from the previous schedule
+            const unsigned int num_tasks = m_problem_inputs->numberOfPlanTasks();
+            for (unsigned int task_nr = 0; task_nr < num_tasks; ++task_nr) {
+                GRBVar &start = m_tasks_timepoints[task_nr].start;
+                if (m_repair_inputs->task_statuses[task_nr] == TaskExecutionStatus::e_pending) {
+                    model.addConstr(start >= m_repair_inputs->current_time,
+                                    fmt::format("rc_{0:d}", task_nr));
+                    start.set(GRB_DoubleAttr_Start,
+                              std::max(m_repair_schedule->taskStart(task_nr), m_repair_inputs->current_time));
+                } else {
+                    model.addConstr(start == m_repair_schedule->taskStart(task_nr), fmt::format("rc_{0:d}", task_nr));
+                    start.set(GRB_DoubleAttr_Start, m_repair_schedule->taskStart(task_nr));
+                }
+            }
+        }
+        return true;
+    }
+
     std::string DeterministicMilpScheduler::createTaskStartName(unsigned int task_nr) const {
         return fmt::format("ts_{0:d}", task_nr);
     }
@@ -113,6 +223,11 @@ namespace grstapse {
                     MutexConstraintInfo{.task_i = i, .task_j = j, .variable_name = p_ij_name, .variable = p_ij};
         }
 
+        // Warm start from the ordering of the schedule being repaired
+        if (m_repair_schedule != nullptr) {
+            p_ij.set(GRB_DoubleAttr_Start, m_repair_ordering.contains(std::pair(i, j)) ? 1.0 : 0.0);
+        }
+
         // i -> j
         model.addGenConstrIndicator(
                 p_ij,
@@ -193,28 +308,26 @@ namespace grstapse {
         const Eigen::MatrixXf &allocation = m_problem_inputs->allocation();
 
         // Sort by order of start
-        std::sort(m_tasks_timepoints.begin(),
-                  m_tasks_timepoints.end(),
-                  [](const TaskVariableInfo &lhs, const TaskVariableInfo &rhs) {
-                      return lhs.start.get(GRB_DoubleAttr_X) < rhs.start.get(GRB_DoubleAttr_X);
+        // Note: sorts pointers as m_tasks_timepoints must stay indexed by task number for the next iteration
+        std::vector<const TaskVariableInfo *> ordered_tasks_timepoints;
+        ordered_tasks_timepoints.reserve(m_tasks_timepoints.size());
+        for (const TaskVariableInfo &task_timepoint: m_tasks_timepoints) {
+            ordered_tasks_timepoints.push_back(&task_timepoint);
+        }
+        std::sort(ordered_tasks_timepoints.begin(),
+                  ordered_tasks_timepoints.end(),
+                  [](const TaskVariableInfo *lhs, const TaskVariableInfo *rhs) {
+                      return lhs->start.get(GRB_DoubleAttr_X) < rhs->start.get(GRB_DoubleAttr_X);
                   });
 
         std::vector<int> previous_task(num_robots, -1);
-        std::vector<std::shared_ptr<const ConfigurationBase>> previous_configurations;
-        previous_configurations.reserve(num_robots);
-        for (const std::shared_ptr<const Robot> &robot: m_problem_inputs->robots()) {
-            previous_configurations.push_back(robot->initialConfiguration());
-        }
-
-        for (const TaskVariableInfo &task_timepoint: m_tasks_timepoints) {
-            const std::shared_ptr<const Task> &task = m_problem_inputs->planTask(task_timepoint.task_nr);
-            const std::shared_ptr<const ConfigurationBase> &initial_configuration = task->initialConfiguration();
-            const std::shared_ptr<const ConfigurationBase> &terminal_configuration = task->terminalConfiguration();
 
+        for (const TaskVariableInfo *task_timepoint_ptr: ordered_tasks_timepoints) {
+            const TaskVariableInfo &task_timepoint = *task_timepoint_ptr;
             for (unsigned int robot_nr: task_timepoint.coalition) {
-                TaskTransitionInfo &task_transition_info =
-                        previous_task[robot_nr] < 0 ? m_initial_transition_info[task_timepoint.task_nr]
-                                                    : m_transition_info[previous_task[robot_nr]][task_timepoint.task_nr];
+                std::span<RobotTaskTransitionInfo> task_transition_info =
+                        previous_task[robot_nr] < 0 ? std::span(m_initial_transition_info[task_timepoint.task_nr])
+                                                    : transitionInfo(previous_task[robot_nr], task_timepoint.task_nr);
                 for (RobotTaskTransitionInfo &robot_task_transition_info: task_transition_info) {
                     if (robot_task_transition_info.robot_nr != robot_nr) {
                         continue;
@@ -223,8 +336,7 @@ namespace grstapse {
                         case TransitionComputationStatus::e_none:
                         case TransitionComputationStatus::e_heuristic: {
                             const float transition_duration =
-                                    m_problem_inputs->robot(robot_nr)->durationQuery(previous_configurations[robot_nr],
-                                                                                     initial_configuration);
+                                    queryTransitionDuration(robot_nr, previous_task[robot_nr], task_timepoint.task_nr);
                             robot_task_transition_info.computation_status = TransitionComputationStatus::e_success;
                             robot_task_transition_info.duration = transition_duration;
                             no_heuristic = false;
@@ -241,8 +353,8 @@ namespace grstapse {
                             break;
                         }
                     }
-                    // Set terminal configuration (initial -> terminal is handled by task duration)
-                    previous_configurations[robot_nr] = terminal_configuration;
+                    // Next transition is from this task's terminal configuration (initial -> terminal is handled by
+                    // task duration)
                     previous_task[robot_nr] = task_timepoint.task_nr;
                     break;
                 }
@@ -22,6 +22,9 @@
  */
 #include "grstapse/scheduling/milp/deterministic/deterministic_milp_scheduler_base.hpp"
 
+// Global
+#include <algorithm>
+#include <tuple>
 // External
 #include <fmt/format.h>
 // Local
@@ -29,6 +32,7 @@
 #include "grstapse/geometric_planning/configuration_base.hpp"
 #include "grstapse/robot.hpp"
 #include "grstapse/scheduling/scheduler_problem_inputs.hpp"
+#include "grstapse/scheduling/transition_duration_matrix.hpp"
 #include "grstapse/task.hpp"
 
 namespace grstapse
@@ -52,49 +56,60 @@ namespace grstapse
         m_tasks_timepoints.reserve(num_tasks);
         m_task_durations.resize(num_tasks, -1.0);
 
-        std::vector<TaskTransitionInfo> inner_vec;
-        TaskTransitionInfo transition_info;
-
         // Fill transition duration data structures
-        m_initial_transition_info.reserve(num_tasks);
-        m_transition_info.reserve(num_tasks);
-        for(unsigned int task_i = 0; task_i < num_tasks; ++task_i)
+        // Note: only the pairs of tasks that share a robot have transitions, so only those (task_i, task_j, robot)
+        //       triples are stored, built from each robot's allocated tasks (the durations themselves are read from
+        //       the problem's TransitionDurationMatrix)
+        m_initial_transition_info.resize(num_tasks);
+        std::vector<std::tuple<unsigned int, unsigned int, unsigned int>> transitions;
+        std::vector<unsigned int> allocated_tasks;
+        allocated_tasks.reserve(num_tasks);
+        for(unsigned int robot = 0; robot < num_robots; ++robot)
         {
-            inner_vec.resize(0);
-            inner_vec.reserve(num_tasks);
-            for(unsigned int task_j = 0; task_j < num_tasks; ++task_j)
+            allocated_tasks.resize(0);
+            for(unsigned int task_nr = 0; task_nr < num_tasks; ++task_nr)
             {
-                transition_info.resize(0);
-                // Ignore self transitions
-                if(task_i != task_j)
+                if(allocation(task_nr, robot))
                 {
-                    for(unsigned int robot = 0; robot < num_robots; ++robot)
-                    {
-                        if(allocation(task_i, robot) && allocation(task_j, robot))
-                        {
-                            transition_info.push_back(
-                                RobotTaskTransitionInfo{.robot_nr           = robot,
-                                                        .computation_status = TransitionComputationStatus::e_none,
-                                                        .duration           = -1.0});
-                        }
-                    }
+                    allocated_tasks.push_back(task_nr);
                 }
-                inner_vec.emplace_back(transition_info);
             }
-            m_transition_info.emplace_back(inner_vec);
 
-            transition_info.resize(0);
-            for(unsigned int robot = 0; robot < num_robots; ++robot)
+            for(unsigned int task_i: allocated_tasks)
             {
-                if(allocation(task_i, robot))
+                m_initial_transition_info[task_i].push_back(
+                    RobotTaskTransitionInfo{.robot_nr           = robot,
+                                            .computation_status = TransitionComputationStatus::e_none,
+                                            .duration           = -1.0});
+                for(unsigned int task_j: allocated_tasks)
                 {
-                    transition_info.push_back(
-                        RobotTaskTransitionInfo{.robot_nr           = robot,
-                                                .computation_status = TransitionComputationStatus::e_none,
-                                                .duration           = -1.0});
+                    // Ignore self transitions
+                    if(task_i != task_j)
+                    {
+                        transitions.emplace_back(task_i, task_j, robot);
+                    }
                 }
             }
-            m_initial_transition_info.push_back(transition_info);
+        }
+
+        // Group the transitions by pair of tasks
+        std::sort(transitions.begin(), transitions.end());
+        m_transition_info.reserve(transitions.size());
+        for(const auto& [task_i, task_j, robot]: transitions)
+        {
+            if(m_task_pair_transitions.empty() || m_task_pair_transitions.back().task_i != task_i ||
+               m_task_pair_transitions.back().task_j != task_j)
+            {
+                const unsigned int index = m_transition_info.size();
+                m_task_pair_index[std::pair(task_i, task_j)] = m_task_pair_transitions.size();
+                m_task_pair_transitions.push_back(
+                    TaskPairTransitionInfo{.task_i = task_i, .task_j = task_j, .begin = index, .end = index});
+            }
+            m_transition_info.push_back(
+                RobotTaskTransitionInfo{.robot_nr           = robot,
+                                        .computation_status = TransitionComputationStatus::e_none,
+                                        .duration           = -1.0});
+            ++m_task_pair_transitions.back().end;
         }
     }
 
@@ -288,14 +303,14 @@ namespace grstapse
             {
                 model.addConstr(m_tasks_timepoints[task_i].start >=
                                 m_tasks_timepoints[task_j].finish + j_to_i_transition_duration);
-                m_mp_induced_precedence_constraints.insert(std::pair(task_i, task_j));
+                m_mp_induced_precedence_constraints.insert(std::pair(task_j, task_i));
                 continue;
             }
             else if(j_to_i_mp_failure)  // i -> j precedence is forced by mp
             {
                 model.addConstr(m_tasks_timepoints[task_j].start >=
                                 m_tasks_timepoints[task_i].finish + i_to_j_transition_duration);
-                m_mp_induced_precedence_constraints.insert(std::pair(task_j, task_i));
+                m_mp_induced_precedence_constraints.insert(std::pair(task_i, task_j));
                 continue;
             }
 
@@ -376,7 +391,8 @@ namespace grstapse
 
     bool DeterministicMilpSchedulerBase::computeInitialTransitionHeuristicDurations()
     {
-        const unsigned int num_tasks = m_problem_inputs->numberOfPlanTasks();
+        const unsigned int num_tasks                                    = m_problem_inputs->numberOfPlanTasks();
+        const std::shared_ptr<TransitionDurationMatrix>& duration_matrix = m_problem_inputs->transitionDurationMatrix();
         for(unsigned int task_nr = 0; task_nr < num_tasks; ++task_nr)
         {
             TaskTransitionInfo& task_transition_info = m_initial_transition_info[task_nr];
@@ -385,16 +401,22 @@ namespace grstapse
 
             for(RobotTaskTransitionInfo& robot_task_transition_info: task_transition_info)
             {
-                const std::shared_ptr<const Robot>& robot =
-                    m_problem_inputs->robot(robot_task_transition_info.robot_nr);
-                bool is_memoized = isInitialTransitionMemoized(task_initial_configuration, robot);
-
-                if(is_memoized)
+                const unsigned int robot_nr = robot_task_transition_info.robot_nr;
+                std::optional<float> duration = duration_matrix->initialTransitionDuration(robot_nr, task_nr);
+                if(!duration.has_value())
                 {
-                    const float duration = computeInitialTransitionDuration(task_initial_configuration, robot);
+                    const std::shared_ptr<const Robot>& robot = m_problem_inputs->robot(robot_nr);
+                    if(isInitialTransitionMemoized(task_initial_configuration, robot))
+                    {
+                        duration = computeInitialTransitionDuration(task_initial_configuration, robot);
+                        duration_matrix->setInitialTransitionDuration(robot_nr, task_nr, duration.value());
+                    }
+                }
 
+                if(duration.has_value())
+                {
                     // Transition fails
-                    if(duration < 0.0)
+                    if(duration.value() < 0.0)
                     {
                         robot_task_transition_info.computation_status = TransitionComputationStatus::e_failed;
                         return false;
@@ -402,98 +424,113 @@ namespace grstapse
 
                     // Transition succeeds
                     robot_task_transition_info.computation_status = TransitionComputationStatus::e_success;
-                    robot_task_transition_info.duration           = duration;
+                    robot_task_transition_info.duration           = duration.value();
                 }
                 else
                 {
-                    const std::shared_ptr<const ConfigurationBase>& initial_configuration =
-                        robot->initialConfiguration();
                     robot_task_transition_info.computation_status = TransitionComputationStatus::e_heuristic;
                     robot_task_transition_info.duration =
-                        computeInitialTransitionHeuristicDuration(task_initial_configuration, robot);
+                        duration_matrix->initialTransitionHeuristicDuration(robot_nr, task_nr);
                 }
             }
         }
         return true;
     }
 
-    float DeterministicMilpSchedulerBase::computeInitialTransitionHeuristicDuration(
-        const std::shared_ptr<const ConfigurationBase>& configuration,
-        const std::shared_ptr<const Robot>& robot) const
-    {
-        return robot->initialConfiguration()->euclideanDistance(configuration) / robot->speed();
-    }
-
     bool DeterministicMilpSchedulerBase::computeTransitionHeuristicDurations()
     {
-        const unsigned int num_tasks  = m_problem_inputs->numberOfPlanTasks();
-        const unsigned int num_robots = m_problem_inputs->numberOfRobots();
+        const std::shared_ptr<TransitionDurationMatrix>& duration_matrix = m_problem_inputs->transitionDurationMatrix();
 
-        for(unsigned int task_i = 0; task_i < num_tasks; ++task_i)
+        // Note: self transitions and pairs of tasks that do not share a robot have no transitions, so they are not
+        //       in the list
+        for(const TaskPairTransitionInfo& task_pair_transition_info: m_task_pair_transitions)
         {
-            for(unsigned int task_j = 0; task_j < num_tasks; ++task_j)
+            const unsigned int task_i = task_pair_transition_info.task_i;
+            const unsigned int task_j = task_pair_transition_info.task_j;
+            const std::shared_ptr<const ConfigurationBase>& task_i_terminal_configuration =
+                m_problem_inputs->planTask(task_i)->terminalConfiguration();
+            const std::shared_ptr<const ConfigurationBase>& task_j_initial_configuration =
+                m_problem_inputs->planTask(task_j)->initialConfiguration();
+
+            for(unsigned int index = task_pair_transition_info.begin; index < task_pair_transition_info.end; ++index)
             {
-                if(task_i == task_j)
+                RobotTaskTransitionInfo& robot_task_transition_info = m_transition_info[index];
+                const unsigned int robot_nr                         = robot_task_transition_info.robot_nr;
+                std::optional<float> duration = duration_matrix->transitionDuration(robot_nr, task_i, task_j);
+                if(!duration.has_value())
                 {
-                    continue;
+                    const std::shared_ptr<const Robot>& robot = m_problem_inputs->robot(robot_nr);
+                    if(isTransitionMemoized(task_i_terminal_configuration, task_j_initial_configuration, robot))
+                    {
+                        duration = computeTransitionDuration(task_i_terminal_configuration,
+                                                             task_j_initial_configuration,
+                                                             robot);
+                        duration_matrix->setTransitionDuration(robot_nr, task_i, task_j, duration.value());
+                    }
                 }
 
-                const std::shared_ptr<const ConfigurationBase>& task_i_terminal_configuration =
-                    m_problem_inputs->planTask(task_i)->terminalConfiguration();
-                const std::shared_ptr<const ConfigurationBase>& task_j_initial_configuration =
-                    m_problem_inputs->planTask(task_j)->initialConfiguration();
-
-                for(RobotTaskTransitionInfo& robot_task_transition_info: m_transition_info[task_i][task_j])
+                if(duration.has_value())
                 {
-                    const std::shared_ptr<const Robot>& robot =
-                        m_problem_inputs->robot(robot_task_transition_info.robot_nr);
-                    bool is_memoized =
-                        isTransitionMemoized(task_i_terminal_configuration, task_j_initial_configuration, robot);
-
-                    if(is_memoized)
-                    {
-                        const float duration = computeTransitionDuration(task_i_terminal_configuration,
-                                                                         task_j_initial_configuration,
-                                                                         robot);
-
-                        // Transition fails
-                        if(duration < 0.0)
-                        {
-                            robot_task_transition_info.computation_status = TransitionComputationStatus::e_failed;
-                            return false;
-                        }
-
-                        // Transition succeeds
-                        robot_task_transition_info.computation_status = TransitionComputationStatus::e_success;
-                        robot_task_transition_info.duration           = duration;
-                    }
-                    else
+                    // Transition fails
+                    if(duration.value() < 0.0)
                     {
-                        const float duration = computeTransitionHeuristicDuration(task_i_terminal_configuration,
-                                                                                  task_j_initial_configuration,
-                                                                                  robot);
-                        robot_task_transition_info.computation_status = TransitionComputationStatus::e_heuristic;
-                        robot_task_transition_info.duration           = duration;
+                        robot_task_transition_info.computation_status = TransitionComputationStatus::e_failed;
+                        return false;
                     }
+
+                    // Transition succeeds
+                    robot_task_transition_info.computation_status = TransitionComputationStatus::e_success;
+                    robot_task_transition_info.duration           = duration.value();
+                }
+                else
+                {
+                    robot_task_transition_info.computation_status = TransitionComputationStatus::e_heuristic;
+                    robot_task_transition_info.duration =
+                        duration_matrix->transitionHeuristicDuration(robot_nr, task_i, task_j);
                 }
             }
         }
         return true;
     }
 
-    float DeterministicMilpSchedulerBase::computeTransitionHeuristicDuration(
-        const std::shared_ptr<const ConfigurationBase>& initial_configuration,
-        const std::shared_ptr<const ConfigurationBase>& goal_configuration,
-        const std::shared_ptr<const Robot>& robot) const
+    float DeterministicMilpSchedulerBase::queryTransitionDuration(const unsigned int robot_nr,
+                                                                  const int previous_task_nr,
+                                                                  const unsigned int task_nr)
     {
-        return initial_configuration->euclideanDistance(goal_configuration) / robot->speed();
+        const std::shared_ptr<TransitionDurationMatrix>& duration_matrix = m_problem_inputs->transitionDurationMatrix();
+        const std::shared_ptr<const Robot>& robot                        = m_problem_inputs->robot(robot_nr);
+        const std::shared_ptr<const ConfigurationBase>& task_initial_configuration =
+            m_problem_inputs->planTask(task_nr)->initialConfiguration();
+
+        if(previous_task_nr < 0)
+        {
+            if(std::optional<float> duration = duration_matrix->initialTransitionDuration(robot_nr, task_nr);
+               duration.has_value())
+            {
+                return duration.value();
+            }
+            const float duration = robot->durationQuery(task_initial_configuration);
+            duration_matrix->setInitialTransitionDuration(robot_nr, task_nr, duration);
+            return duration;
+        }
+
+        if(std::optional<float> duration = duration_matrix->transitionDuration(robot_nr, previous_task_nr, task_nr);
+           duration.has_value())
+        {
+            return duration.value();
+        }
+        const float duration =
+            robot->durationQuery(m_problem_inputs->planTask(previous_task_nr)->terminalConfiguration(),
+                                 task_initial_configuration);
+        duration_matrix->setTransitionDuration(robot_nr, previous_task_nr, task_nr, duration);
+        return duration;
     }
 
     std::pair<bool, float> DeterministicMilpSchedulerBase::checkTransitionFeasibility(const unsigned int i,
                                                                                       const unsigned int j)
     {
         float duration = 0.0;
-        for(const RobotTaskTransitionInfo& robot_task_transition_info: m_transition_info[i][j])
+        for(const RobotTaskTransitionInfo& robot_task_transition_info: transitionInfo(i, j))
         {
             switch(robot_task_transition_info.computation_status)
             {
@@ -517,4 +554,17 @@ namespace grstapse
         return std::pair(false, duration);
     }
 
+    std::span<RobotTaskTransitionInfo> DeterministicMilpSchedulerBase::transitionInfo(const unsigned int i,
+                                                                                      const unsigned int j)
+    {
+        auto iter = m_task_pair_index.find(std::pair(i, j));
+        if(iter == m_task_pair_index.end())
+        {
+            return {};
+        }
+        const TaskPairTransitionInfo& task_pair_transition_info = m_task_pair_transitions[iter->second];
+        return std::span(m_transition_info.data() + task_pair_transition_info.begin,
+                         task_pair_transition_info.end - task_pair_transition_info.begin);
+    }
+
 }  // namespace grstapse
\ No newline at end of file
@@ -22,6 +22,15 @@
  */
 #include "grstapse/scheduling/milp/deterministic/deterministic_schedule.hpp"
 
+// Global
+#include <algorithm>
+// External
+#include <fmt/format.h>
+// Local
+#include "grstapse/common/utilities/error.hpp"
+#include "grstapse/scheduling/earliest_timepoint_propagation.hpp"
+#include "grstapse/scheduling/milp/deterministic/schedule_repair_inputs.hpp"
+
 namespace grstapse {
     DeterministicSchedule::DeterministicSchedule(
             const float makespan,
@@ -35,4 +44,79 @@ namespace grstapse {
         m_precedence_set_mutex_constraints = toCopy.m_precedence_set_mutex_constraints;
     }
 
+    std::shared_ptr<const DeterministicSchedule> DeterministicSchedule::repair(
+            const ScheduleRepairInputs &inputs) const {
+        const unsigned int num_tasks = m_timepoints.size();
+        if (inputs.task_statuses.size() != num_tasks || inputs.initial_transition_durations.size() != num_tasks ||
+            (!inputs.task_durations.empty() && inputs.task_durations.size() != num_tasks) ||
+            inputs.mutex_transition_durations.size() != m_precedence_set_mutex_constraints.size()) {
+            throw createLogicError(fmt::format("Schedule repair inputs do not match the schedule ({0:d} tasks)",
+                                               num_tasks));
+        }
+
+        std::vector<float> durations(num_tasks);
+        std::vector<float> release_times(num_tasks);
+        for (unsigned int task_nr = 0; task_nr < num_tasks; ++task_nr) {
+            const auto &[start, finish] = m_timepoints[task_nr];
+            durations[task_nr] = inputs.task_durations.empty() || inputs.task_durations[task_nr] < 0.0f
+                                 ? finish - start
+                                 : inputs.task_durations[task_nr];
+            switch (inputs.task_statuses[task_nr]) {
+                case TaskExecutionStatus::e_pending: {
+                    if (inputs.initial_transition_durations[task_nr] < 0.0f) {
+                        return nullptr;
+                    }
+                    release_times[task_nr] = std::max(inputs.current_time,
+                                                      inputs.initial_transition_durations[task_nr]);
+                    break;
+                }
+                case TaskExecutionStatus::e_in_progress: {
+                    // Still executing, so it cannot finish before the current time
+                    release_times[task_nr] = start;
+                    durations[task_nr] = std::max(durations[task_nr], inputs.current_time - start);
+                    break;
+                }
+                case TaskExecutionStatus::e_completed: {
+                    release_times[task_nr] = start;
+                    break;
+                }
+            }
+        }
+
+        std::vector<TemporalArc> arcs;
+        arcs.reserve(inputs.precedence_constraints.size() + m_precedence_set_mutex_constraints.size());
+        // Returns whether the arc is consistent with the tasks that have already started
+        auto add_arc = [&inputs, &arcs](const TemporalArc &arc) -> bool {
+            if (arc.lag < 0.0f) {
+                return false;
+            }
+            if (inputs.task_statuses[arc.successor] == TaskExecutionStatus::e_pending) {
+                arcs.push_back(arc);
+                return true;
+            }
+            // The successor has already started so the predecessor must have as well (and the arc is in the past)
+            return inputs.task_statuses[arc.predecessor] != TaskExecutionStatus::e_pending;
+        };
+        for (const TemporalArc &arc: inputs.precedence_constraints) {
+            if (!add_arc(arc)) {
+                return nullptr;
+            }
+        }
+        for (unsigned int i = 0; i < m_precedence_set_mutex_constraints.size(); ++i) {
+            const auto &[predecessor, successor] = m_precedence_set_mutex_constraints[i];
+            if (!add_arc(TemporalArc{.predecessor = predecessor,
+                                     .successor = successor,
+                                     .lag = inputs.mutex_transition_durations[i]})) {
+                return nullptr;
+            }
+        }
+
+        std::vector<std::pair<float, float>> timepoints;
+        const float makespan = propagateEarliestTimepoints(durations, release_times, arcs, timepoints);
+        if (makespan < 0.0f) {
+            return nullptr;
+        }
+        return std::make_shared<const DeterministicSchedule>(makespan, timepoints, m_precedence_set_mutex_constraints);
+    }
+
 }  // namespace grstapse
\ No newline at end of file
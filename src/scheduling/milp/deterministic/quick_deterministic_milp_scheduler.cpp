@@ -100,24 +100,15 @@ namespace grstapse
 
         const unsigned int num_robots = m_problem_inputs->numberOfRobots();
         std::vector<int> previous_task(num_robots, -1);
-        std::vector<std::shared_ptr<const ConfigurationBase>> previous_configurations;
-        previous_configurations.reserve(num_robots);
-        for(const std::shared_ptr<const Robot>& robot: m_problem_inputs->robots())
-        {
-            previous_configurations.push_back(robot->initialConfiguration());
-        }
 
         for(TaskVariableInfo& task_timepoint: m_tasks_timepoints)
         {
-            const std::shared_ptr<const Task>& task = m_problem_inputs->planTask(task_timepoint.task_nr);
-            const std::shared_ptr<const ConfigurationBase>& initial_configuration  = task->initialConfiguration();
-            const std::shared_ptr<const ConfigurationBase>& terminal_configuration = task->terminalConfiguration();
             for(unsigned int robot_nr: task_timepoint.coalition)
             {
                 const bool first_task = previous_task[robot_nr] < 0;
-                TaskTransitionInfo& task_transition_info =
-                    previous_task[robot_nr] < 0 ? m_initial_transition_info[task_timepoint.task_nr]
-                                                : m_transition_info[previous_task[robot_nr]][task_timepoint.task_nr];
+                std::span<RobotTaskTransitionInfo> task_transition_info =
+                    previous_task[robot_nr] < 0 ? std::span(m_initial_transition_info[task_timepoint.task_nr])
+                                                : transitionInfo(previous_task[robot_nr], task_timepoint.task_nr);
                 for(RobotTaskTransitionInfo& robot_task_transition_info: task_transition_info)
                 {
                     if(robot_task_transition_info.robot_nr != robot_nr)
@@ -137,8 +128,7 @@ namespace grstapse
                         case TransitionComputationStatus::e_heuristic:
                         {
                             const float transition_duration =
-                                m_problem_inputs->robot(robot_nr)->durationQuery(previous_configurations[robot_nr],
-                                                                                 initial_configuration);
+                                queryTransitionDuration(robot_nr, previous_task[robot_nr], task_timepoint.task_nr);
                             robot_task_transition_info.computation_status = TransitionComputationStatus::e_success;
                             robot_task_transition_info.duration           = transition_duration;
 
@@ -33,6 +33,7 @@ namespace grstapse
 {
     MilpSchedulerParameters::MilpSchedulerParameters()
         : SchedulerParameters(SchedulerType::e_milp)
+        , geodesic_transition_heuristic(false)
     {}
 
     std::shared_ptr<const MilpSchedulerParameters> MilpSchedulerParameters::deserializeFromJson(const nlohmann::json& j)
@@ -68,5 +69,9 @@ namespace grstapse
         j[constants::k_timeout].get_to(timeout);
         j[constants::k_threads].get_to(threads);
         j[constants::k_compute_transition_duration_heuristic].get_to(compute_transition_duration_heuristic);
+        if(j.contains(constants::k_geodesic_transition_heuristic))
+        {
+            j.at(constants::k_geodesic_transition_heuristic).get_to(geodesic_transition_heuristic);
+        }
     }
 }  // namespace grstapse
\ No newline at end of file
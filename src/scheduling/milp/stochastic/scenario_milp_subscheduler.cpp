@@ -29,6 +29,7 @@
 #include "grstapse/geometric_planning/graph/point/point_graph_configuration.hpp"
 #include "grstapse/geometric_planning/graph/point/sampled_point_graph_motion_planner.hpp"
 #include "grstapse/robot.hpp"
+#include "grstapse/scheduling/earliest_timepoint_propagation.hpp"
 #include "grstapse/scheduling/scheduler_problem_inputs.hpp"
 #include "grstapse/task.hpp"
 
@@ -88,31 +89,31 @@ namespace grstapse
         return fmt::format("tc_({0:d}, {1:d})^{2:d}", i, j, m_index);
     }
 
+    bool ScenarioMilpSubscheduler::createMutexConstraints(GRBModel& model)
+    {
+        // Note: the mutex constraints that are forced in any scenario are mp induced precedence constraints instead
+        for(const auto& [p_ij_name, info]: m_reduced_mutex_constraints)
+        {
+            auto [i_to_j_mp_failure, i_to_j_transition_duration] = checkTransitionFeasibility(info.task_i, info.task_j);
+            auto [j_to_i_mp_failure, j_to_i_transition_duration] = checkTransitionFeasibility(info.task_j, info.task_i);
+            if(i_to_j_mp_failure || j_to_i_mp_failure)
+            {
+                return false;
+            }
+            addMutexConstraint(model, info.task_i, i_to_j_transition_duration, info.task_j, j_to_i_transition_duration);
+        }
+        return true;
+    }
+
     void ScenarioMilpSubscheduler::addMutexConstraint(GRBModel& model,
                                                       const unsigned int i,
                                                       const double i_to_j_transition_duration,
                                                       const unsigned int j,
                                                       const double j_to_i_transition_duration)
     {
+        // Note: the variable is shared by all scenarios and is created by the StochasticMilpScheduler
         const std::string p_ij_name = fmt::format("p_({0:d},{1:d})", i, j);
-        GRBVar p_ij;
-        if(m_index == 0)
-        {
-            p_ij = model.addVar(0.0, 1.0, 0.0, GRB_BINARY, p_ij_name);
-            if(m_reduced_mutex_constraints.contains(p_ij_name))
-            {
-                m_reduced_mutex_constraints[p_ij_name].variable = p_ij;
-            }
-            else
-            {
-                m_reduced_mutex_constraints[p_ij_name] =
-                    MutexConstraintInfo{.task_i = i, .task_j = j, .variable_name = p_ij_name, .variable = p_ij};
-            }
-        }
-        else
-        {
-            p_ij = m_reduced_mutex_constraints[p_ij_name].variable;
-        }
+        GRBVar p_ij                 = m_reduced_mutex_constraints.at(p_ij_name).variable;
 
         // i -> j
         model.addGenConstrIndicator(
@@ -190,17 +191,137 @@ namespace grstapse
 
     bool ScenarioMilpSubscheduler::createObjective(GRBModel& model)
     {
-        GRBVar global_makespan   = model.getVarByName(constants::k_makespan);
         GRBVar scenario_makespan = model.addVar(0.0,
                                                 GRB_INFINITY,
                                                 0.0,
                                                 GRB_CONTINUOUS,
                                                 fmt::format("{0:s}_{1:d}", constants::k_makespan, m_index));
-        GRBVar y_i               = model.addVar(0.0, 1.0, 0.0, GRB_BINARY, fmt::format("y_{0:d}", m_index));
-        model.addGenConstrIndicator(y_i, 0, scenario_makespan <= global_makespan, fmt::format("yc_{0:d}", m_index));
+        model.addGenConstrMax(scenario_makespan, m_task_finishes.get(), m_tasks_timepoints.size());
+
+        // y_i = 1 -> the scenario counts towards the chance constraint
+        m_satisfied = model.addVar(0.0, 1.0, 0.0, GRB_BINARY, fmt::format("y_{0:d}", m_index));
+        model.addGenConstrIndicator(m_satisfied, 1, scenario_makespan <= m_makespan, fmt::format("yc_{0:d}", m_index));
         return true;
     }
 
+    bool ScenarioMilpSubscheduler::computeScenarioDurations()
+    {
+        const unsigned int num_tasks      = m_problem_inputs->numberOfPlanTasks();
+        const unsigned int num_robots     = m_problem_inputs->numberOfRobots();
+        const Eigen::MatrixXf& allocation = m_problem_inputs->allocation();
+
+        // Task durations
+        std::vector<std::shared_ptr<const Robot>> coalition;
+        for(unsigned int task_nr = 0; task_nr < num_tasks; ++task_nr)
+        {
+            coalition.resize(0);
+            for(unsigned int robot_nr = 0; robot_nr < num_robots; ++robot_nr)
+            {
+                if(allocation(task_nr, robot_nr))
+                {
+                    coalition.push_back(m_problem_inputs->robot(robot_nr));
+                }
+            }
+
+            m_task_durations[task_nr] = computeTaskDuration(task_nr, coalition);
+            if(m_task_durations[task_nr] < 0.0f)
+            {
+                return false;
+            }
+        }
+
+        // Initial transitions
+        for(unsigned int task_nr = 0; task_nr < num_tasks; ++task_nr)
+        {
+            const std::shared_ptr<const ConfigurationBase>& task_initial_configuration =
+                m_problem_inputs->planTask(task_nr)->initialConfiguration();
+            for(RobotTaskTransitionInfo& robot_task_transition_info: m_initial_transition_info[task_nr])
+            {
+                const float duration = computeInitialTransitionDuration(
+                    task_initial_configuration,
+                    m_problem_inputs->robot(robot_task_transition_info.robot_nr));
+                if(duration < 0.0f)
+                {
+                    robot_task_transition_info.computation_status = TransitionComputationStatus::e_failed;
+                    return false;
+                }
+                robot_task_transition_info.computation_status = TransitionComputationStatus::e_success;
+                robot_task_transition_info.duration           = duration;
+            }
+        }
+
+        // Transitions (only between tasks that are ordered by either a precedence or a mutex constraint)
+        auto compute_transitions = [this](const unsigned int task_i, const unsigned int task_j) -> bool
+        {
+            const std::shared_ptr<const ConfigurationBase>& task_i_terminal_configuration =
+                m_problem_inputs->planTask(task_i)->terminalConfiguration();
+            const std::shared_ptr<const ConfigurationBase>& task_j_initial_configuration =
+                m_problem_inputs->planTask(task_j)->initialConfiguration();
+
+            bool success = true;
+            for(RobotTaskTransitionInfo& robot_task_transition_info: transitionInfo(task_i, task_j))
+            {
+                if(robot_task_transition_info.computation_status == TransitionComputationStatus::e_none)
+                {
+                    const float duration =
+                        computeTransitionDuration(task_i_terminal_configuration,
+                                                  task_j_initial_configuration,
+                                                  m_problem_inputs->robot(robot_task_transition_info.robot_nr));
+                    robot_task_transition_info.computation_status = duration < 0.0f
+                                                                        ? TransitionComputationStatus::e_failed
+                                                                        : TransitionComputationStatus::e_success;
+                    robot_task_transition_info.duration = duration;
+                }
+                success &= robot_task_transition_info.computation_status != TransitionComputationStatus::e_failed;
+            }
+            return success;
+        };
+
+        for(const auto& [predecessor, successor]: m_problem_inputs->precedenceConstraints())
+        {
+            if(!compute_transitions(predecessor, successor))
+            {
+                return false;
+            }
+        }
+
+        // Note: a failure here only forces the direction of the mutex constraint
+        for(const auto& [task_i, task_j]: m_problem_inputs->mutexConstraints())
+        {
+            compute_transitions(task_i, task_j);
+            compute_transitions(task_j, task_i);
+        }
+        return true;
+    }
+
+    float ScenarioMilpSubscheduler::evaluateOrdering(const std::vector<std::pair<unsigned int, unsigned int>>& ordering,
+                                                     std::vector<std::pair<float, float>>& timepoints)
+    {
+        const unsigned int num_tasks = m_problem_inputs->numberOfPlanTasks();
+
+        std::vector<float> release_times(num_tasks, 0.0f);
+        for(unsigned int task_nr = 0; task_nr < num_tasks; ++task_nr)
+        {
+            for(const RobotTaskTransitionInfo& robot_task_transition_info: m_initial_transition_info[task_nr])
+            {
+                release_times[task_nr] = std::max(release_times[task_nr], robot_task_transition_info.duration);
+            }
+        }
+
+        return propagateEarliestTimepoints(
+            m_task_durations,
+            release_times,
+            [this](const unsigned int predecessor, const unsigned int successor)
+            {
+                auto [mp_failure, transition_duration] = checkTransitionFeasibility(predecessor, successor);
+                return mp_failure ? -1.0f : transition_duration;
+            },
+            timepoints,
+            m_problem_inputs->precedenceConstraints(),
+            m_mp_induced_precedence_constraints,
+            ordering);
+    }
+
     std::shared_ptr<const ScheduleBase> ScenarioMilpSubscheduler::computeSchedule()
     {
         // Intentional
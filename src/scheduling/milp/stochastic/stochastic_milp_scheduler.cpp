@@ -22,10 +22,19 @@
  */
 #include "grstapse/scheduling/milp/stochastic/stochastic_milp_scheduler.hpp"
 
+// Global
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
 // External
 #include <fmt/format.h>
 // Local
 #include "grstapse/common/utilities/constants.hpp"
+#include "grstapse/common/utilities/error.hpp"
+#include "grstapse/common/utilities/logger.hpp"
+#include "grstapse/common/utilities/parallel_for.hpp"
+#include "grstapse/scheduling/milp/deterministic/deterministic_schedule.hpp"
 #include "grstapse/scheduling/milp/stochastic/stochastic_milp_scheduler_parameters.hpp"
 #include "grstapse/scheduling/scheduler_problem_inputs.hpp"
 
@@ -41,6 +50,12 @@ namespace grstapse
                                          problem_inputs->schedulerParameters())
                                          ->alpha)
     {
+        if(!s_environment_setup)
+        {
+            initGurobi(
+                std::dynamic_pointer_cast<const MilpSchedulerParameters>(m_problem_inputs->schedulerParameters()));
+        }
+
         m_subschedulers.reserve(m_num_scenario);
         for(unsigned int i = 0; i < m_num_scenario; ++i)
         {
@@ -50,9 +65,9 @@ namespace grstapse
 
     bool StochasticMilpScheduler::createTaskDurations(GRBModel& model)
     {
-        for(ScenarioMilpSubscheduler& subscheduler: m_subschedulers)
+        for(unsigned int scenario: m_active_scenarios)
         {
-            if(!subscheduler.createTaskDurations(model))
+            if(!m_subschedulers[scenario].createTaskDurations(model))
             {
                 return false;
             }
@@ -62,9 +77,9 @@ namespace grstapse
 
     bool StochasticMilpScheduler::createPrecedenceConstraints(GRBModel& model)
     {
-        for(ScenarioMilpSubscheduler& subscheduler: m_subschedulers)
+        for(unsigned int scenario: m_active_scenarios)
         {
-            if(!subscheduler.createPrecedenceConstraints(model))
+            if(!m_subschedulers[scenario].createPrecedenceConstraints(model))
             {
                 return false;
             }
@@ -74,9 +89,15 @@ namespace grstapse
 
     bool StochasticMilpScheduler::createMutexConstraints(GRBModel& model)
     {
-        for(ScenarioMilpSubscheduler& subscheduler: m_subschedulers)
+        // The ordering variables are shared between all of the scenarios
+        for(auto& [p_ij_name, info]: m_reduced_mutex_constraints)
         {
-            if(!subscheduler.createMutexConstraints(model))
+            info.variable = model.addVar(0.0, 1.0, 0.0, GRB_BINARY, p_ij_name);
+        }
+
+        for(unsigned int scenario: m_active_scenarios)
+        {
+            if(!m_subschedulers[scenario].createMutexConstraints(model))
             {
                 return false;
             }
@@ -86,9 +107,9 @@ namespace grstapse
 
     bool StochasticMilpScheduler::createInitialTransitions(GRBModel& model)
     {
-        for(ScenarioMilpSubscheduler& subscheduler: m_subschedulers)
+        for(unsigned int scenario: m_active_scenarios)
         {
-            if(!subscheduler.createInitialTransitions(model))
+            if(!m_subschedulers[scenario].createInitialTransitions(model))
             {
                 return false;
             }
@@ -102,28 +123,245 @@ namespace grstapse
         model.set(GRB_IntAttr_ModelSense, GRB_MINIMIZE);
 
         // Top level of the objective is minimizing makespan
-        GRBVar makespan = model.addVar(0.0, GRB_INFINITY, 0.0, GRB_CONTINUOUS, constants::k_makespan);
-        for(ScenarioMilpSubscheduler& subscheduler: m_subschedulers)
+        m_makespan = model.addVar(0.0, GRB_INFINITY, 0.0, GRB_CONTINUOUS, constants::k_makespan);
+        GRBLinExpr alpha_summation;
+        for(unsigned int scenario: m_active_scenarios)
         {
+            ScenarioMilpSubscheduler& subscheduler = m_subschedulers[scenario];
+            subscheduler.m_makespan                = m_makespan;
             if(!subscheduler.createObjective(model))
             {
                 return false;
             }
+            alpha_summation += subscheduler.m_satisfied;
         }
 
-        GRBLinExpr alpha_summation;
-        for(unsigned int i = 0; i < m_num_scenario; ++i)
+        // Inactive scenarios are assumed to be satisfied (relaxation)
+        const double num_inactive = m_num_scenario - m_active_scenarios.size();
+        model.addConstr(alpha_summation + num_inactive >= numRequiredScenarios());
+        model.setObjective(GRBLinExpr(m_makespan));
+        return true;
+    }
+
+    std::shared_ptr<const ScheduleBase> StochasticMilpScheduler::computeSchedule()
+    {
+        auto parameters =
+            std::dynamic_pointer_cast<const StochasticMilpSchedulerParameters>(m_problem_inputs->schedulerParameters());
+        const unsigned int num_threads = parameters->scenario_threads;
+
+        // Motion planning for each scenario only uses that scenario's graph, so the scenarios are independent
+        std::vector<char> scenario_success(m_num_scenario, false);  // Note: not std::vector<bool> (not thread-safe)
+        parallelFor(
+            0,
+            m_num_scenario,
+            [this, &scenario_success](const unsigned int scenario)
+            {
+                scenario_success[scenario] = m_subschedulers[scenario].computeScenarioDurations();
+            },
+            num_threads);
+        if(std::find(scenario_success.begin(), scenario_success.end(), false) != scenario_success.end() ||
+           !reduceMutexConstraints())
         {
-            alpha_summation += model.getVarByName(fmt::format("y_{0:d}", i));
+            ++s_num_failures;
+            return nullptr;
+        }
+
+        const unsigned int num_required = numRequiredScenarios();
+        auto compute_quantile = [num_required](std::vector<float> makespans) -> float
+        {
+            std::nth_element(makespans.begin(), makespans.begin() + (num_required - 1), makespans.end());
+            return makespans[num_required - 1];
+        };
+
+        // Seed the master problem with the scenarios that have the largest lower bounds (precedence constraints only)
+        std::vector<float> makespans = evaluateScenarios({}, num_threads);
+        std::vector<unsigned int> inactive(m_num_scenario);
+        std::iota(inactive.begin(), inactive.end(), 0);
+        auto activate = [this, &inactive, &makespans, &parameters](const float threshold)
+        {
+            std::sort(inactive.begin(),
+                      inactive.end(),
+                      [&makespans](const unsigned int lhs, const unsigned int rhs)
+                      {
+                          return makespans[lhs] > makespans[rhs];
+                      });
+            unsigned int num_added = 0;
+            while(!inactive.empty() && num_added < std::max(parameters->scenarios_per_iteration, 1u) &&
+                  makespans[inactive.front()] > threshold)
+            {
+                m_active_scenarios.push_back(inactive.front());
+                inactive.erase(inactive.begin());
+                ++num_added;
+            }
+            return num_added;
+        };
+        m_active_scenarios.clear();
+        activate(-1.0f);
+
+        float upper_bound = std::numeric_limits<float>::infinity();
+        std::vector<std::pair<unsigned int, unsigned int>> best_ordering;
+        std::vector<std::pair<unsigned int, unsigned int>> ordering;
+        ordering.reserve(m_reduced_mutex_constraints.size());
+        while(true)
+        {
+            ++s_num_iterations;
+            GRBModel model(s_environment);
+            if(!createModel(model))
+            {
+                ++s_num_failures;
+                return nullptr;
+            }
+
+            // Optimize master problem
+            model.optimize();
+
+            // Check status
+            if(model.get(GRB_IntAttr_Status) != GRB_OPTIMAL)
+            {
+                ++s_num_failures;
+                return nullptr;
+            }
+            const float lower_bound     = model.get(GRB_DoubleAttr_ObjBound);
+            const float master_makespan = m_makespan.get(GRB_DoubleAttr_X);
+
+            ordering.resize(0);
+            for(auto& [key, info]: m_reduced_mutex_constraints)
+            {
+                if(info.variable.get(GRB_DoubleAttr_X) > 0.5f)
+                {
+                    ordering.push_back(std::pair(info.task_i, info.task_j));
+                }
+                else
+                {
+                    ordering.push_back(std::pair(info.task_j, info.task_i));
+                }
+            }
+
+            // Subproblems: evaluate the ordering on all scenarios
+            makespans = evaluateScenarios(ordering, num_threads);
+            if(std::any_of(makespans.begin(),
+                           makespans.end(),
+                           [](const float makespan)
+                           {
+                               return makespan < 0.0f;
+                           }))
+            {
+                throw createLogicError("Ordering from the master problem is infeasible for a scenario");
+            }
+            if(const float quantile = compute_quantile(makespans); quantile < upper_bound)
+            {
+                upper_bound   = quantile;
+                best_ordering = ordering;
+            }
+
+#ifdef DEBUG
+            Logger::debug("Stochastic scheduling: {0:d} active scenarios; bounds [{1:f}, {2:f}]",
+                          m_active_scenarios.size(),
+                          lower_bound,
+                          upper_bound);
+#endif
+
+            // Converged or every scenario is covered by the master problem's makespan
+            if(inactive.empty() || upper_bound - lower_bound <= parameters->decomposition_gap * upper_bound ||
+               activate(master_makespan + 1e-4f) == 0)
+            {
+                break;
+            }
+        }
+
+        // Report the schedule of the scenario that defines the quantile
+        makespans = evaluateScenarios(best_ordering, num_threads);
+        std::vector<unsigned int> scenarios(m_num_scenario);
+        std::iota(scenarios.begin(), scenarios.end(), 0);
+        std::nth_element(scenarios.begin(),
+                         scenarios.begin() + (num_required - 1),
+                         scenarios.end(),
+                         [&makespans](const unsigned int lhs, const unsigned int rhs)
+                         {
+                             return makespans[lhs] < makespans[rhs];
+                         });
+        std::vector<std::pair<float, float>> timepoints;
+        const float makespan = m_subschedulers[scenarios[num_required - 1]].evaluateOrdering(best_ordering, timepoints);
+        return std::make_shared<const DeterministicSchedule>(makespan, timepoints, best_ordering);
+    }
+
+    unsigned int StochasticMilpScheduler::numRequiredScenarios() const
+    {
+        // Note: epsilon so that floating point error in alpha * q does not require an extra scenario
+        return std::clamp(static_cast<unsigned int>(std::ceil(m_alpha_q - 1e-4f)), 1u, m_num_scenario);
+    }
+
+    bool StochasticMilpScheduler::reduceMutexConstraints()
+    {
+        m_reduced_mutex_constraints.clear();
+        const std::multimap<unsigned int, unsigned int>& precedence_constraints =
+            m_problem_inputs->precedenceConstraints();
+        auto has_precedence = [&precedence_constraints](const unsigned int predecessor, const unsigned int successor)
+        {
+            auto iterator_bounds = precedence_constraints.equal_range(predecessor);
+            for(auto i = iterator_bounds.first; i != iterator_bounds.second; ++i)
+            {
+                if(i->second == successor)
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        for(const auto& [task_i, task_j]: m_problem_inputs->mutexConstraints())
+        {
+            if(has_precedence(task_i, task_j) || has_precedence(task_j, task_i))
+            {
+                continue;
+            }
+
+            bool i_to_j_mp_failure = false;
+            bool j_to_i_mp_failure = false;
+            for(ScenarioMilpSubscheduler& subscheduler: m_subschedulers)
+            {
+                i_to_j_mp_failure |= subscheduler.checkTransitionFeasibility(task_i, task_j).first;
+                j_to_i_mp_failure |= subscheduler.checkTransitionFeasibility(task_j, task_i).first;
+            }
+
+            // If neither is possible then one of the robots that is allocated to both currently, cannot be
+            if(i_to_j_mp_failure && j_to_i_mp_failure)
+            {
+                return false;
+            }
+
+            // The ordering is shared between all scenarios so a single failure forces the direction for all of them
+            if(i_to_j_mp_failure || j_to_i_mp_failure)
+            {
+                const auto forced = i_to_j_mp_failure ? std::pair(task_j, task_i) : std::pair(task_i, task_j);
+                for(ScenarioMilpSubscheduler& subscheduler: m_subschedulers)
+                {
+                    subscheduler.m_mp_induced_precedence_constraints.insert(forced);
+                }
+                continue;
+            }
+
+            const std::string p_ij_name = fmt::format("p_({0:d},{1:d})", task_i, task_j);
+            m_reduced_mutex_constraints[p_ij_name] =
+                MutexConstraintInfo{.task_i = task_i, .task_j = task_j, .variable_name = p_ij_name};
         }
-        model.addConstr(m_alpha_q <= alpha_summation);
-        model.setObjective(GRBLinExpr(makespan));
         return true;
     }
 
-    std::shared_ptr<const ScheduleBase> StochasticMilpScheduler::computeSchedule()
+    std::vector<float> StochasticMilpScheduler::evaluateScenarios(
+        const std::vector<std::pair<unsigned int, unsigned int>>& ordering,
+        const unsigned int num_threads)
     {
-        // TODO(andrew)
-        throw std::logic_error("Not implemented");
+        std::vector<float> makespans(m_num_scenario, -1.0f);
+        parallelFor(
+            0,
+            m_num_scenario,
+            [this, &ordering, &makespans](const unsigned int scenario)
+            {
+                std::vector<std::pair<float, float>> timepoints;
+                makespans[scenario] = m_subschedulers[scenario].evaluateOrdering(ordering, timepoints);
+            },
+            num_threads);
+        return makespans;
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -27,6 +27,14 @@
 
 namespace grstapse
 {
+    StochasticMilpSchedulerParameters::StochasticMilpSchedulerParameters()
+        : alpha(1.0f)
+        , num_scenarios(1)
+        , scenarios_per_iteration(10)
+        , decomposition_gap(0.01f)
+        , scenario_threads(0)
+    {}
+
     std::shared_ptr<const StochasticMilpSchedulerParameters> StochasticMilpSchedulerParameters::deserializeFromJson(
         const nlohmann::json& j)
     {
@@ -34,6 +42,18 @@ namespace grstapse
         rv->MilpSchedulerParameters::internalDeserialize(j);
         j[constants::k_alpha].get_to(rv->alpha);
         j[constants::k_num_scenarios].get_to(rv->num_scenarios);
+        if(j.contains(constants::k_scenarios_per_iteration))
+        {
+            j.at(constants::k_scenarios_per_iteration).get_to(rv->scenarios_per_iteration);
+        }
+        if(j.contains(constants::k_decomposition_gap))
+        {
+            j.at(constants::k_decomposition_gap).get_to(rv->decomposition_gap);
+        }
+        if(j.contains(constants::k_scenario_threads))
+        {
+            j.at(constants::k_scenario_threads).get_to(rv->scenario_threads);
+        }
         return rv;
     }
 }  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,250 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/scheduling/schedule_robustness_evaluator.hpp"
+
+// Global
+#include <algorithm>
+#include <iterator>
+// External
+#include <fmt/format.h>
+// Local
+#include "grstapse/common/utilities/error.hpp"
+#include "grstapse/common/utilities/parallel_for.hpp"
+#include "grstapse/geometric_planning/graph/point/point_graph_configuration.hpp"
+#include "grstapse/geometric_planning/graph/point/sampled_point_graph_environment.hpp"
+#include "grstapse/geometric_planning/graph/point/sampled_point_graph_motion_planner.hpp"
+#include "grstapse/geometric_planning/graph/point/sampled_point_graph_shortest_paths.hpp"
+#include "grstapse/robot.hpp"
+#include "grstapse/scheduling/earliest_timepoint_propagation.hpp"
+#include "grstapse/scheduling/schedule_base.hpp"
+#include "grstapse/scheduling/scheduler_problem_inputs.hpp"
+#include "grstapse/species.hpp"
+#include "grstapse/task.hpp"
+
+namespace grstapse
+{
+    ScheduleRobustnessEvaluator::ScheduleRobustnessEvaluator(
+        const std::shared_ptr<const SchedulerProblemInputs>& problem_inputs,
+        const unsigned int num_threads)
+        : m_problem_inputs(problem_inputs)
+        , m_num_samples(0)
+        , m_num_threads(num_threads)
+    {
+        const unsigned int num_tasks      = m_problem_inputs->numberOfPlanTasks();
+        const unsigned int num_robots     = m_problem_inputs->numberOfRobots();
+        const Eigen::MatrixXf& allocation = m_problem_inputs->allocation();
+
+        std::vector<std::shared_ptr<SampledPointGraphMotionPlanner>> motion_planners;
+        motion_planners.reserve(num_robots);
+        for(unsigned int robot_nr = 0; robot_nr < num_robots; ++robot_nr)
+        {
+            const std::shared_ptr<const Robot>& robot = m_problem_inputs->robot(robot_nr);
+            auto motion_planner =
+                std::dynamic_pointer_cast<SampledPointGraphMotionPlanner>(robot->species()->motionPlanner());
+            if(motion_planner == nullptr)
+            {
+                throw createLogicError(
+                    fmt::format("Robot '{0:s}' does not use a SampledPointGraphMotionPlanner", robot->name()));
+            }
+
+            // Only the samples that every robot has can be evaluated
+            const unsigned int num_samples =
+                std::dynamic_pointer_cast<SampledPointGraphEnvironment>(motion_planner->environment())->numGraphs();
+            m_num_samples = robot_nr == 0 ? num_samples : std::min(m_num_samples, num_samples);
+
+            motion_planners.push_back(motion_planner);
+        }
+
+        auto resolve = [this, &motion_planners](const unsigned int robot_nr,
+                                                const std::shared_ptr<const ConfigurationBase>& initial_configuration,
+                                                const std::shared_ptr<const ConfigurationBase>& goal_configuration)
+        {
+            auto initial = std::dynamic_pointer_cast<const PointGraphConfiguration>(initial_configuration);
+            auto goal    = std::dynamic_pointer_cast<const PointGraphConfiguration>(goal_configuration);
+            const auto [tree, reversed] = motion_planners[robot_nr]->shortestPathTree(initial, goal);
+            return DurationQuery{.tree      = tree,
+                                 .target_id = reversed ? initial->id() : goal->id(),
+                                 .speed     = m_problem_inputs->robot(robot_nr)->species()->speed()};
+        };
+
+        // Note: coalitions are sorted by robot number
+        std::vector<std::vector<unsigned int>> coalitions(num_tasks);
+        m_task_queries.reserve(num_tasks);
+        m_initial_queries.resize(num_tasks);
+        for(unsigned int task_nr = 0; task_nr < num_tasks; ++task_nr)
+        {
+            const std::shared_ptr<const Task>& task = m_problem_inputs->planTask(task_nr);
+            const std::shared_ptr<const ConfigurationBase>& task_initial_configuration = task->initialConfiguration();
+
+            // The widest robot in the coalition determines the duration of the task
+            int widest_robot = -1;
+            for(unsigned int robot_nr = 0; robot_nr < num_robots; ++robot_nr)
+            {
+                if(allocation(task_nr, robot_nr))
+                {
+                    coalitions[task_nr].push_back(robot_nr);
+                    const std::shared_ptr<const ConfigurationBase>& robot_initial_configuration =
+                        m_problem_inputs->robot(robot_nr)->initialConfiguration();
+                    m_initial_queries[task_nr].push_back(
+                        resolve(robot_nr, robot_initial_configuration, task_initial_configuration));
+                    if(widest_robot < 0 || m_problem_inputs->robot(robot_nr)->boundingRadius() >
+                                               m_problem_inputs->robot(widest_robot)->boundingRadius())
+                    {
+                        widest_robot = robot_nr;
+                    }
+                }
+            }
+            if(widest_robot < 0)
+            {
+                throw createLogicError(fmt::format("Task '{0:s}' has no robots allocated to it", task->name()));
+            }
+            m_task_queries.push_back(resolve(widest_robot, task_initial_configuration, task->terminalConfiguration()));
+        }
+
+        // Transitions between every ordered pair of tasks that share a robot, so any ordering can be evaluated
+        for(unsigned int predecessor = 0; predecessor < num_tasks; ++predecessor)
+        {
+            for(unsigned int successor = 0; successor < num_tasks; ++successor)
+            {
+                if(predecessor == successor)
+                {
+                    continue;
+                }
+
+                std::vector<unsigned int> shared_robots;
+                std::set_intersection(coalitions[predecessor].begin(),
+                                      coalitions[predecessor].end(),
+                                      coalitions[successor].begin(),
+                                      coalitions[successor].end(),
+                                      std::back_inserter(shared_robots));
+                if(shared_robots.empty())
+                {
+                    continue;
+                }
+
+                std::vector<DurationQuery>& queries = m_transition_queries[std::pair(predecessor, successor)];
+                queries.reserve(shared_robots.size());
+                for(unsigned int robot_nr: shared_robots)
+                {
+                    queries.push_back(resolve(robot_nr,
+                                              m_problem_inputs->planTask(predecessor)->terminalConfiguration(),
+                                              m_problem_inputs->planTask(successor)->initialConfiguration()));
+                }
+            }
+        }
+    }
+
+    MakespanDistribution ScheduleRobustnessEvaluator::evaluate(
+        const std::vector<std::pair<unsigned int, unsigned int>>& precedence_set_mutex_constraints) const
+    {
+        std::vector<float> makespans(m_num_samples, -1.0f);
+        parallelFor(
+            0,
+            m_num_samples,
+            [this, &precedence_set_mutex_constraints, &makespans](const unsigned int index)
+            {
+                makespans[index] = evaluateSample(index, precedence_set_mutex_constraints);
+            },
+            m_num_threads);
+        return MakespanDistribution(std::move(makespans));
+    }
+
+    MakespanDistribution ScheduleRobustnessEvaluator::evaluate(const ScheduleBase& schedule) const
+    {
+        return evaluate(schedule.precedenceSetMutexConstraints());
+    }
+
+    float ScheduleRobustnessEvaluator::evaluateSample(
+        const unsigned int index,
+        const std::vector<std::pair<unsigned int, unsigned int>>& precedence_set_mutex_constraints) const
+    {
+        const unsigned int num_tasks = m_problem_inputs->numberOfPlanTasks();
+
+        std::vector<float> durations(num_tasks);
+        std::vector<float> release_times(num_tasks, 0.0f);
+        for(unsigned int task_nr = 0; task_nr < num_tasks; ++task_nr)
+        {
+            durations[task_nr] = duration(m_task_queries[task_nr], index);
+            if(durations[task_nr] < 0.0f)
+            {
+                return -1.0f;
+            }
+
+            for(const DurationQuery& query: m_initial_queries[task_nr])
+            {
+                const float initial_duration = duration(query, index);
+                if(initial_duration < 0.0f)
+                {
+                    return -1.0f;
+                }
+                release_times[task_nr] = std::max(release_times[task_nr], initial_duration);
+            }
+        }
+
+        std::vector<std::pair<float, float>> timepoints;
+        return propagateEarliestTimepoints(
+            durations,
+            release_times,
+            [this, index](const unsigned int predecessor, const unsigned int successor)
+            {
+                return transitionDuration(index, predecessor, successor);
+            },
+            timepoints,
+            m_problem_inputs->precedenceConstraints(),
+            precedence_set_mutex_constraints);
+    }
+
+    float ScheduleRobustnessEvaluator::duration(const DurationQuery& query, const unsigned int index)
+    {
+        const std::optional<float> length = query.tree->pathLength(query.target_id, index);
+        if(!length.has_value())
+        {
+            return -1.0f;
+        }
+        return *length / query.speed;
+    }
+
+    float ScheduleRobustnessEvaluator::transitionDuration(const unsigned int index,
+                                                          const unsigned int predecessor,
+                                                          const unsigned int successor) const
+    {
+        // Tasks that do not share a robot have no transition
+        auto iter = m_transition_queries.find(std::pair(predecessor, successor));
+        if(iter == m_transition_queries.end())
+        {
+            return 0.0f;
+        }
+
+        float transition_duration = 0.0f;
+        for(const DurationQuery& query: iter->second)
+        {
+            const float query_duration = duration(query, index);
+            if(query_duration < 0.0f)
+            {
+                return -1.0f;
+            }
+            transition_duration = std::max(transition_duration, query_duration);
+        }
+        return transition_duration;
+    }
+}  // namespace grstapse
\ No newline at end of file
@@ -0,0 +1,208 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "grstapse/scheduling/transition_duration_matrix.hpp"
+
+// Global
+#include <algorithm>
+#include <cmath>
+#include <limits>
+// Local
+#include "grstapse/common/utilities/parallel_for.hpp"
+#include "grstapse/geometric_planning/configuration_base.hpp"
+#include "grstapse/geometric_planning/motion_planner_base.hpp"
+#include "grstapse/geometric_planning/ompl/se2_state_ompl_configuration.hpp"
+#include "grstapse/geometric_planning/pgm_environment.hpp"
+#include "grstapse/robot.hpp"
+#include "grstapse/species.hpp"
+#include "grstapse/task.hpp"
+
+namespace grstapse
+{
+    TransitionDurationMatrix::TransitionDurationMatrix(const std::vector<std::shared_ptr<const Task>>& tasks,
+                                                       const std::vector<std::shared_ptr<const Robot>>& robots,
+                                                       const bool geodesic_heuristic)
+        : m_num_tasks(tasks.size())
+    {
+        const std::size_t num_robots = robots.size();
+
+        // Index the distinct species of the robots
+        std::vector<std::shared_ptr<const Species>> species;
+        m_robot_species.reserve(num_robots);
+        for(const std::shared_ptr<const Robot>& robot: robots)
+        {
+            auto species_iter = std::find(species.begin(), species.end(), robot->species());
+            if(species_iter == species.end())
+            {
+                species.push_back(robot->species());
+                species_iter = species.end() - 1;
+            }
+            m_robot_species.push_back(std::distance(species.begin(), species_iter));
+        }
+        const std::size_t num_species = species.size();
+
+        const float unknown = std::numeric_limits<float>::quiet_NaN();
+
+        // Transitions between tasks depend only on the species
+        const std::size_t num_transitions = num_species * m_num_tasks * m_num_tasks;
+        m_transition_heuristic_durations.resize(num_transitions, 0.0f);
+        m_transition_durations = std::make_unique<std::atomic<float>[]>(num_transitions);
+        for(std::size_t index = 0; index < num_transitions; ++index)
+        {
+            m_transition_durations[index].store(unknown, std::memory_order_relaxed);
+        }
+        for(unsigned int species_nr = 0; species_nr < num_species; ++species_nr)
+        {
+            const float speed = species[species_nr]->speed();
+            for(unsigned int task_i = 0; task_i < m_num_tasks; ++task_i)
+            {
+                const std::shared_ptr<const ConfigurationBase>& terminal_configuration =
+                    tasks[task_i]->terminalConfiguration();
+                for(unsigned int task_j = 0; task_j < m_num_tasks; ++task_j)
+                {
+                    // Ignore self transitions
+                    if(task_i == task_j)
+                    {
+                        continue;
+                    }
+                    m_transition_heuristic_durations[(species_nr * m_num_tasks + task_i) * m_num_tasks + task_j] =
+                        terminal_configuration->euclideanDistance(tasks[task_j]->initialConfiguration()) / speed;
+                }
+            }
+        }
+
+        // Initial transitions depend on the initial configuration of each robot
+        const std::size_t num_initial_transitions = num_robots * m_num_tasks;
+        m_initial_transition_heuristic_durations.reserve(num_initial_transitions);
+        m_initial_transition_durations = std::make_unique<std::atomic<float>[]>(num_initial_transitions);
+        for(const std::shared_ptr<const Robot>& robot: robots)
+        {
+            for(const std::shared_ptr<const Task>& task: tasks)
+            {
+                m_initial_transition_heuristic_durations.push_back(
+                    robot->initialConfiguration()->euclideanDistance(task->initialConfiguration()) / robot->speed());
+            }
+        }
+        for(std::size_t index = 0; index < num_initial_transitions; ++index)
+        {
+            m_initial_transition_durations[index].store(unknown, std::memory_order_relaxed);
+        }
+
+        if(geodesic_heuristic)
+        {
+            computeGeodesicHeuristics(tasks, robots, species);
+        }
+    }
+
+    void TransitionDurationMatrix::computeGeodesicHeuristics(const std::vector<std::shared_ptr<const Task>>& tasks,
+                                                             const std::vector<std::shared_ptr<const Robot>>& robots,
+                                                             const std::vector<std::shared_ptr<const Species>>& species)
+    {
+        // Geodesic distances are computed from points, so every task must start and end at an SE(2) state
+        std::vector<std::shared_ptr<const Se2StateOmplConfiguration>> initial_configurations;
+        std::vector<std::shared_ptr<const Se2StateOmplConfiguration>> terminal_configurations;
+        initial_configurations.reserve(m_num_tasks);
+        terminal_configurations.reserve(m_num_tasks);
+        for(const std::shared_ptr<const Task>& task: tasks)
+        {
+            initial_configurations.push_back(
+                std::dynamic_pointer_cast<const Se2StateOmplConfiguration>(task->initialConfiguration()));
+            terminal_configurations.push_back(
+                std::dynamic_pointer_cast<const Se2StateOmplConfiguration>(task->terminalConfiguration()));
+            if(initial_configurations.back() == nullptr || terminal_configurations.back() == nullptr)
+            {
+                return;
+            }
+        }
+
+        // Note: a distance field has a cell per pixel of the map, so only one is kept alive per worker thread
+        std::vector<std::vector<float>> distance_buffers(numWorkerThreads());
+        for(unsigned int species_nr = 0; species_nr < species.size(); ++species_nr)
+        {
+            auto environment =
+                std::dynamic_pointer_cast<const PgmEnvironment>(species[species_nr]->motionPlanner()->environment());
+            if(environment == nullptr)
+            {
+                continue;
+            }
+
+            const float speed = species[species_nr]->speed();
+            const std::vector<uint8_t> occupancy =
+                environment->inflatedOccupancy(species[species_nr]->boundingRadius());
+            float* species_heuristic_durations =
+                m_transition_heuristic_durations.data() + species_nr * m_num_tasks * m_num_tasks;
+
+            // Robots of this species whose initial configuration is an SE(2) state
+            std::vector<std::pair<unsigned int, std::shared_ptr<const Se2StateOmplConfiguration>>> species_robots;
+            for(unsigned int robot_nr = 0; robot_nr < robots.size(); ++robot_nr)
+            {
+                if(m_robot_species[robot_nr] != species_nr)
+                {
+                    continue;
+                }
+                auto configuration = std::dynamic_pointer_cast<const Se2StateOmplConfiguration>(
+                    robots[robot_nr]->initialConfiguration());
+                if(configuration != nullptr)
+                {
+                    species_robots.emplace_back(robot_nr, configuration);
+                }
+            }
+
+            // Note: each task writes only its own column, so the tasks are independent
+            parallelFor(0,
+                        m_num_tasks,
+                        [&](const unsigned int task_j, const unsigned int worker)
+                        {
+                            std::vector<float>& distances = distance_buffers[worker];
+                            environment->geodesicDistances(occupancy,
+                                                           initial_configurations[task_j]->x(),
+                                                           initial_configurations[task_j]->y(),
+                                                           distances);
+
+                            // Only tighten: the euclidean heuristic is also a lower bound
+                            auto tighten = [&](float& heuristic, const Se2StateOmplConfiguration& configuration)
+                            {
+                                const float lower_bound =
+                                    environment->geodesicLowerBound(distances, configuration.x(), configuration.y());
+                                if(std::isfinite(lower_bound))
+                                {
+                                    heuristic = std::max(heuristic, lower_bound / speed);
+                                }
+                            };
+
+                            for(unsigned int task_i = 0; task_i < m_num_tasks; ++task_i)
+                            {
+                                if(task_i != task_j)
+                                {
+                                    tighten(species_heuristic_durations[task_i * m_num_tasks + task_j],
+                                            *terminal_configurations[task_i]);
+                                }
+                            }
+                            for(const auto& [robot_nr, configuration]: species_robots)
+                            {
+                                const unsigned int index = initialTransitionIndex(robot_nr, task_j);
+                                tighten(m_initial_transition_heuristic_durations[index], *configuration);
+                            }
+                        });
+        }
+    }
+}  // namespace grstapse
\ No newline at end of file
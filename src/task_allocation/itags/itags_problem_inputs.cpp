@@ -31,10 +31,12 @@
 #include "grstapse/geometric_planning/ompl/ompl_environment.hpp"
 #include "grstapse/geometric_planning/ompl/ompl_motion_planner.hpp"
 #include "grstapse/grstaps_problem_inputs.hpp"
+#include "grstapse/robot.hpp"
 #include "grstapse/scheduling/milp/deterministic/deterministic_milp_scheduler.hpp"
 #include "grstapse/scheduling/milp/deterministic/deterministic_schedule.hpp"
 #include "grstapse/scheduling/milp/milp_scheduler_parameters.hpp"
 #include "grstapse/scheduling/scheduler_problem_inputs.hpp"
+#include "grstapse/scheduling/transition_duration_matrix.hpp"
 #include "grstapse/species.hpp"
 #include "grstapse/task.hpp"
 #include "grstapse/task_allocation/itags/robot_traits_matrix_reduction.hpp"
@@ -55,7 +57,13 @@ namespace grstapse
         , m_desired_traits_matrix(desired_traits_matrix)
         , m_schedule_best_makespan(schedule_best_makespan)
         , m_schedule_worst_makespan(schedule_worst_makespan)
-    {}
+    {
+        if(m_grstaps_problem_inputs != nullptr)
+        {
+            precomputeMotionPlans();
+            createTransitionDurationMatrix();
+        }
+    }
 
     std::shared_ptr<ItagsProblemInputs> ItagsProblemInputs::splice(
         const std::shared_ptr<const ItagsProblemInputs> &for_mp_and_species) const
@@ -153,6 +161,34 @@ namespace grstapse
         return tasks;
     }
 
+    void ItagsProblemInputs::precomputeMotionPlans()
+    {
+        // Transitions are between the robots' initial configurations and the tasks' initial/terminal configurations
+        std::vector<std::shared_ptr<const ConfigurationBase>> configurations;
+        for(const std::shared_ptr<const Robot> &robot: robots())
+        {
+            configurations.push_back(robot->initialConfiguration());
+        }
+        for(const std::shared_ptr<const Task> &task: planTasks())
+        {
+            configurations.push_back(task->initialConfiguration());
+            configurations.push_back(task->terminalConfiguration());
+        }
+
+        for(const std::shared_ptr<MotionPlannerBase> &motion_planner: motionPlanners())
+        {
+            motion_planner->precompute(configurations);
+        }
+    }
+
+    void ItagsProblemInputs::createTransitionDurationMatrix()
+    {
+        auto milp_parameters = std::dynamic_pointer_cast<const MilpSchedulerParameters>(schedulerParameters());
+        const bool geodesic_heuristic = milp_parameters != nullptr && milp_parameters->geodesic_transition_heuristic;
+        m_transition_duration_matrix =
+            std::make_shared<TransitionDurationMatrix>(planTasks(), robots(), geodesic_heuristic);
+    }
+
     void from_json(const nlohmann::json &j, ItagsProblemInputs &p)
     {
         // Load/Create Grstaps stuff
@@ -209,6 +245,8 @@ namespace grstapse
             p.m_precedence_constraints.insert(kv);
         }
         p.m_desired_traits_matrix = desiredTraitsMatrix(p.m_grstaps_problem_inputs->m_tasks, p.m_plan_task_indices);
+        p.precomputeMotionPlans();
+        p.createTransitionDurationMatrix();
 
         // Compute makespan for schedule best
         // TODO(Andrew): turn this into a utility/static function somewhere
@@ -61,9 +61,18 @@ namespace grstapse::mocks
             return m_initial_transition_info;
         }
 
-        [[nodiscard]] inline const std::vector<std::vector<TaskTransitionInfo>>& transitionInfo() const
+        //! The transitions between each pair of tasks expanded into a (number of tasks) x (number of tasks) matrix
+        [[nodiscard]] inline std::vector<std::vector<TaskTransitionInfo>> transitionInfo() const
         {
-            return m_transition_info;
+            const unsigned int num_tasks = m_problem_inputs->numberOfPlanTasks();
+            std::vector<std::vector<TaskTransitionInfo>> rv(num_tasks, std::vector<TaskTransitionInfo>(num_tasks));
+            for(const TaskPairTransitionInfo& task_pair_transition_info: m_task_pair_transitions)
+            {
+                rv[task_pair_transition_info.task_i][task_pair_transition_info.task_j].assign(
+                    m_transition_info.begin() + task_pair_transition_info.begin,
+                    m_transition_info.begin() + task_pair_transition_info.end);
+            }
+            return rv;
         }
 
         [[nodiscard]] inline const Eigen::MatrixXf& allocation() const
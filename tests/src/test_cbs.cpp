@@ -21,21 +21,49 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 // Global
+#include <algorithm>
 #include <fstream>
+#include <limits>
+#include <tuple>
 
 // External
 #include <gtest/gtest.h>
 #include <nlohmann/json.hpp>
 
 // Project
+#include <grstapse/geometric_planning/grid/grid_distance_table.hpp>
+#include <grstapse/geometric_planning/grid/grid_map.hpp>
 #include <grstapse/geometric_planning/mapf/cbs/conflict_based_search.hpp>
 #include <grstapse/geometric_planning/mapf/cbs/conflict_based_search_parameters.hpp>
 #include <grstapse/geometric_planning/mapf/cbs/conflict_based_search_statistics.hpp>
 #include <grstapse/geometric_planning/mapf/cbs/high_level/conflict_base.hpp>
+#include <grstapse/geometric_planning/mapf/cbs/high_level/constraint_list.hpp>
 #include <grstapse/geometric_planning/mapf/cbs/high_level/constraint_tree_node.hpp>
+#include <grstapse/geometric_planning/mapf/cbs/high_level/constraint_tree_node_root.hpp>
+#include <grstapse/geometric_planning/mapf/cbs/high_level/edge_constraint.hpp>
+#include <grstapse/geometric_planning/mapf/cbs/high_level/positive_edge_constraint.hpp>
+#include <grstapse/geometric_planning/mapf/cbs/high_level/positive_vertex_constraint.hpp>
+#include <grstapse/geometric_planning/mapf/cbs/high_level/vertex_conflict.hpp>
+#include <grstapse/geometric_planning/mapf/cbs/high_level/vertex_constraint.hpp>
+#include <grstapse/geometric_planning/mapf/cbs/low_level/constraint_table.hpp>
+#include <grstapse/geometric_planning/mapf/cbs/low_level/multi_valued_decision_diagram.hpp>
+#include <grstapse/geometric_planning/mapf/cbs/low_level/space_time_a_star_with_constraints.hpp>
+#include <grstapse/geometric_planning/mapf/cbs/low_level/space_time_a_star_with_constraints_parameters.hpp>
+#include <grstapse/geometric_planning/mapf/cbs/low_level/temporal_grid_cell_node.hpp>
+#include <grstapse/geometric_planning/mapf/grid_path.hpp>
 
 namespace grstapse::unittests {
-    std::shared_ptr<const ConflictBasedSearchParameters> readParametersFromJson(const std::string &filepath) {
+    //! The options of ConflictBasedSearchParameters that the tests vary (the defaults are ICBS)
+    struct CbsOptions {
+        bool prioritize_conflicts = true;
+        bool bypass = true;
+        float suboptimality_weight = 1.0f;
+        unsigned int num_threads = 0;
+        bool disjoint_splitting = false;
+    };
+
+    std::shared_ptr<const ConflictBasedSearchParameters> readParametersFromJson(const std::string &filepath,
+                                                                                const CbsOptions &options = {}) {
         std::ifstream input(filepath);
         nlohmann::json data;
         input >> data;
@@ -69,7 +97,42 @@ namespace grstapse::unittests {
                                                                      initial_states,
                                                                      goal_states,
                                                                      "cbs_high_level",
-                                                                     "cbs_low_level");
+                                                                     "cbs_low_level",
+                                                                     false,
+                                                                     std::numeric_limits<float>::max(),
+                                                                     options.prioritize_conflicts,
+                                                                     options.bypass,
+                                                                     options.suboptimality_weight,
+                                                                     options.num_threads,
+                                                                     options.disjoint_splitting);
+    }
+
+    /**!
+     * Solves each of the MAPF benchmarks with both \p baseline and \p variant, checks that both find a conflict free
+     * solution, and then calls \p compare(variant_result, baseline_result) for the checks specific to the variant
+     */
+    template<typename Compare>
+    void compareToBaseline(const CbsOptions &baseline, const CbsOptions &variant, Compare &&compare) {
+        for (const std::string filepath: {"data/geometric_planning/mapf/simple1.json",
+                                          "data/geometric_planning/mapf/swap4.json",
+                                          "data/geometric_planning/mapf/circle.json",
+                                          "data/geometric_planning/mapf/at_goal.json"}) {
+            SCOPED_TRACE(filepath);
+            ConflictBaseSearch baseline_cbs(readParametersFromJson(filepath, baseline));
+            SearchResults<ConstraintTreeNodeBase, ConflictBasedSearchStatistics> baseline_result =
+                    baseline_cbs.search();
+            ASSERT_TRUE(baseline_result.foundGoal());
+
+            ConflictBaseSearch variant_cbs(readParametersFromJson(filepath, variant));
+            SearchResults<ConstraintTreeNodeBase, ConflictBasedSearchStatistics> variant_result = variant_cbs.search();
+            ASSERT_TRUE(variant_result.foundGoal());
+            ASSERT_EQ(variant_result.goal()->getFirstConflict(), nullptr);
+
+            compare(variant_result, baseline_result);
+            if (::testing::Test::HasFatalFailure()) {
+                return;
+            }
+        }
     }
 
     TEST(CBS, atgoal) {
@@ -147,4 +210,405 @@ namespace grstapse::unittests {
         std::shared_ptr<const ConflictBasedSearchStatistics> statistics = result.statistics();
         ASSERT_EQ(goal->getFirstConflict(), nullptr);
     }
+
+    TEST(CBS, constraintTable) {
+        robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>> constraints;
+        constraints.insert(std::make_shared<const VertexConstraint>(3, 1, 2));
+        constraints.insert(std::make_shared<const VertexConstraint>(5, 1, 2));
+        constraints.insert(std::make_shared<const EdgeConstraint>(4, 1, 2, 2, 2));
+        ConstraintTable table(constraints);
+
+        ASSERT_FALSE(table.empty());
+        ASSERT_TRUE(table.isVertexConstrained(3, 1, 2));
+        ASSERT_FALSE(table.isVertexConstrained(4, 1, 2));
+        ASSERT_FALSE(table.isVertexConstrained(3, 2, 1));
+        ASSERT_TRUE(table.isEdgeConstrained(4, 1, 2, 2, 2));
+        ASSERT_FALSE(table.isEdgeConstrained(4, 2, 2, 1, 2));
+        ASSERT_EQ(table.latestVertexConstraint(1, 2), 5);
+        ASSERT_EQ(table.latestVertexConstraint(0, 0), 0);
+        ASSERT_TRUE(ConstraintTable({}).empty());
+    }
+
+    std::shared_ptr<const TemporalGridCellNode>
+    createPath(const std::vector<std::pair<unsigned int, unsigned int>> &cells) {
+        std::shared_ptr<const TemporalGridCellNode> leaf = nullptr;
+        for (unsigned int t = 0; t < cells.size(); ++t) {
+            leaf = std::make_shared<const TemporalGridCellNode>(t, cells[t].first, cells[t].second, leaf);
+        }
+        return leaf;
+    }
+
+    std::vector<std::tuple<unsigned int, bool, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int,
+                           unsigned int>>
+    sortedConflicts(const ConstraintTreeNodeBase &node) {
+        std::vector<std::tuple<unsigned int, bool, unsigned int, unsigned int, unsigned int, unsigned int,
+                               unsigned int, unsigned int>> rv;
+        for (const ConflictRecord &conflict: node.conflicts()) {
+            rv.emplace_back(conflict.time, conflict.is_edge, conflict.agents[0], conflict.agents[1], conflict.x1,
+                            conflict.y1, conflict.x2, conflict.y2);
+        }
+        std::sort(rv.begin(), rv.end());
+        return rv;
+    }
+
+    TEST(CBS, incrementalConflicts) {
+        auto parent = std::make_shared<ConstraintTreeNodeRoot>(4, ConstraintTreeNodeCostType::e_makespan);
+        parent->setLowLevelSolution(0, createPath({{0, 0}, {1, 0}}));
+        parent->setLowLevelSolution(1, createPath({{1, 0}, {0, 0}}));
+        parent->setLowLevelSolution(2, createPath({{5, 5}}));
+        parent->setLowLevelSolution(3, createPath({{5, 5}}));
+        parent->detectConflicts();
+        // The swap at t = 0 and the two robots parked on (5, 5) at t = 0 and 1
+        ASSERT_EQ(parent->conflicts().size(), 3);
+
+        std::unique_ptr<const ConflictBase> first = parent->getFirstConflict();
+        ASSERT_NE(dynamic_cast<const VertexConflict *>(first.get()), nullptr);
+        ASSERT_EQ(first->agent1(), 2);
+        ASSERT_EQ(first->agent2(), 3);
+
+        auto child = std::make_shared<ConstraintTreeNode>(4, ConstraintTreeNodeCostType::e_makespan, parent);
+        child->setConstraint(0, std::make_shared<const VertexConstraint>(1, 1, 0));
+        child->setLowLevelSolution(0, createPath({{0, 0}, {0, 1}, {1, 1}, {1, 0}, {0, 0}}));
+        child->detectConflicts();
+
+        auto expected = std::make_shared<ConstraintTreeNodeRoot>(4, ConstraintTreeNodeCostType::e_makespan);
+        expected->setLowLevelSolution(0, child->lowLevelSolution(0));
+        expected->setLowLevelSolution(1, createPath({{1, 0}, {0, 0}}));
+        expected->setLowLevelSolution(2, createPath({{5, 5}}));
+        expected->setLowLevelSolution(3, createPath({{5, 5}}));
+        expected->detectConflicts();
+
+        ASSERT_EQ(sortedConflicts(*child), sortedConflicts(*expected));
+        // Robots 2 and 3 for t = 0 to 4 and robot 0 on top of the finished robot 1 at t = 4
+        ASSERT_EQ(child->conflicts().size(), 6);
+    }
+
+    TEST(CBS, multiValuedDecisionDiagram) {
+        GridMap map(3, 3, {});
+        GridCell initial(0, 0);
+        GridCell goal(2, 0);
+
+        MultiValuedDecisionDiagram shortest(map, initial, goal, 3, ConstraintTable({}));
+        ASSERT_TRUE(shortest.isSingleton(1, 1, 0));
+        ASSERT_TRUE(shortest.isSingleton(5, 2, 0));
+
+        MultiValuedDecisionDiagram longer(map, initial, goal, 4, ConstraintTable({}));
+        ASSERT_EQ(longer.width(1), 2);
+        ASSERT_TRUE(longer.contains(1, 0, 0));
+        ASSERT_TRUE(longer.contains(2, 2, 0));
+        ASSERT_FALSE(longer.contains(1, 0, 1));
+        ASSERT_FALSE(longer.isSingleton(2, 1, 0));
+
+        robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>> constraints;
+        constraints.insert(std::make_shared<const VertexConstraint>(1, 1, 0));
+        MultiValuedDecisionDiagram constrained(map, initial, goal, 4, ConstraintTable(constraints));
+        ASSERT_TRUE(constrained.isSingleton(1, 0, 0));
+        ASSERT_TRUE(constrained.isSingleton(2, 1, 0));
+    }
+
+    TEST(CBS, prioritizeConflicts) {
+        compareToBaseline({.prioritize_conflicts = false, .bypass = false},
+                          {},
+                          [](const auto &prioritized_result, const auto &result) {
+                              ASSERT_EQ(prioritized_result.goal()->cost(), result.goal()->cost());
+                          });
+    }
+
+    TEST(CBS, enhanced) {
+        const float w = 1.5f;
+        compareToBaseline({},
+                          {.suboptimality_weight = w},
+                          [w](const auto &enhanced_result, const auto &result) {
+                              ASSERT_LE(enhanced_result.goal()->lowerBound(), result.goal()->cost());
+                              ASSERT_LE(static_cast<float>(enhanced_result.goal()->cost()), w * result.goal()->cost());
+                          });
+    }
+
+    TEST(CBS, parallelLowLevel) {
+        compareToBaseline({.num_threads = 1},
+                          {.num_threads = 4},
+                          [](const auto &parallel_result, const auto &result) {
+                              ASSERT_EQ(parallel_result.goal()->cost(), result.goal()->cost());
+                              ASSERT_EQ(parallel_result.statistics()->numberOfHighLevelNodesGenerated(),
+                                        result.statistics()->numberOfHighLevelNodesGenerated());
+                              ASSERT_EQ(parallel_result.statistics()->numberOfLowLevelNodesExpanded(),
+                                        result.statistics()->numberOfLowLevelNodesExpanded());
+                          });
+    }
+
+    TEST(CBS, trueDistanceHeuristic) {
+        // A wall at x = 2 with a gap at the top
+        robin_hood::unordered_set<GridCell> obstacles;
+        for (unsigned int y = 0; y < 4; ++y) {
+            obstacles.insert(GridCell(2, y));
+        }
+        auto map = std::make_shared<const GridMap>(5, 5, obstacles);
+        auto initial = std::make_shared<const GridCell>(0, 0);
+        auto goal = std::make_shared<const GridCell>(4, 0);
+        auto distances = std::make_shared<const GridDistanceTable>(*map, *goal);
+
+        ASSERT_EQ(distances->distance(4, 0), 0);
+        ASSERT_EQ(distances->distance(*initial), 12);
+        ASSERT_EQ(distances->distance(2, 4), 6);
+        ASSERT_FALSE(distances->isReachable(2, 0));
+
+        auto parameters = std::make_shared<const SpaceTimeAStarParameters>("low_level");
+        auto constraints = std::make_shared<const ConstraintTable>(
+                robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>>());
+        SpaceTimeAStarWithConstraints manhattan(parameters, map, initial, goal, constraints);
+        SearchResults<TemporalGridCellNode, SearchStatisticsCommon> result = manhattan.search();
+        ASSERT_TRUE(result.foundGoal());
+
+        SpaceTimeAStarWithConstraints true_distance(parameters, map, initial, goal, constraints, distances);
+        SearchResults<TemporalGridCellNode, SearchStatisticsCommon> true_result = true_distance.search();
+        ASSERT_TRUE(true_result.foundGoal());
+        ASSERT_EQ(true_result.goal()->time(), 12);
+        ASSERT_EQ(true_result.goal()->time(), result.goal()->time());
+        ASSERT_LT(true_result.statistics()->numberOfNodesExpanded(), result.statistics()->numberOfNodesExpanded());
+    }
+
+    TEST(CBS, constraintList) {
+        auto root = std::make_shared<ConstraintTreeNodeRoot>(2, ConstraintTreeNodeCostType::e_sum_of_costs);
+        root->setLowLevelSolution(0, createPath({{0, 0}}));
+        root->setLowLevelSolution(1, createPath({{1, 1}}));
+        ASSERT_EQ(root->constraintList(0), nullptr);
+
+        auto first = std::make_shared<const VertexConstraint>(1, 1, 0);
+        auto child = std::make_shared<ConstraintTreeNode>(2, ConstraintTreeNodeCostType::e_sum_of_costs, root);
+        child->setConstraint(0, first);
+        child->setLowLevelSolution(0, createPath({{0, 0}, {0, 0}}));
+
+        auto second = std::make_shared<const EdgeConstraint>(2, 0, 0, 1, 0);
+        auto grandchild = std::make_shared<ConstraintTreeNode>(2, ConstraintTreeNodeCostType::e_sum_of_costs, child);
+        grandchild->setConstraint(0, second);
+        grandchild->setLowLevelSolution(0, createPath({{0, 0}, {0, 0}, {0, 0}}));
+
+        auto other = std::make_shared<ConstraintTreeNode>(2, ConstraintTreeNodeCostType::e_sum_of_costs, grandchild);
+        other->setConstraint(1, std::make_shared<const VertexConstraint>(0, 1, 1));
+        other->setLowLevelSolution(1, createPath({{1, 1}}));
+
+        // The new constraint is prepended to the parent's list, which is shared rather than copied
+        const std::shared_ptr<const ConstraintList> &list = grandchild->constraintList(0);
+        ASSERT_EQ(list->size(), 2);
+        ASSERT_EQ(list->constraint(), second);
+        ASSERT_EQ(list->next(), child->constraintList(0));
+        ASSERT_EQ(list->next()->constraint(), first);
+        ASSERT_EQ(list->next()->next(), nullptr);
+        ASSERT_EQ(other->constraintList(0), list);
+        ASSERT_EQ(other->constraintList(1)->size(), 1);
+        ASSERT_EQ(grandchild->constraintList(1), nullptr);
+
+        ASSERT_EQ(grandchild->constraints(0),
+                  (robin_hood::unordered_set<std::shared_ptr<const ConstraintBase>>{first, second}));
+        ASSERT_TRUE(grandchild->constraints(1).empty());
+
+        ConstraintTable table(list.get());
+        ASSERT_TRUE(table.isVertexConstrained(1, 1, 0));
+        ASSERT_TRUE(table.isEdgeConstrained(2, 0, 0, 1, 0));
+        ASSERT_TRUE(ConstraintTable(grandchild->constraintList(1).get()).empty());
+    }
+
+    TEST(CBS, gridPath) {
+        GridPath path(createPath({{0, 0}, {1, 0}, {1, 1}}));
+        ASSERT_EQ(path.size(), 3);
+        ASSERT_EQ(path.cell(1), GridPath::pack(1, 0));
+        ASSERT_EQ(GridPath::x(path.cell(2)), 1);
+        ASSERT_EQ(GridPath::y(path.cell(2)), 1);
+        ASSERT_EQ(path.cellOrLast(7), path.back());
+        ASSERT_EQ(GridPath::x(GridPath::pack(std::numeric_limits<unsigned int>::max(), 3)),
+                  std::numeric_limits<unsigned int>::max());
+
+        // Only the path of the replanned robot is new in a child
+        auto root = std::make_shared<ConstraintTreeNodeRoot>(2, ConstraintTreeNodeCostType::e_sum_of_costs);
+        root->setLowLevelSolution(0, createPath({{0, 0}, {1, 0}}));
+        root->setLowLevelSolution(1, createPath({{1, 0}, {0, 0}}));
+        root->detectConflicts();
+        auto child = std::make_shared<ConstraintTreeNode>(2, ConstraintTreeNodeCostType::e_sum_of_costs, root);
+        child->setConstraint(0, std::make_shared<const VertexConstraint>(1, 1, 0));
+        child->setLowLevelSolution(0, createPath({{0, 0}, {0, 0}, {1, 0}}));
+        child->detectConflicts();
+        ASSERT_EQ(child->lowLevelSolution(1), root->lowLevelSolution(1));
+        ASSERT_NE(child->lowLevelSolution(0), root->lowLevelSolution(0));
+        ASSERT_EQ(child->sumOfCosts(), 5);
+        ASSERT_EQ(sortedConflicts(*root), (decltype(sortedConflicts(*root)){{0, true, 0, 1, 0, 0, 1, 0}}));
+        ASSERT_EQ(sortedConflicts(*child), (decltype(sortedConflicts(*child)){{1, false, 0, 1, 0, 0, 0, 0}}));
+
+        // A bypass shares the path of the child it adopts
+        auto bypass = std::make_shared<ConstraintTreeNode>(2, ConstraintTreeNodeCostType::e_sum_of_costs, root);
+        bypass->setConstraint(0, nullptr);
+        bypass->setLowLevelSolution(0, child->lowLevelSolution(0));
+        ASSERT_EQ(bypass->lowLevelSolution(0).get(), child->lowLevelSolution(0).get());
+    }
+
+    TEST(CBS, mustVisit) {
+        auto root = std::make_shared<ConstraintTreeNodeRoot>(2, ConstraintTreeNodeCostType::e_sum_of_costs);
+        auto child = std::make_shared<ConstraintTreeNode>(2, ConstraintTreeNodeCostType::e_sum_of_costs, root);
+        // Robot 0 must be at (2, 2) at t = 4 and move from (2, 0) to (1, 0) at t = 6
+        child->setConstraint(1, std::make_shared<const PositiveVertexConstraint>(0, 4, 2, 2));
+        auto grandchild = std::make_shared<ConstraintTreeNode>(2, ConstraintTreeNodeCostType::e_sum_of_costs, child);
+        grandchild->setConstraint(1, std::make_shared<const PositiveEdgeConstraint>(0, 6, 2, 0, 1, 0));
+        ASSERT_EQ(grandchild->constraintList(1), nullptr);
+        ASSERT_EQ(grandchild->positiveConstraintList()->size(), 2);
+
+        ConstraintTable table0(grandchild->constraintList(0).get(), grandchild->positiveConstraintList().get(), 0);
+        ASSERT_FALSE(table0.isVertexConstrained(4, 2, 2));
+        ASSERT_TRUE(table0.isVertexConstrained(4, 2, 1));
+        ASSERT_TRUE(table0.isVertexConstrained(7, 2, 0));
+        ASSERT_FALSE(table0.isVertexConstrained(5, 2, 1));
+        ASSERT_TRUE(table0.canReachMustVisit(2, 2, 0));
+        ASSERT_FALSE(table0.canReachMustVisit(2, 0, 0));
+        ASSERT_EQ(table0.latestVertexConstraint(0, 0), 7);
+
+        // The other robot may not be where robot 0 must be
+        ConstraintTable table1(grandchild->constraintList(1).get(), grandchild->positiveConstraintList().get(), 1);
+        ASSERT_TRUE(table1.isVertexConstrained(4, 2, 2));
+        ASSERT_FALSE(table1.isVertexConstrained(4, 2, 1));
+        ASSERT_TRUE(table1.isVertexConstrained(6, 2, 0));
+        ASSERT_TRUE(table1.isVertexConstrained(7, 1, 0));
+        ASSERT_TRUE(table1.isEdgeConstrained(6, 1, 0, 2, 0));
+        ASSERT_TRUE(table1.canReachMustVisit(2, 0, 0));
+
+        auto map = std::make_shared<const GridMap>(3, 3, robin_hood::unordered_set<GridCell>());
+        auto initial = std::make_shared<const GridCell>(0, 0);
+        auto goal = std::make_shared<const GridCell>(0, 0);
+        SpaceTimeAStarWithConstraints low_level(std::make_shared<const SpaceTimeAStarParameters>("low_level"),
+                                                map,
+                                                initial,
+                                                goal,
+                                                std::make_shared<const ConstraintTable>(table0));
+        SearchResults<TemporalGridCellNode, SearchStatisticsCommon> result = low_level.search();
+        ASSERT_TRUE(result.foundGoal());
+        GridPath path(result.goal());
+        ASSERT_EQ(path.size(), 9);
+        ASSERT_EQ(path.cell(4), GridPath::pack(2, 2));
+        ASSERT_EQ(path.cell(6), GridPath::pack(2, 0));
+        ASSERT_EQ(path.cell(7), GridPath::pack(1, 0));
+    }
+
+    TEST(CBS, disjointSplitting) {
+        for (const bool prioritize_conflicts: {false, true}) {
+            ASSERT_NO_FATAL_FAILURE(compareToBaseline(
+                    {.prioritize_conflicts = prioritize_conflicts, .bypass = prioritize_conflicts},
+                    {.prioritize_conflicts = prioritize_conflicts,
+                     .bypass = prioritize_conflicts,
+                     .disjoint_splitting = true},
+                    [](const auto &disjoint_result, const auto &result) {
+                        ASSERT_EQ(disjoint_result.goal()->cost(), result.goal()->cost());
+                    }));
+        }
+    }
+
+    TEST(CBS, disjointSplittingThirdRobot) {
+        // Robots 0 and 1 cross the center of an open map at t = 1, where robot 2 is parked
+        auto map = std::make_shared<const GridMap>(3, 3, robin_hood::unordered_set<GridCell>());
+        const std::vector<std::shared_ptr<const GridCell>> initial_states{std::make_shared<const GridCell>(0, 1),
+                                                                          std::make_shared<const GridCell>(1, 0),
+                                                                          std::make_shared<const GridCell>(1, 1)};
+        const std::vector<std::shared_ptr<const GridCell>> goal_states{std::make_shared<const GridCell>(2, 1),
+                                                                       std::make_shared<const GridCell>(1, 2),
+                                                                       std::make_shared<const GridCell>(1, 1)};
+        auto solve = [&map, &initial_states, &goal_states](const bool disjoint_splitting) {
+            ConflictBaseSearch cbs(std::make_shared<const ConflictBasedSearchParameters>(
+                    ConstraintTreeNodeCostType::e_sum_of_costs,
+                    map,
+                    initial_states,
+                    goal_states,
+                    "cbs_high_level",
+                    "cbs_low_level",
+                    false,
+                    std::numeric_limits<float>::max(),
+                    false,
+                    false,
+                    1.0f,
+                    0,
+                    disjoint_splitting));
+            return cbs.search();
+        };
+
+        SearchResults<ConstraintTreeNodeBase, ConflictBasedSearchStatistics> result = solve(false);
+        ASSERT_TRUE(result.foundGoal());
+        SearchResults<ConstraintTreeNodeBase, ConflictBasedSearchStatistics> disjoint_result = solve(true);
+        ASSERT_TRUE(disjoint_result.foundGoal());
+        ASSERT_EQ(disjoint_result.goal()->getFirstConflict(), nullptr);
+        ASSERT_EQ(disjoint_result.goal()->cost(), result.goal()->cost());
+
+        // Forcing one robot onto the center moves robot 2 off it in the same child instead of in a later split
+        ASSERT_LT(disjoint_result.statistics()->numberOfHighLevelNodesGenerated(),
+                  result.statistics()->numberOfHighLevelNodesGenerated());
+    }
+
+    TEST(CBS, warmStart) {
+        // Four robots that drive straight down their own column of an open map
+        auto map = std::make_shared<const GridMap>(5, 5, robin_hood::unordered_set<GridCell>());
+        std::vector<std::shared_ptr<const GridCell>> initial_states;
+        std::vector<std::shared_ptr<const GridCell>> goal_states;
+        for (unsigned int robot = 0; robot < 4; ++robot) {
+            initial_states.push_back(std::make_shared<const GridCell>(robot, 0));
+            goal_states.push_back(std::make_shared<const GridCell>(robot, 4));
+        }
+        auto create_parameters = [&map, &initial_states](const std::vector<std::shared_ptr<const GridCell>> &goals,
+                                                         const bool prioritize_conflicts,
+                                                         const float suboptimality_weight) {
+            return std::make_shared<const ConflictBasedSearchParameters>(ConstraintTreeNodeCostType::e_sum_of_costs,
+                                                                         map,
+                                                                         initial_states,
+                                                                         goals,
+                                                                         "cbs_high_level",
+                                                                         "cbs_low_level",
+                                                                         false,
+                                                                         std::numeric_limits<float>::max(),
+                                                                         prioritize_conflicts,
+                                                                         prioritize_conflicts,
+                                                                         suboptimality_weight);
+        };
+
+        for (const auto &[prioritize_conflicts, suboptimality_weight]:
+                {std::make_tuple(false, 1.0f), std::make_tuple(true, 1.0f), std::make_tuple(true, 1.5f)}) {
+            ConflictBaseSearch previous(create_parameters(goal_states, prioritize_conflicts, suboptimality_weight));
+            SearchResults<ConstraintTreeNodeBase, ConflictBasedSearchStatistics> previous_result = previous.search();
+            ASSERT_TRUE(previous_result.foundGoal());
+            std::vector<std::shared_ptr<const GridPath>> previous_solution;
+            for (unsigned int robot = 0; robot < 4; ++robot) {
+                previous_solution.push_back(previous_result.goal()->lowLevelSolution(robot));
+            }
+
+            // Robot 3 is given a new goal that does not interfere with the others
+            std::vector<std::shared_ptr<const GridCell>> new_goal_states = goal_states;
+            new_goal_states[3] = std::make_shared<const GridCell>(4, 4);
+            auto parameters = create_parameters(new_goal_states, prioritize_conflicts, suboptimality_weight);
+
+            ConflictBaseSearch cold(parameters);
+            SearchResults<ConstraintTreeNodeBase, ConflictBasedSearchStatistics> cold_result = cold.search();
+            ASSERT_TRUE(cold_result.foundGoal());
+
+            ConflictBaseSearch warm(parameters);
+            SearchResults<ConstraintTreeNodeBase, ConflictBasedSearchStatistics> warm_result =
+                    warm.searchFromSolution(previous_solution, {3});
+            ASSERT_TRUE(warm_result.foundGoal());
+            ASSERT_EQ(warm_result.goal()->getFirstConflict(), nullptr);
+            ASSERT_EQ(warm_result.goal()->cost(), cold_result.goal()->cost());
+            ASSERT_EQ(warm_result.statistics()->numberOfHighLevelNodesGenerated(), 1);
+            for (unsigned int robot = 0; robot < 3; ++robot) {
+                ASSERT_EQ(warm_result.goal()->lowLevelSolution(robot), previous_solution[robot]);
+            }
+            ASSERT_EQ(warm_result.goal()->lowLevelSolution(3)->back(), GridPath::pack(4, 4));
+            ASSERT_LT(warm_result.statistics()->numberOfLowLevelNodesExpanded(),
+                      cold_result.statistics()->numberOfLowLevelNodesExpanded());
+
+            // Robot 0 is sent across the other columns so the conflicts it introduces have to be resolved
+            new_goal_states[0] = std::make_shared<const GridCell>(2, 3);
+            ConflictBaseSearch crossing(create_parameters(new_goal_states, prioritize_conflicts,
+                                                          suboptimality_weight));
+            SearchResults<ConstraintTreeNodeBase, ConflictBasedSearchStatistics> crossing_result =
+                    crossing.searchFromSolution(previous_solution, {0, 3});
+            ASSERT_TRUE(crossing_result.foundGoal());
+            ASSERT_EQ(crossing_result.goal()->getFirstConflict(), nullptr);
+            ASSERT_EQ(crossing_result.goal()->lowLevelSolution(0)->back(), GridPath::pack(2, 3));
+
+            // The previous path of robot 3 no longer reaches its goal
+            ConflictBaseSearch invalid(parameters);
+            ASSERT_ANY_THROW(invalid.searchFromSolution(previous_solution, {}));
+            ASSERT_ANY_THROW(invalid.searchFromSolution({previous_solution[0]}, {3}));
+        }
+    }
 }  // namespace grstapse::unittests
\ No newline at end of file
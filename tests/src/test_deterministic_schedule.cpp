@@ -0,0 +1,70 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// External
+#include <gtest/gtest.h>
+// Local
+#include <grstapse/scheduling/milp/deterministic/deterministic_schedule.hpp>
+#include <grstapse/scheduling/milp/deterministic/schedule_repair_inputs.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(DeterministicSchedule, Repair)
+    {
+        // Mutex ordering 0 -> 1 and precedence 2 -> 1
+        const DeterministicSchedule schedule(6.5f, {{0.0f, 2.0f}, {4.5f, 6.5f}, {1.0f, 4.0f}}, {{0, 1}});
+        const ScheduleRepairInputs inputs{
+            .current_time                 = 2.5f,
+            .task_statuses                = {TaskExecutionStatus::e_completed,
+                                             TaskExecutionStatus::e_pending,
+                                             TaskExecutionStatus::e_in_progress},
+            .task_durations               = {2.5f, -1.0f, 5.0f},
+            .initial_transition_durations = {0.0f, 0.0f, 1.0f},
+            .precedence_constraints       = {{.predecessor = 2, .successor = 1, .lag = 0.5f}},
+            .mutex_transition_durations   = {1.0f}};
+
+        std::shared_ptr<const DeterministicSchedule> repaired = schedule.repair(inputs);
+        ASSERT_NE(repaired, nullptr);
+        ASSERT_FLOAT_EQ(repaired->makespan(), 8.5f);
+        ASSERT_FLOAT_EQ(repaired->taskStart(0), 0.0f);
+        ASSERT_FLOAT_EQ(repaired->taskEnd(0), 2.5f);
+        ASSERT_FLOAT_EQ(repaired->taskStart(2), 1.0f);
+        ASSERT_FLOAT_EQ(repaired->taskEnd(2), 6.0f);
+        ASSERT_FLOAT_EQ(repaired->taskStart(1), 6.5f);
+        ASSERT_FLOAT_EQ(repaired->taskEnd(1), 8.5f);
+        ASSERT_EQ(repaired->precedenceSetMutexConstraints(), schedule.precedenceSetMutexConstraints());
+    }
+
+    TEST(DeterministicSchedule, RepairInfeasibleOrdering)
+    {
+        // Task 1 started before task 0 even though the ordering is 0 -> 1
+        const DeterministicSchedule schedule(4.0f, {{0.0f, 2.0f}, {2.0f, 4.0f}}, {{0, 1}});
+        const ScheduleRepairInputs inputs{
+            .current_time                 = 1.0f,
+            .task_statuses                = {TaskExecutionStatus::e_pending, TaskExecutionStatus::e_in_progress},
+            .task_durations               = {},
+            .initial_transition_durations = {0.0f, 0.0f},
+            .precedence_constraints       = {},
+            .mutex_transition_durations   = {0.0f}};
+        ASSERT_EQ(schedule.repair(inputs), nullptr);
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
@@ -0,0 +1,60 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2021
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// External
+#include <gtest/gtest.h>
+// Local
+#include <grstapse/scheduling/earliest_timepoint_propagation.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(EarliestTimepointPropagation, Diamond)
+    {
+        // 0 -> 1 -> 3
+        // 0 -> 2 -> 3
+        const std::vector<float> durations{1.0f, 2.0f, 5.0f, 1.0f};
+        const std::vector<float> release_times{0.5f, 0.0f, 0.0f, 0.0f};
+        const std::vector<TemporalArc> arcs{{.predecessor = 0, .successor = 1, .lag = 0.0f},
+                                            {.predecessor = 0, .successor = 2, .lag = 1.0f},
+                                            {.predecessor = 1, .successor = 3, .lag = 0.0f},
+                                            {.predecessor = 2, .successor = 3, .lag = 0.0f}};
+        std::vector<std::pair<float, float>> timepoints;
+        const float makespan = propagateEarliestTimepoints(durations, release_times, arcs, timepoints);
+
+        ASSERT_EQ(timepoints.size(), 4);
+        ASSERT_FLOAT_EQ(timepoints[0].first, 0.5f);
+        ASSERT_FLOAT_EQ(timepoints[1].first, 1.5f);
+        ASSERT_FLOAT_EQ(timepoints[2].first, 2.5f);
+        ASSERT_FLOAT_EQ(timepoints[3].first, 7.5f);
+        ASSERT_FLOAT_EQ(makespan, 8.5f);
+    }
+
+    TEST(EarliestTimepointPropagation, Cycle)
+    {
+        const std::vector<float> durations{1.0f, 1.0f};
+        const std::vector<float> release_times{0.0f, 0.0f};
+        const std::vector<TemporalArc> arcs{{.predecessor = 0, .successor = 1, .lag = 0.0f},
+                                            {.predecessor = 1, .successor = 0, .lag = 0.0f}};
+        std::vector<std::pair<float, float>> timepoints;
+        ASSERT_LT(propagateEarliestTimepoints(durations, release_times, arcs, timepoints), 0.0f);
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
@@ -0,0 +1,115 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Global
+#include <memory>
+// External
+#include <gtest/gtest.h>
+#include <robin_hood/robin_hood.hpp>
+// Project
+#include <grstapse/geometric_planning/grid/grid_cell.hpp>
+#include <grstapse/geometric_planning/grid/grid_jump_point_search.hpp>
+#include <grstapse/geometric_planning/grid/grid_map.hpp>
+#include <grstapse/geometric_planning/grid/grid_search.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(GridMap, WordScanning)
+    {
+        robin_hood::unordered_set<GridCell> obstacles = {GridCell(3, 0), GridCell(70, 0), GridCell(129, 1)};
+        GridMap map(130, 2, obstacles);
+        ASSERT_EQ(map.wordsPerRow(), 3);
+        ASSERT_TRUE(map.isObstacle(70, 0));
+        ASSERT_FALSE(map.isObstacle(71, 0));
+
+        ASSERT_EQ(map.nextObstacle(0, 0), 3);
+        ASSERT_EQ(map.nextObstacle(4, 0), 70);
+        ASSERT_EQ(map.nextObstacle(71, 0), 130);
+        ASSERT_EQ(map.nextObstacle(0, 1), 129);
+        ASSERT_EQ(map.previousObstacle(69, 0), 3);
+        ASSERT_EQ(map.previousObstacle(2, 0), -1);
+        ASSERT_EQ(map.previousObstacle(129, 0), 70);
+    }
+
+    TEST(GridJumpPointSearch, Map3x3)
+    {
+        robin_hood::unordered_set<GridCell> obstacles = {GridCell(1, 1), GridCell(2, 2)};
+        auto map                                      = std::make_shared<const GridMap>(3, 3, obstacles);
+
+        GridJumpPointSearch jps(map);
+        std::vector<GridCell> path = jps.search(GridCell(0, 0), GridCell(1, 2));
+        ASSERT_EQ(path.size(), 4);
+        ASSERT_EQ(path.front(), GridCell(0, 0));
+        ASSERT_EQ(path.back(), GridCell(1, 2));
+        for(unsigned int i = 1; i < path.size(); ++i)
+        {
+            ASSERT_EQ(path[i].manhattanDistance(path[i - 1]), 1);
+            ASSERT_FALSE(map->isObstacle(path[i]));
+        }
+
+        // The goal is an obstacle
+        ASSERT_TRUE(jps.search(GridCell(0, 0), GridCell(2, 2)).empty());
+
+        // The goal is free, but walled off
+        robin_hood::unordered_set<GridCell> walls = {GridCell(1, 1), GridCell(2, 1), GridCell(1, 2)};
+        auto walled_map                           = std::make_shared<const GridMap>(3, 3, walls);
+        GridJumpPointSearch walled_jps(walled_map);
+        ASSERT_FALSE(walled_map->isObstacle(GridCell(2, 2)));
+        ASSERT_TRUE(walled_jps.search(GridCell(0, 0), GridCell(2, 2)).empty());
+    }
+
+    TEST(GridJumpPointSearch, MatchesGridSearch)
+    {
+        // A maze of walls with alternating gaps
+        const unsigned int width  = 100;
+        const unsigned int height = 31;
+        robin_hood::unordered_set<GridCell> obstacles;
+        for(unsigned int y = 1; y < height; y += 2)
+        {
+            for(unsigned int x = 0; x < width; ++x)
+            {
+                if(x != ((y / 2) % 2 == 0 ? width - 1 : 0) && x != (y * 7) % width)
+                {
+                    obstacles.insert(GridCell(x, y));
+                }
+            }
+        }
+        auto map = std::make_shared<const GridMap>(width, height, obstacles);
+
+        auto parameters = std::make_shared<const BestFirstSearchParameters>(false, 0.0, "a_star", false, false);
+        auto initial    = std::make_shared<const GridCell>(0, 0);
+        auto goal       = std::make_shared<const GridCell>(width / 2, height - 1);
+        GridSearch grid_search(parameters, map, initial, goal);
+        SearchResults<GridCellNode, SearchStatisticsCommon> solution = grid_search.search();
+        ASSERT_TRUE(solution.foundGoal());
+        unsigned int grid_search_length = 0;
+        for(auto node = solution.goal()->parent(); node != nullptr; node = node->parent())
+        {
+            ++grid_search_length;
+        }
+
+        GridJumpPointSearch jps(map);
+        std::vector<GridCell> path = jps.search(*initial, *goal);
+        ASSERT_EQ(path.size(), grid_search_length + 1);
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
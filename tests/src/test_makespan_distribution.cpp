@@ -0,0 +1,53 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Global
+#include <limits>
+// External
+#include <gtest/gtest.h>
+// Local
+#include <grstapse/scheduling/makespan_distribution.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(MakespanDistribution, Quantile)
+    {
+        const MakespanDistribution distribution({4.0f, 1.0f, 3.0f, 2.0f, 5.0f});
+        ASSERT_EQ(distribution.numSamples(), 5);
+        ASSERT_EQ(distribution.numInfeasible(), 0);
+        ASSERT_FLOAT_EQ(distribution.quantile(0.0f), 1.0f);
+        ASSERT_FLOAT_EQ(distribution.quantile(0.2f), 1.0f);
+        ASSERT_FLOAT_EQ(distribution.quantile(0.5f), 3.0f);
+        ASSERT_FLOAT_EQ(distribution.quantile(0.8f), 4.0f);
+        ASSERT_FLOAT_EQ(distribution.worst(), 5.0f);
+        ASSERT_FLOAT_EQ(distribution.mean(), 3.0f);
+    }
+
+    TEST(MakespanDistribution, Infeasible)
+    {
+        const MakespanDistribution distribution({2.0f, -1.0f, 1.0f, 3.0f});
+        ASSERT_EQ(distribution.numInfeasible(), 1);
+        ASSERT_FLOAT_EQ(distribution.quantile(0.75f), 3.0f);
+        ASSERT_EQ(distribution.quantile(1.0f), std::numeric_limits<float>::infinity());
+        ASSERT_EQ(distribution.mean(), std::numeric_limits<float>::infinity());
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
@@ -21,7 +21,9 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 // Global
+#include <filesystem>
 #include <fstream>
+#include <iterator>
 #include <memory>
 // External
 #include <gtest/gtest.h>
@@ -30,6 +32,7 @@
 #include <ompl/base/spaces/SE2StateSpace.h>
 // Project
 #include <grstapse/common/utilities/custom_json_conversions.hpp>
+#include <grstapse/common/utilities/parallel_for.hpp>
 #include <grstapse/geometric_planning/ompl/ompl_enums.hpp>
 #include <grstapse/geometric_planning/ompl/ompl_motion_planner.hpp>
 #include <grstapse/geometric_planning/ompl/ompl_motion_planner_parameters.hpp>
@@ -507,4 +510,178 @@ namespace grstapse::unittests
         ASSERT_FLOAT_EQ(state_1->getY(), 0.0);
         ASSERT_FLOAT_EQ(state_1->getYaw(), 3.14159);
     }
+
+    TEST(MotionPlanner, ConcurrentQueries)
+    {
+        auto parameters = std::make_shared<OmplMotionPlannerParameters>(
+            /* timeout               = */ 1.0f,  // s
+            /* simplify_path         = */ true,
+            /* simplify_path_timeout = */ 1.0f,  // s
+            /* connection_range      = */ 0.1f   // m
+        );
+
+        std::ifstream fin("data/geometric_planning/environments/pgm.json");
+        nlohmann::json j;
+        fin >> j;
+        auto environment = j.get<std::shared_ptr<PgmEnvironment>>();
+
+        auto motion_planner =
+            std::make_shared<OmplMotionPlanner>(OmplMotionPlannerType::e_rrt_connect, parameters, environment);
+        auto species = std::make_shared<Species>("name", Eigen::VectorXf{}, 0.2f, 0.2f, motion_planner);
+
+        // Different goal yaws so that no query is answered from memoization
+        constexpr unsigned int k_num_queries = 8;
+        auto initial_configuration           = std::make_shared<Se2StateOmplConfiguration>(5.5, 0.0, 3.14159);
+        std::vector<std::shared_ptr<Se2StateOmplConfiguration>> goal_configurations;
+        for(unsigned int i = 0; i < k_num_queries; ++i)
+        {
+            goal_configurations.push_back(std::make_shared<Se2StateOmplConfiguration>(-5.5, 0.0, 0.1 * i));
+        }
+
+        std::vector<std::shared_ptr<const MotionPlanningQueryResultBase>> results(k_num_queries);
+        parallelFor(
+            0,
+            k_num_queries,
+            [&](const unsigned int i)
+            {
+                results[i] = motion_planner->query(species, initial_configuration, goal_configurations[i]);
+            },
+            k_num_queries);
+
+        for(unsigned int i = 0; i < k_num_queries; ++i)
+        {
+            ASSERT_NE(results[i], nullptr);
+            ASSERT_EQ(results[i]->status(), MotionPlannerQueryStatus::e_success);
+            const auto& path = std::dynamic_pointer_cast<const OmplMotionPlanningQueryResult>(results[i])->path();
+            ASSERT_EQ(path->getStateCount(), 2);
+            const auto* state_1 = dynamic_cast<const ompl::base::SE2StateSpace::StateType*>(path->getState(1));
+            ASSERT_FLOAT_EQ(state_1->getX(), -5.5);
+            ASSERT_FLOAT_EQ(state_1->getY(), 0.0);
+            ASSERT_FLOAT_EQ(state_1->getYaw(), 0.1 * i);
+        }
+        ASSERT_EQ(motion_planner->numMotionPlans(), k_num_queries);
+
+        // Every instance was returned and the pool only grew to the peak number of concurrent queries
+        const unsigned int num_idle_planners = motion_planner->numIdlePlanners();
+        ASSERT_GE(num_idle_planners, 1);
+        ASSERT_LE(num_idle_planners, k_num_queries);
+    }
+
+    // region Roadmap reuse
+    namespace
+    {
+        std::shared_ptr<PgmEnvironment> loadPgmEnvironment(const std::string& filepath)
+        {
+            std::ifstream fin(filepath);
+            nlohmann::json j;
+            fin >> j;
+            return j.get<std::shared_ptr<PgmEnvironment>>();
+        }
+
+        std::shared_ptr<OmplMotionPlannerParameters> createRoadmapParameters(const std::string& roadmap_directory)
+        {
+            auto parameters = std::make_shared<OmplMotionPlannerParameters>(
+                /* timeout               = */ 1.0f,  // s
+                /* simplify_path         = */ false,
+                /* simplify_path_timeout = */ 1.0f,  // s
+                /* connection_range      = */ 0.1f   // m
+            );
+            parameters->reuse_roadmap             = true;
+            parameters->roadmap_construction_time = 1.0f;  // s
+            parameters->roadmap_directory         = roadmap_directory;
+            return parameters;
+        }
+
+        std::string readFile(const std::string& filepath)
+        {
+            std::ifstream in(filepath, std::ios::binary);
+            return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+    }  // namespace
+
+    TEST(MotionPlanner, RoadmapFingerprintStability)
+    {
+        auto environment        = loadPgmEnvironment("data/geometric_planning/environments/pgm.json");
+        auto same_environment   = loadPgmEnvironment("data/geometric_planning/environments/pgm.json");
+        auto dubins_environment = loadPgmEnvironment("data/geometric_planning/environments/pgm_dubins.json");
+        ASSERT_EQ(environment->fingerprint(), environment->fingerprint());
+        ASSERT_EQ(environment->fingerprint(), same_environment->fingerprint());
+        ASSERT_NE(environment->fingerprint(), dubins_environment->fingerprint());
+
+        auto parameters = createRoadmapParameters("roadmaps");
+        OmplMotionPlanner motion_planner(OmplMotionPlannerType::e_prm, parameters, environment);
+        OmplMotionPlanner same_motion_planner(OmplMotionPlannerType::e_prm, parameters, same_environment);
+        ASSERT_EQ(motion_planner.roadmapFilepath(0.2f), motion_planner.roadmapFilepath(0.2f));
+        ASSERT_EQ(motion_planner.roadmapFilepath(0.2f), same_motion_planner.roadmapFilepath(0.2f));
+        ASSERT_NE(motion_planner.roadmapFilepath(0.2f), motion_planner.roadmapFilepath(0.3f));
+
+        OmplMotionPlanner prm_star_motion_planner(OmplMotionPlannerType::e_prm_star, parameters, environment);
+        ASSERT_NE(motion_planner.roadmapFilepath(0.2f), prm_star_motion_planner.roadmapFilepath(0.2f));
+    }
+
+    TEST(MotionPlanner, RoadmapSaveLoad)
+    {
+        const std::string roadmap_directory =
+            (std::filesystem::temp_directory_path() / "grstapse_roadmap_save_load").string();
+        std::filesystem::remove_all(roadmap_directory);
+
+        auto environment           = loadPgmEnvironment("data/geometric_planning/environments/pgm.json");
+        auto parameters            = createRoadmapParameters(roadmap_directory);
+        auto initial_configuration = std::make_shared<Se2StateOmplConfiguration>(5.5, 0.0, 3.14159);
+        auto goal_configuration    = std::make_shared<Se2StateOmplConfiguration>(-5.5, 0.0, 3.14159);
+
+        // Grows and saves the roadmap
+        auto motion_planner =
+            std::make_shared<OmplMotionPlanner>(OmplMotionPlannerType::e_prm, parameters, environment);
+        auto species        = std::make_shared<Species>("name", Eigen::VectorXf{}, 0.2f, 0.2f, motion_planner);
+        ASSERT_EQ(motion_planner->query(species, initial_configuration, goal_configuration)->status(),
+                  MotionPlannerQueryStatus::e_success);
+        const std::string filepath = motion_planner->roadmapFilepath(0.2f);
+        ASSERT_TRUE(std::filesystem::exists(filepath));
+        const std::string roadmap = readFile(filepath);
+        ASSERT_FALSE(roadmap.empty());
+
+        // Loads the roadmap (a regrown roadmap would be sampled differently and saved again)
+        auto loaded_motion_planner =
+            std::make_shared<OmplMotionPlanner>(OmplMotionPlannerType::e_prm, parameters, environment);
+        auto loaded_species = std::make_shared<Species>("name", Eigen::VectorXf{}, 0.2f, 0.2f, loaded_motion_planner);
+        ASSERT_EQ(loaded_motion_planner->query(loaded_species, initial_configuration, goal_configuration)->status(),
+                  MotionPlannerQueryStatus::e_success);
+        ASSERT_EQ(readFile(filepath), roadmap);
+
+        std::filesystem::remove_all(roadmap_directory);
+    }
+
+    TEST(MotionPlanner, RoadmapChangedMap)
+    {
+        const std::string roadmap_directory =
+            (std::filesystem::temp_directory_path() / "grstapse_roadmap_changed_map").string();
+        std::filesystem::remove_all(roadmap_directory);
+
+        auto environment = loadPgmEnvironment("data/geometric_planning/environments/pgm.json");
+        auto parameters  = createRoadmapParameters(roadmap_directory);
+        auto motion_planner =
+            std::make_shared<OmplMotionPlanner>(OmplMotionPlannerType::e_prm, parameters, environment);
+        auto species        = std::make_shared<Species>("name", Eigen::VectorXf{}, 0.2f, 0.2f, motion_planner);
+        ASSERT_EQ(motion_planner
+                      ->query(species,
+                              std::make_shared<Se2StateOmplConfiguration>(5.5, 0.0, 3.14159),
+                              std::make_shared<Se2StateOmplConfiguration>(-5.5, 0.0, 3.14159))
+                      ->status(),
+                  MotionPlannerQueryStatus::e_success);
+        ASSERT_TRUE(std::filesystem::exists(motion_planner->roadmapFilepath(0.2f)));
+
+        // A roadmap of a different map is never found
+        nlohmann::json j = {{"yaml_filepath", "data/geometric_planning/maps/iros_map_part.yaml"},
+                            {"dubins", false},
+                            {"configuration_type", "ompl"},
+                            {"environment_type", "pgm"}};
+        auto changed_environment = j.get<std::shared_ptr<PgmEnvironment>>();
+        OmplMotionPlanner changed_motion_planner(OmplMotionPlannerType::e_prm, parameters, changed_environment);
+        ASSERT_NE(changed_motion_planner.roadmapFilepath(0.2f), motion_planner->roadmapFilepath(0.2f));
+        ASSERT_FALSE(std::filesystem::exists(changed_motion_planner.roadmapFilepath(0.2f)));
+
+        std::filesystem::remove_all(roadmap_directory);
+    }
+    // endregion
 }  // namespace grstapse::unittests
\ No newline at end of file
@@ -0,0 +1,68 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Global
+#include <algorithm>
+#include <filesystem>
+// External
+#include <gtest/gtest.h>
+// Project
+#include <grstapse/common/utilities/pgm.hpp>
+#include <grstapse/common/utilities/pgm_registry.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(Pgm, Load)
+    {
+        Pgm pgm("data/geometric_planning/maps/iros_map_part.pgm");
+        ASSERT_TRUE(pgm.isMapped());
+        ASSERT_EQ(pgm.width(), 424);
+        ASSERT_EQ(pgm.height(), 311);
+        ASSERT_EQ(pgm.pixels().size(), 424 * 311);
+    }
+
+    TEST(Pgm, SaveRoundTrip)
+    {
+        Pgm pgm(3, 2, {0, 1, 2, 127, 128, 255});
+        const std::string filepath = (std::filesystem::temp_directory_path() / "grstapse_test_pgm.pgm").string();
+        pgm.saveFile(filepath);
+
+        Pgm loaded(filepath);
+        ASSERT_EQ(loaded.width(), 3);
+        ASSERT_EQ(loaded.height(), 2);
+        ASSERT_TRUE(std::equal(pgm.pixels().begin(), pgm.pixels().end(), loaded.pixels().begin()));
+        ASSERT_EQ(loaded.pixel(1, 2), 255);
+        std::filesystem::remove(filepath);
+    }
+
+    TEST(PgmRegistry, Shared)
+    {
+        {
+            auto a = PgmRegistry::instance().load("data/geometric_planning/maps/iros_map_part.pgm");
+            auto b = PgmRegistry::instance().load("data/geometric_planning/../geometric_planning/maps/iros_map_part.pgm");
+            ASSERT_EQ(a, b);
+            ASSERT_EQ(PgmRegistry::instance().size(), 1);
+        }
+        ASSERT_EQ(PgmRegistry::instance().size(), 0);
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
@@ -21,7 +21,10 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 // Global
+#include <cmath>
+#include <filesystem>
 #include <fstream>
+#include <limits>
 // External
 #include <gtest/gtest.h>
 // Local
@@ -60,4 +63,126 @@ namespace grstapse::unittests
         // ASSERT_NEAR(environment->maxY(), 51.224998, 1e-3);
         ASSERT_EQ(environment->stateSpaceType(), OmplStateSpaceType::e_se2);
     }
+
+    /**!
+     * An 11 x 7 map (1 m cells with the origin at (0, 0)) with a wall over the cells x = 5, y = [0, 4], so the only
+     * way from the left to the right side is over the top of the wall
+     */
+    class PgmEnvironmentGeodesic : public ::testing::Test
+    {
+       protected:
+        void SetUp() override
+        {
+            m_filepath = (std::filesystem::temp_directory_path() / "grstapse_test_geodesic.pgm").string();
+            std::ofstream out(m_filepath);
+            out << "P2\n" << k_width << " " << k_height << "\n255\n";
+            for(unsigned int y = 0; y < k_height; ++y)
+            {
+                for(unsigned int x = 0; x < k_width; ++x)
+                {
+                    out << (x == 5 && y < 5 ? 0 : 255) << " ";
+                }
+                out << "\n";
+            }
+            out.close();
+            m_environment = std::make_shared<PgmEnvironment>(m_filepath, 1.0f, 0.0f, 0.0f);
+        }
+
+        void TearDown() override
+        {
+            m_environment = nullptr;
+            std::filesystem::remove(m_filepath);
+        }
+
+        [[nodiscard]] static unsigned int cell(const unsigned int x, const unsigned int y)
+        {
+            return y * k_width + x;
+        }
+
+        static constexpr unsigned int k_width  = 11;
+        static constexpr unsigned int k_height = 7;
+        std::string m_filepath;
+        std::shared_ptr<PgmEnvironment> m_environment;
+    };
+
+    TEST_F(PgmEnvironmentGeodesic, InflatedOccupancy)
+    {
+        // A robot that fits in a cell only collides with the wall itself
+        const std::vector<uint8_t> occupancy = m_environment->inflatedOccupancy(1.0f);
+        ASSERT_EQ(occupancy.size(), k_width * k_height);
+        for(unsigned int y = 0; y < k_height; ++y)
+        {
+            for(unsigned int x = 0; x < k_width; ++x)
+            {
+                ASSERT_EQ(occupancy[cell(x, y)] != 0, x == 5 && y < 5) << x << ", " << y;
+            }
+        }
+
+        // Cells strictly closer than the radius (2 cells) to the wall are in collision
+        const std::vector<uint8_t> inflated = m_environment->inflatedOccupancy(2.0f);
+        ASSERT_TRUE(inflated[cell(4, 2)]);
+        ASSERT_TRUE(inflated[cell(6, 2)]);
+        ASSERT_FALSE(inflated[cell(3, 2)]);
+        ASSERT_FALSE(inflated[cell(7, 2)]);
+        ASSERT_TRUE(inflated[cell(5, 5)]);
+        ASSERT_TRUE(inflated[cell(4, 5)]);
+        ASSERT_FALSE(inflated[cell(5, 6)]);
+        ASSERT_FALSE(inflated[cell(3, 6)]);
+    }
+
+    TEST_F(PgmEnvironmentGeodesic, GeodesicDistances)
+    {
+        const std::vector<uint8_t> occupancy = m_environment->inflatedOccupancy(1.0f);
+        const std::vector<float> distances   = m_environment->geodesicDistances(occupancy, 0.5f, 0.5f);
+        ASSERT_EQ(distances.size(), k_width * k_height);
+        ASSERT_FLOAT_EQ(distances[cell(0, 0)], 0.0f);
+        ASSERT_FLOAT_EQ(distances[cell(4, 0)], 4.0f);
+        ASSERT_FLOAT_EQ(distances[cell(2, 2)], 2.0f * std::sqrt(2.0f));
+        // Over the top of the wall: (0, 0) -> (5, 5) -> (10, 0)
+        ASSERT_NEAR(distances[cell(10, 0)], 10.0f * std::sqrt(2.0f), 1e-4f);
+        ASSERT_EQ(distances[cell(5, 0)], std::numeric_limits<float>::infinity());
+
+        // Reusing a buffer gives the same distances
+        std::vector<float> buffer(3, -1.0f);
+        m_environment->geodesicDistances(occupancy, 0.5f, 0.5f, buffer);
+        ASSERT_EQ(buffer, distances);
+
+        // Inflating by 3 cells closes the gap over the wall
+        const std::vector<uint8_t> closed = m_environment->inflatedOccupancy(3.0f);
+        m_environment->geodesicDistances(closed, 0.5f, 0.5f, buffer);
+        ASSERT_FLOAT_EQ(buffer[cell(2, 0)], 2.0f);
+        ASSERT_EQ(buffer[cell(10, 0)], std::numeric_limits<float>::infinity());
+        ASSERT_EQ(m_environment->geodesicLowerBound(buffer, 10.5f, 0.5f), std::numeric_limits<float>::infinity());
+
+        // Sources in collision reach nothing
+        m_environment->geodesicDistances(occupancy, 5.5f, 0.5f, buffer);
+        ASSERT_EQ(buffer[cell(5, 0)], std::numeric_limits<float>::infinity());
+        ASSERT_EQ(buffer[cell(4, 0)], std::numeric_limits<float>::infinity());
+    }
+
+    TEST_F(PgmEnvironmentGeodesic, GeodesicLowerBound)
+    {
+        const std::vector<uint8_t> occupancy = m_environment->inflatedOccupancy(1.0f);
+        const std::vector<float> distances   = m_environment->geodesicDistances(occupancy, 0.5f, 0.5f);
+
+        // The shortest continuous path (even for a point) has to go around the corners (5, 5) and (6, 5) of the wall
+        const float corner_distance = std::hypot(4.5f, 4.5f);
+        const float path_length     = corner_distance + 1.0f + corner_distance;
+        const float lower_bound     = m_environment->geodesicLowerBound(distances, 10.5f, 0.5f);
+        ASSERT_LE(lower_bound, path_length);
+        // Tighter than the euclidean distance
+        ASSERT_GT(lower_bound, 10.0f);
+
+        // Admissible for every free cell reached with a straight line
+        for(unsigned int x = 0; x < 5; ++x)
+        {
+            for(unsigned int y = 0; y < k_height; ++y)
+            {
+                ASSERT_LE(m_environment->geodesicLowerBound(distances, x + 0.5f, y + 0.5f),
+                          std::hypot(static_cast<float>(x), static_cast<float>(y)) + 1e-4f);
+            }
+        }
+        ASSERT_FLOAT_EQ(m_environment->geodesicLowerBound(distances, 0.5f, 0.5f), 0.0f);
+        ASSERT_EQ(m_environment->geodesicLowerBound(distances, -1.0f, 0.5f), std::numeric_limits<float>::infinity());
+    }
 }  // namespace grstapse::unittests
\ No newline at end of file
@@ -28,6 +28,7 @@
 // Project
 #include <grstapse/common/search/best_first_search_parameters.hpp>
 #include <grstapse/common/search/undirected_graph/undirected_graph_a_star_search_node.hpp>
+#include <grstapse/common/search/undirected_graph/undirected_graph_csr_successor_generator.hpp>
 #include <grstapse/common/search/undirected_graph/undirected_graph_path_cost.hpp>
 #include <grstapse/common/search/undirected_graph/undirected_graph_successor_generator.hpp>
 #include <grstapse/common/utilities/custom_json_conversions.hpp>
@@ -35,6 +36,7 @@
 #include <grstapse/geometric_planning/graph/point/point_graph_a_star.hpp>
 #include <grstapse/geometric_planning/graph/point/point_graph_configuration_euclidean_distance_heuristic.hpp>
 #include <grstapse/geometric_planning/graph/point/point_graph_environment.hpp>
+#include <grstapse/geometric_planning/graph/point/point_graph_landmark_heuristic.hpp>
 
 namespace grstapse::unittests
 {
@@ -71,4 +73,89 @@ namespace grstapse::unittests
         ASSERT_EQ(path.size(), 9);
     }
 
+    TEST(PointGraphAStar, Csr)
+    {
+        using SearchNode = UndirectedGraphAStarSearchNode<PointGraphConfiguration>;
+
+        auto search_parameters = std::shared_ptr<const BestFirstSearchParameters>(
+            new BestFirstSearchParameters{.has_timeout       = false,
+                                          .timeout           = 0.0f,
+                                          .timer_name        = "point_graph_a_star",
+                                          .save_pruned_nodes = false,
+                                          .save_closed_nodes = false});
+        std::ifstream in("data/geometric_planning/environments/point_graph.json");
+        nlohmann::json j;
+        in >> j;
+
+        auto graph = j.get<std::shared_ptr<PointGraphEnvironment>>();
+        ASSERT_NE(graph->csr(), nullptr);
+        ASSERT_EQ(graph->csr()->numVertices(), graph->numVertices());
+        ASSERT_EQ(graph->csr()->end(graph->csr()->numVertices() - 1), 2 * graph->numEdges());
+
+        auto initial_configuration = std::make_shared<const PointGraphConfiguration>(0, 0.0f, 0.0f);
+        auto goal_configuration    = std::make_shared<const PointGraphConfiguration>(18, 4.0f, 4.0f);
+
+        AStarFunctors<SearchNode> functors{
+            .pathcost  = std::make_shared<const UndirectedGraphPathCost<SearchNode>>(),
+            .heuristic = std::make_shared<const PointGraphConfigurationEuclideanDistanceHeuristic<SearchNode>>(
+                goal_configuration),
+            .successor_generator =
+                std::make_shared<const UndirectedGraphCsrSuccessorGenerator<SearchNode>>(graph->csr()),
+            .goal_check =
+                std::make_shared<const EqualPointGraphConfigurationGoalCheck<SearchNode>>(goal_configuration)};
+
+        PointGraphAStar a_star(search_parameters, initial_configuration, graph, functors);
+        auto results = a_star.search();
+        auto path    = trace<SearchNode>(results.goal());
+        ASSERT_TRUE(results.foundGoal());
+        ASSERT_EQ(path.size(), 9);
+    }
+
+    TEST(PointGraphAStar, Landmarks)
+    {
+        using SearchNode = UndirectedGraphAStarSearchNode<PointGraphConfiguration>;
+
+        auto search_parameters = std::shared_ptr<const BestFirstSearchParameters>(
+            new BestFirstSearchParameters{.has_timeout       = false,
+                                          .timeout           = 0.0f,
+                                          .timer_name        = "point_graph_a_star",
+                                          .save_pruned_nodes = false,
+                                          .save_closed_nodes = false});
+        std::ifstream in("data/geometric_planning/environments/point_graph.json");
+        nlohmann::json j;
+        in >> j;
+
+        auto graph = j.get<std::shared_ptr<PointGraphEnvironment>>();
+        graph->computeLandmarks(4);
+        const std::shared_ptr<const PointGraphLandmarks>& landmarks = graph->landmarks();
+        ASSERT_NE(landmarks, nullptr);
+        ASSERT_EQ(landmarks->numLandmarks(), 4);
+
+        // The bound from a landmark is exact
+        for(unsigned int landmark = 0; landmark < landmarks->numLandmarks(); ++landmark)
+        {
+            for(unsigned int vertex = 0; vertex < graph->csr()->numVertices(); ++vertex)
+            {
+                ASSERT_FLOAT_EQ(landmarks->lowerBound(landmarks->landmark(landmark), vertex),
+                                landmarks->distance(vertex, landmark));
+            }
+        }
+
+        auto initial_configuration = std::make_shared<const PointGraphConfiguration>(0, 0.0f, 0.0f);
+        auto goal_configuration    = std::make_shared<const PointGraphConfiguration>(18, 4.0f, 4.0f);
+
+        AStarFunctors<SearchNode> functors{
+            .pathcost  = std::make_shared<const UndirectedGraphPathCost<SearchNode>>(),
+            .heuristic = std::make_shared<const PointGraphLandmarkHeuristic<SearchNode>>(landmarks, goal_configuration),
+            .successor_generator =
+                std::make_shared<const UndirectedGraphCsrSuccessorGenerator<SearchNode>>(graph->csr()),
+            .goal_check =
+                std::make_shared<const EqualPointGraphConfigurationGoalCheck<SearchNode>>(goal_configuration)};
+
+        PointGraphAStar a_star(search_parameters, initial_configuration, graph, functors);
+        auto results = a_star.search();
+        auto path    = trace<SearchNode>(results.goal());
+        ASSERT_TRUE(results.foundGoal());
+        ASSERT_EQ(path.size(), 9);
+    }
 }  // namespace grstapse::unittests
\ No newline at end of file
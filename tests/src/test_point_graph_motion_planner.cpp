@@ -30,6 +30,7 @@
 #include <grstapse/geometric_planning/graph/point/point_graph_environment.hpp>
 #include <grstapse/geometric_planning/graph/point/point_graph_motion_planner.hpp>
 #include <grstapse/geometric_planning/graph/point/point_graph_motion_planning_query_result.hpp>
+#include <grstapse/geometric_planning/graph/point/point_graph_shortest_paths.hpp>
 #include <grstapse/geometric_planning/motion_planner_parameters_base.hpp>
 
 namespace grstapse::unittests
@@ -52,4 +53,67 @@ namespace grstapse::unittests
         auto path = result->path();
         ASSERT_EQ(path.size(), 9);
     }
+
+    TEST(PointGraphMotionPlanner, precomputed)
+    {
+        std::ifstream in("data/geometric_planning/environments/point_graph.json");
+        nlohmann::json j;
+        in >> j;
+
+        auto parameters = std::make_shared<const MotionPlannerParametersBase>(1.0f);
+        auto graph      = j.get<std::shared_ptr<PointGraphEnvironment>>();
+        PointGraphMotionPlanner mp(parameters, graph);
+        PointGraphMotionPlanner mp_a_star(parameters, graph);
+
+        auto initial_configuration = std::make_shared<const PointGraphConfiguration>(0, 0.0f, 0.0f);
+        auto goal_configuration    = std::make_shared<const PointGraphConfiguration>(18, 4.0f, 4.0f);
+        mp.precompute({initial_configuration});
+        ASSERT_EQ(mp.shortestPaths()->numSources(), 1);
+
+        // Both directions are answered from the single tree
+        auto result = std::dynamic_pointer_cast<const PointGraphMotionPlanningQueryResult>(
+            mp.query(nullptr, initial_configuration, goal_configuration));
+        auto a_star_result = std::dynamic_pointer_cast<const PointGraphMotionPlanningQueryResult>(
+            mp_a_star.query(nullptr, initial_configuration, goal_configuration));
+        ASSERT_EQ(result->status(), MotionPlannerQueryStatus::e_success);
+        ASSERT_EQ(result->path().size(), 9);
+        ASSERT_EQ(*result->path().front(), *initial_configuration);
+        ASSERT_EQ(*result->path().back(), *goal_configuration);
+        ASSERT_NEAR(result->length(), a_star_result->length(), 1e-4f);
+
+        auto reverse_result = std::dynamic_pointer_cast<const PointGraphMotionPlanningQueryResult>(
+            mp.query(nullptr, goal_configuration, initial_configuration));
+        ASSERT_EQ(reverse_result->path().size(), 9);
+        ASSERT_EQ(*reverse_result->path().front(), *goal_configuration);
+        ASSERT_NEAR(*mp.shortestPaths()->pathLength(18, 0), result->length(), 1e-4f);
+    }
+
+    TEST(PointGraphMotionPlanner, precomputedIsMemoized)
+    {
+        std::ifstream in("data/geometric_planning/environments/point_graph.json");
+        nlohmann::json j;
+        in >> j;
+
+        auto parameters = std::make_shared<const MotionPlannerParametersBase>(1.0f);
+        auto graph      = j.get<std::shared_ptr<PointGraphEnvironment>>();
+        PointGraphMotionPlanner mp(parameters, graph);
+
+        auto initial_configuration = std::make_shared<const PointGraphConfiguration>(0, 0.0f, 0.0f);
+        auto goal_configuration    = std::make_shared<const PointGraphConfiguration>(18, 4.0f, 4.0f);
+        auto other_configuration   = std::make_shared<const PointGraphConfiguration>(1, 1.0f, 0.0f);
+        ASSERT_FALSE(mp.isMemoized(nullptr, initial_configuration, goal_configuration));
+
+        // Pairs with a precomputed end are covered in either direction without a query
+        mp.precompute({initial_configuration});
+        const MotionPlannerBase& base = mp;
+        ASSERT_TRUE(base.isMemoized(nullptr, initial_configuration, goal_configuration));
+        ASSERT_TRUE(base.isMemoized(nullptr, goal_configuration, initial_configuration));
+        ASSERT_FALSE(base.isMemoized(nullptr, goal_configuration, other_configuration));
+        ASSERT_EQ(mp.numMotionPlans(), 0);
+
+        // Other pairs are memoized once queried
+        ASSERT_EQ(mp.query(nullptr, goal_configuration, other_configuration)->status(),
+                  MotionPlannerQueryStatus::e_success);
+        ASSERT_TRUE(base.isMemoized(nullptr, goal_configuration, other_configuration));
+    }
 }  // namespace grstapse::unittests
\ No newline at end of file
@@ -0,0 +1,81 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Global
+#include <fstream>
+#include <memory>
+// External
+#include <gtest/gtest.h>
+#include <ompl/base/ScopedState.h>
+#include <ompl/base/spaces/SE2StateSpace.h>
+// Project
+#include <grstapse/common/utilities/custom_json_conversions.hpp>
+#include <grstapse/geometric_planning/ompl/quadtree_environment.hpp>
+#include <grstapse/species.hpp>
+
+namespace grstapse::unittests
+{
+    TEST(QuadtreeEnvironment, MatchesPgmEnvironment)
+    {
+        std::ifstream fin("data/geometric_planning/environments/pgm.json");
+        nlohmann::json j;
+        fin >> j;
+        auto pgm_environment      = j.get<std::shared_ptr<PgmEnvironment>>();
+        j["environment_type"]     = "quadtree";
+        auto quadtree_environment = j.get<std::shared_ptr<QuadtreeEnvironment>>();
+        ASSERT_GT(quadtree_environment->numLevels(), 1);
+        ASSERT_EQ(quadtree_environment->fingerprint(), pgm_environment->fingerprint());
+
+        for(const float radius: {0.0f, 0.2f, 0.5f})
+        {
+            Species species("name", Eigen::VectorXf{}, radius, 0.2f, nullptr);
+            ompl::base::ScopedState<ompl::base::SE2StateSpace> state(quadtree_environment->stateSpace());
+            state->setYaw(0.0);
+            for(float x = quadtree_environment->minX(); x < quadtree_environment->maxX(); x += 0.1f)
+            {
+                for(float y = quadtree_environment->minY(); y < quadtree_environment->maxY(); y += 0.1f)
+                {
+                    state->setX(x);
+                    state->setY(y);
+                    ASSERT_EQ(quadtree_environment->isValid(state.get(), species),
+                              pgm_environment->isValid(state.get(), species));
+                }
+            }
+        }
+    }
+
+    TEST(QuadtreeEnvironment, RegionFree)
+    {
+        std::ifstream fin("data/geometric_planning/environments/pgm.json");
+        nlohmann::json j;
+        fin >> j;
+        j["environment_type"]     = "quadtree";
+        auto quadtree_environment = j.get<std::shared_ptr<QuadtreeEnvironment>>();
+
+        // Empty and out of the map
+        ASSERT_TRUE(quadtree_environment->isRegionFree(1, 1, 0, 0));
+        ASSERT_TRUE(quadtree_environment->isRegionFree(-10, -10, -1, -1));
+        // The whole map has obstacles
+        ASSERT_FALSE(quadtree_environment->isRegionFree(-10, -10, 100000, 100000));
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
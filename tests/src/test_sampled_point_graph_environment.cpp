@@ -22,6 +22,7 @@
  */
 
 // Global
+#include <cmath>
 #include <fstream>
 // External
 #include <gtest/gtest.h>
@@ -65,4 +66,31 @@ namespace grstapse::unittests
         ASSERT_EQ(sampled_point_graph_environment->graph(2)->numVertices(), 19);
         ASSERT_EQ(sampled_point_graph_environment->graph(2)->numEdges(), 10);
     }
+
+    TEST(SampledPointGraphEnvironment, SharedTopology)
+    {
+        std::ifstream in("data/geometric_planning/environments/sampled_point_graph.json");
+        nlohmann::json j;
+        in >> j;
+        auto environment = j.get<std::shared_ptr<SampledPointGraphEnvironment>>();
+        const auto& csr  = *environment->topology()->csr();
+        ASSERT_EQ(csr.numVertices(), 19);
+        ASSERT_EQ(csr.numEdges(), 22);
+
+        // Edges missing from a sample have an infinite cost in that sample
+        std::vector<unsigned int> num_edges(environment->numGraphs(), 0);
+        for(unsigned int edge_index = 0; edge_index < csr.numEdges(); ++edge_index)
+        {
+            for(unsigned int sample = 0; sample < environment->numGraphs(); ++sample)
+            {
+                if(!std::isinf(environment->edgeCost(edge_index, sample)))
+                {
+                    ++num_edges[sample];
+                }
+            }
+        }
+        ASSERT_EQ(num_edges[0], 22);
+        ASSERT_EQ(num_edges[1], 8);
+        ASSERT_EQ(num_edges[2], 10);
+    }
 }  // namespace grstapse::unittests
\ No newline at end of file
@@ -0,0 +1,156 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Global
+#include <limits>
+#include <tuple>
+// External
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+// Project
+#include <grstapse/common/utilities/constants.hpp>
+#include <grstapse/common/utilities/custom_json_conversions.hpp>
+#include <grstapse/geometric_planning/graph/point/point_graph_configuration.hpp>
+#include <grstapse/geometric_planning/graph/point/sampled_point_graph_environment.hpp>
+#include <grstapse/geometric_planning/graph/point/sampled_point_graph_motion_planner.hpp>
+#include <grstapse/geometric_planning/motion_planner_parameters_base.hpp>
+#include <grstapse/robot.hpp>
+#include <grstapse/scheduling/schedule_robustness_evaluator.hpp>
+#include <grstapse/scheduling/scheduler_problem_inputs.hpp>
+#include <grstapse/species.hpp>
+#include <grstapse/task.hpp>
+#include <grstapse/task_allocation/itags/itags_problem_inputs.hpp>
+#include <grstapse/task_planning/sas/sas_action.hpp>
+// Local
+#include "mock_grstaps_problem_inputs.hpp"
+
+namespace grstapse::unittests
+{
+    namespace
+    {
+        /**!
+         * A single robot starts at 0 (0, 0) and is allocated to task 0 (1 (1, 0) -> 2 (2, 0)) and task 1 (3 (1, 1) ->
+         * 4 (2, 1)). Every sample has the edges 0-1, 1-2, and 3-4 with a cost of 1, and the edge 2-3 has a cost of
+         * \p costs[i] in the ith sample (missing if negative)
+         */
+        std::shared_ptr<const SchedulerProblemInputs> createSchedulerProblemInputs(const std::vector<float>& costs)
+        {
+            nlohmann::json j;
+            j[constants::k_vertices] = nlohmann::json::array();
+            for(const auto& [id, x, y]: {std::tuple(0u, 0.0f, 0.0f),
+                                         std::tuple(1u, 1.0f, 0.0f),
+                                         std::tuple(2u, 2.0f, 0.0f),
+                                         std::tuple(3u, 1.0f, 1.0f),
+                                         std::tuple(4u, 2.0f, 1.0f)})
+            {
+                j[constants::k_vertices].push_back({{constants::k_id, id}, {constants::k_x, x}, {constants::k_y, y}});
+            }
+            j[constants::k_edges] = nlohmann::json::array();
+            for(const float cost: costs)
+            {
+                nlohmann::json edges_j = nlohmann::json::array();
+                for(const auto& [a, b]: {std::pair(0u, 1u), std::pair(1u, 2u), std::pair(3u, 4u)})
+                {
+                    edges_j.push_back(
+                        {{constants::k_vertex_a, a}, {constants::k_vertex_b, b}, {constants::k_cost, 1.0f}});
+                }
+                if(cost >= 0.0f)
+                {
+                    edges_j.push_back(
+                        {{constants::k_vertex_a, 2u}, {constants::k_vertex_b, 3u}, {constants::k_cost, cost}});
+                }
+                j[constants::k_edges].push_back(edges_j);
+            }
+
+            auto species = std::make_shared<const Species>(
+                "species",
+                Eigen::VectorXf(),
+                0.1f,
+                1.0f,
+                std::make_shared<SampledPointGraphMotionPlanner>(
+                    std::make_shared<const MotionPlannerParametersBase>(1.0f),
+                    j.get<std::shared_ptr<SampledPointGraphEnvironment>>()));
+
+            auto vertex = [](const unsigned int id, const float x, const float y)
+            {
+                return std::make_shared<const PointGraphConfiguration>(id, x, y);
+            };
+            std::vector<std::shared_ptr<const Task>> tasks = {
+                std::make_shared<const Task>(std::make_shared<SasAction>("t0", 0.0f),
+                                             Eigen::VectorXf(),
+                                             vertex(1, 1.0f, 0.0f),
+                                             vertex(2, 2.0f, 0.0f)),
+                std::make_shared<const Task>(std::make_shared<SasAction>("t1", 0.0f),
+                                             Eigen::VectorXf(),
+                                             vertex(3, 1.0f, 1.0f),
+                                             vertex(4, 2.0f, 1.0f))};
+            std::vector<std::shared_ptr<const Robot>> robots = {
+                std::make_shared<const Robot>("r0", vertex(0, 0.0f, 0.0f), species)};
+
+            auto grstaps_problem_inputs = std::make_shared<mocks::MockGrstapsProblemInputs>();
+            grstaps_problem_inputs->setTasks(tasks);
+            grstaps_problem_inputs->setRobots(robots);
+            auto itags_problem_inputs =
+                std::make_shared<ItagsProblemInputs>(grstaps_problem_inputs,
+                                                     std::vector<unsigned int>{0, 1},
+                                                     std::multimap<unsigned int, unsigned int>(),
+                                                     Eigen::MatrixXf(),
+                                                     0.0f,
+                                                     0.0f);
+
+            Eigen::MatrixXf allocation(2, 1);
+            allocation << 1.0f, 1.0f;
+            return std::make_shared<const SchedulerProblemInputs>(
+                itags_problem_inputs,
+                allocation,
+                std::set<std::pair<unsigned int, unsigned int>>{{0, 1}});
+        }
+    }  // namespace
+
+    TEST(ScheduleRobustnessEvaluator, FixedSamples)
+    {
+        // Task 0: [1, 2]; transition 2 -> 3; task 1: [2 + c, 3 + c]
+        const ScheduleRobustnessEvaluator evaluator(createSchedulerProblemInputs({3.0f, 1.0f, 2.0f, 4.0f, -1.0f}));
+        ASSERT_EQ(evaluator.numSamples(), 5);
+        ASSERT_NEAR(evaluator.evaluateSample(0, {{0, 1}}), 6.0f, 1e-4f);
+        ASSERT_NEAR(evaluator.evaluateSample(1, {{0, 1}}), 4.0f, 1e-4f);
+        // Task 1 cannot be reached without the edge 2-3
+        ASSERT_LT(evaluator.evaluateSample(4, {{0, 1}}), 0.0f);
+
+        const MakespanDistribution distribution = evaluator.evaluate({{0, 1}});
+        ASSERT_EQ(distribution.numSamples(), 5);
+        ASSERT_EQ(distribution.numInfeasible(), 1);
+        ASSERT_NEAR(distribution.quantile(0.2f), 4.0f, 1e-4f);
+        ASSERT_NEAR(distribution.quantile(0.6f), 6.0f, 1e-4f);
+        ASSERT_NEAR(distribution.quantile(0.8f), 7.0f, 1e-4f);
+        ASSERT_EQ(distribution.quantile(1.0f), std::numeric_limits<float>::infinity());
+
+        // Task 1: [2 + c, 3 + c]; transition 4 -> 3 -> 2 -> 1; task 0: [5 + 2c, 6 + 2c]
+        const MakespanDistribution reverse_distribution = evaluator.evaluate({{1, 0}});
+        ASSERT_EQ(reverse_distribution.numInfeasible(), 1);
+        ASSERT_NEAR(reverse_distribution.quantile(0.2f), 8.0f, 1e-4f);
+        ASSERT_NEAR(reverse_distribution.quantile(0.8f), 14.0f, 1e-4f);
+
+        // Ordering both ways is a cycle
+        ASSERT_EQ(evaluator.evaluate({{0, 1}, {1, 0}}).numInfeasible(), 5);
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
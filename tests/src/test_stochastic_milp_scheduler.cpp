@@ -20,10 +20,186 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
+#ifndef NO_MILP
 
+// Global
+#    include <tuple>
 // External
-#include <gtest/gtest.h>
+#    include <gtest/gtest.h>
+#    include <nlohmann/json.hpp>
 // Project
+#    include <grstapse/common/utilities/constants.hpp>
+#    include <grstapse/common/utilities/custom_json_conversions.hpp>
+#    include <grstapse/geometric_planning/graph/point/point_graph_configuration.hpp>
+#    include <grstapse/geometric_planning/graph/point/sampled_point_graph_environment.hpp>
+#    include <grstapse/geometric_planning/graph/point/sampled_point_graph_motion_planner.hpp>
+#    include <grstapse/geometric_planning/motion_planner_parameters_base.hpp>
+#    include <grstapse/robot.hpp>
+#    include <grstapse/scheduling/milp/deterministic/deterministic_schedule.hpp>
+#    include <grstapse/scheduling/milp/stochastic/stochastic_milp_scheduler.hpp>
+#    include <grstapse/scheduling/milp/stochastic/stochastic_milp_scheduler_parameters.hpp>
+#    include <grstapse/scheduling/scheduler_problem_inputs.hpp>
+#    include <grstapse/species.hpp>
+#    include <grstapse/task.hpp>
+#    include <grstapse/task_allocation/itags/itags_problem_inputs.hpp>
+#    include <grstapse/task_planning/sas/sas_action.hpp>
+// Local
+#    include "mock_grstaps_problem_inputs.hpp"
 
 namespace grstapse::unittests
-{}  // namespace grstapse::unittests
\ No newline at end of file
+{
+    namespace
+    {
+        using SampledEdges = std::vector<std::vector<std::tuple<unsigned int, unsigned int, float>>>;
+
+        /**!
+         * Vertices: 0 (0, 0) and 5 (0, 1) are the initial configurations of robots 0 and 1, task 0 goes from 1 (1, 0)
+         * to 2 (2, 0), and task 1 goes from 3 (1, 1) to 4 (2, 1)
+         */
+        std::shared_ptr<SampledPointGraphEnvironment> createEnvironment(const SampledEdges& samples)
+        {
+            nlohmann::json j;
+            j[constants::k_vertices] = nlohmann::json::array();
+            for(const auto& [id, x, y]: {std::tuple(0u, 0.0f, 0.0f),
+                                         std::tuple(1u, 1.0f, 0.0f),
+                                         std::tuple(2u, 2.0f, 0.0f),
+                                         std::tuple(3u, 1.0f, 1.0f),
+                                         std::tuple(4u, 2.0f, 1.0f),
+                                         std::tuple(5u, 0.0f, 1.0f)})
+            {
+                j[constants::k_vertices].push_back({{constants::k_id, id}, {constants::k_x, x}, {constants::k_y, y}});
+            }
+            j[constants::k_edges] = nlohmann::json::array();
+            for(const auto& edges: samples)
+            {
+                nlohmann::json edges_j = nlohmann::json::array();
+                for(const auto& [a, b, cost]: edges)
+                {
+                    edges_j.push_back(
+                        {{constants::k_vertex_a, a}, {constants::k_vertex_b, b}, {constants::k_cost, cost}});
+                }
+                j[constants::k_edges].push_back(edges_j);
+            }
+            return j.get<std::shared_ptr<SampledPointGraphEnvironment>>();
+        }
+
+        /**!
+         * Robot 0 is allocated to both tasks (so they are mutex) and moves on \p samples, while the wider robot 1 is
+         * only allocated to task 0 (so it defines that task's duration) and moves on a graph that is the same for every
+         * scenario
+         */
+        std::shared_ptr<const SchedulerProblemInputs> createSchedulerProblemInputs(const SampledEdges& samples,
+                                                                                   const float alpha)
+        {
+            auto motion_planner_parameters = std::make_shared<const MotionPlannerParametersBase>(1.0f);
+            auto narrow = std::make_shared<const Species>(
+                "narrow",
+                Eigen::VectorXf(),
+                0.1f,
+                1.0f,
+                std::make_shared<SampledPointGraphMotionPlanner>(motion_planner_parameters,
+                                                                 createEnvironment(samples)));
+            auto wide = std::make_shared<const Species>(
+                "wide",
+                Eigen::VectorXf(),
+                0.3f,
+                1.0f,
+                std::make_shared<SampledPointGraphMotionPlanner>(
+                    motion_planner_parameters,
+                    createEnvironment(SampledEdges(samples.size(), {{5, 1, 1.0f}, {1, 2, 1.0f}}))));
+
+            auto vertex = [](const unsigned int id, const float x, const float y)
+            {
+                return std::make_shared<const PointGraphConfiguration>(id, x, y);
+            };
+            std::vector<std::shared_ptr<const Task>> tasks = {
+                std::make_shared<const Task>(std::make_shared<SasAction>("t0", 0.0f),
+                                             Eigen::VectorXf(),
+                                             vertex(1, 1.0f, 0.0f),
+                                             vertex(2, 2.0f, 0.0f)),
+                std::make_shared<const Task>(std::make_shared<SasAction>("t1", 0.0f),
+                                             Eigen::VectorXf(),
+                                             vertex(3, 1.0f, 1.0f),
+                                             vertex(4, 2.0f, 1.0f))};
+            std::vector<std::shared_ptr<const Robot>> robots = {
+                std::make_shared<const Robot>("r0", vertex(0, 0.0f, 0.0f), narrow),
+                std::make_shared<const Robot>("r1", vertex(5, 0.0f, 1.0f), wide)};
+
+            auto parameters           = std::make_shared<StochasticMilpSchedulerParameters>();
+            parameters->timeout       = 1.0f;
+            parameters->threads       = 0;
+            parameters->alpha         = alpha;
+            parameters->num_scenarios = samples.size();
+
+            auto grstaps_problem_inputs = std::make_shared<mocks::MockGrstapsProblemInputs>();
+            grstaps_problem_inputs->setTasks(tasks);
+            grstaps_problem_inputs->setRobots(robots);
+            grstaps_problem_inputs->setScheduleParameters(parameters);
+            auto itags_problem_inputs =
+                std::make_shared<ItagsProblemInputs>(grstaps_problem_inputs,
+                                                     std::vector<unsigned int>{0, 1},
+                                                     std::multimap<unsigned int, unsigned int>(),
+                                                     Eigen::MatrixXf(),
+                                                     0.0f,
+                                                     0.0f);
+
+            Eigen::MatrixXf allocation(2, 2);
+            allocation << 1.0f, 1.0f, 1.0f, 0.0f;
+            return std::make_shared<const SchedulerProblemInputs>(
+                itags_problem_inputs,
+                allocation,
+                std::set<std::pair<unsigned int, unsigned int>>{{0, 1}});
+        }
+    }  // namespace
+
+    /**!
+     * Tests that a mutex constraint whose direction is forced by a motion planning failure in one scenario is forced
+     * in every scenario (including those where it can be ordered either way)
+     */
+    TEST(StochasticMilpScheduler, ForcedMutexConstraint)
+    {
+        // Task 0's terminal configuration cannot reach task 1 in scenario 1, so task 1 must go first
+        const SampledEdges samples = {{{0, 1, 1.0f}, {1, 3, 1.0f}, {3, 4, 1.0f}, {2, 3, 1.0f}},
+                                      {{0, 1, 1.0f}, {1, 3, 1.0f}, {3, 4, 1.0f}}};
+        for(const float alpha: {0.5f, 1.0f})
+        {
+            StochasticMilpScheduler scheduler(createSchedulerProblemInputs(samples, alpha));
+            auto schedule = std::dynamic_pointer_cast<const DeterministicSchedule>(scheduler.solve());
+            ASSERT_NE(schedule, nullptr);
+
+            // Task 1: [2, 3]; transition 4 -> 3 -> 1; task 0: [5, 6]
+            ASSERT_NEAR(schedule->makespan(), 6.0f, 1e-4f);
+            ASSERT_NEAR(schedule->taskStart(1), 2.0f, 1e-4f);
+            ASSERT_NEAR(schedule->taskStart(0), 5.0f, 1e-4f);
+        }
+    }
+
+    /**!
+     * Tests that the mutex ordering is shared by all the scenarios and chosen for the fraction alpha of them
+     */
+    TEST(StochasticMilpScheduler, SharedOrderingChanceConstraint)
+    {
+        // 0 -> 1 has a makespan of 3 + cost(2, 3) (4, 11, 4) and 1 -> 0 has a makespan of 6 in every scenario
+        const SampledEdges samples = {{{0, 1, 1.0f}, {1, 3, 1.0f}, {3, 4, 1.0f}, {2, 3, 1.0f}},
+                                      {{0, 1, 1.0f}, {1, 3, 1.0f}, {3, 4, 1.0f}, {2, 3, 8.0f}},
+                                      {{0, 1, 1.0f}, {1, 3, 1.0f}, {3, 4, 1.0f}, {2, 3, 1.0f}}};
+
+        auto run_test = [&samples](const float alpha,
+                                   const std::pair<unsigned int, unsigned int>& ordering,
+                                   const float makespan)
+        {
+            StochasticMilpScheduler scheduler(createSchedulerProblemInputs(samples, alpha));
+            auto schedule = std::dynamic_pointer_cast<const DeterministicSchedule>(scheduler.solve());
+            ASSERT_NE(schedule, nullptr);
+            ASSERT_NEAR(schedule->makespan(), makespan, 1e-4f);
+            ASSERT_EQ(schedule->precedenceSetMutexConstraints().size(), 1);
+            ASSERT_EQ(schedule->precedenceSetMutexConstraints()[0], ordering);
+        };
+
+        // Every scenario must be covered, so the ordering that is never bad wins
+        run_test(1.0f, {1, 0}, 6.0f);
+        // Two of the three scenarios are enough, so scenario 1 is given up on
+        run_test(0.6f, {0, 1}, 4.0f);
+    }
+}  // namespace grstapse::unittests
+#endif
\ No newline at end of file
@@ -0,0 +1,166 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Global
+#include <cmath>
+// External
+#include <gtest/gtest.h>
+// Local
+#include <grstapse/geometric_planning/graph/point/point_graph_configuration.hpp>
+#include <grstapse/robot.hpp>
+#include <grstapse/scheduling/transition_duration_matrix.hpp>
+#include <grstapse/species.hpp>
+#include <grstapse/task.hpp>
+#include <grstapse/task_planning/sas/sas_action.hpp>
+
+namespace grstapse::unittests
+{
+    namespace
+    {
+        std::shared_ptr<const PointGraphConfiguration> point(const float x, const float y)
+        {
+            return std::make_shared<const PointGraphConfiguration>(0, x, y);
+        }
+
+        /**!
+         * Tasks: 0 (0, 0) -> (3, 0), 1 (3, 4) -> (6, 4), 2 (0, 4) -> (0, 8)
+         * Robots: 0 (fast species) at (0, 0), 1 (slow species) at (3, 0), 2 (fast species) at (10, 0)
+         */
+        TransitionDurationMatrix createTransitionDurationMatrix()
+        {
+            auto fast = std::make_shared<const Species>("fast", Eigen::VectorXf(), 0.1f, 2.0f, nullptr);
+            auto slow = std::make_shared<const Species>("slow", Eigen::VectorXf(), 0.1f, 1.0f, nullptr);
+            std::vector<std::shared_ptr<const Task>> tasks = {
+                std::make_shared<const Task>(std::make_shared<SasAction>("t0", 0.0f),
+                                             Eigen::VectorXf(),
+                                             point(0.0f, 0.0f),
+                                             point(3.0f, 0.0f)),
+                std::make_shared<const Task>(std::make_shared<SasAction>("t1", 0.0f),
+                                             Eigen::VectorXf(),
+                                             point(3.0f, 4.0f),
+                                             point(6.0f, 4.0f)),
+                std::make_shared<const Task>(std::make_shared<SasAction>("t2", 0.0f),
+                                             Eigen::VectorXf(),
+                                             point(0.0f, 4.0f),
+                                             point(0.0f, 8.0f))};
+            std::vector<std::shared_ptr<const Robot>> robots = {
+                std::make_shared<const Robot>("r0", point(0.0f, 0.0f), fast),
+                std::make_shared<const Robot>("r1", point(3.0f, 0.0f), slow),
+                std::make_shared<const Robot>("r2", point(10.0f, 0.0f), fast)};
+            return TransitionDurationMatrix(tasks, robots);
+        }
+    }  // namespace
+
+    TEST(TransitionDurationMatrix, Heuristics)
+    {
+        const TransitionDurationMatrix matrix = createTransitionDurationMatrix();
+        ASSERT_EQ(matrix.numberOfTasks(), 3);
+        ASSERT_EQ(matrix.speciesIndex(0), 0);
+        ASSERT_EQ(matrix.speciesIndex(1), 1);
+        ASSERT_EQ(matrix.speciesIndex(2), 0);
+
+        // From the terminal configuration of i to the initial configuration of j divided by the species' speed
+        ASSERT_NEAR(matrix.transitionHeuristicDuration(0, 0, 1), 2.0f, 1e-4f);
+        ASSERT_NEAR(matrix.transitionHeuristicDuration(1, 0, 1), 4.0f, 1e-4f);
+        ASSERT_NEAR(matrix.transitionHeuristicDuration(2, 0, 1), 2.0f, 1e-4f);
+        ASSERT_NEAR(matrix.transitionHeuristicDuration(1, 0, 2), 5.0f, 1e-4f);
+        ASSERT_NEAR(matrix.transitionHeuristicDuration(1, 1, 0), std::sqrt(52.0f), 1e-4f);
+        ASSERT_NEAR(matrix.transitionHeuristicDuration(1, 1, 2), 6.0f, 1e-4f);
+        ASSERT_NEAR(matrix.transitionHeuristicDuration(1, 2, 0), 8.0f, 1e-4f);
+        ASSERT_NEAR(matrix.transitionHeuristicDuration(1, 2, 1), 5.0f, 1e-4f);
+        for(unsigned int robot_nr = 0; robot_nr < 3; ++robot_nr)
+        {
+            for(unsigned int task_nr = 0; task_nr < 3; ++task_nr)
+            {
+                ASSERT_EQ(matrix.transitionHeuristicDuration(robot_nr, task_nr, task_nr), 0.0f);
+            }
+        }
+
+        // From the initial configuration of each robot (not shared by a species)
+        ASSERT_NEAR(matrix.initialTransitionHeuristicDuration(0, 1), 2.5f, 1e-4f);
+        ASSERT_NEAR(matrix.initialTransitionHeuristicDuration(1, 1), 4.0f, 1e-4f);
+        ASSERT_NEAR(matrix.initialTransitionHeuristicDuration(2, 1), std::sqrt(65.0f) / 2.0f, 1e-4f);
+        ASSERT_NEAR(matrix.initialTransitionHeuristicDuration(2, 0), 5.0f, 1e-4f);
+    }
+
+    TEST(TransitionDurationMatrix, CachedDurations)
+    {
+        TransitionDurationMatrix matrix = createTransitionDurationMatrix();
+
+        // Nothing is cached until it is set
+        for(unsigned int robot_nr = 0; robot_nr < 3; ++robot_nr)
+        {
+            for(unsigned int task_i = 0; task_i < 3; ++task_i)
+            {
+                ASSERT_FALSE(matrix.initialTransitionDuration(robot_nr, task_i).has_value());
+                for(unsigned int task_j = 0; task_j < 3; ++task_j)
+                {
+                    ASSERT_FALSE(matrix.transitionDuration(robot_nr, task_i, task_j).has_value());
+                }
+            }
+        }
+
+        // Every (species, i, j) has its own slot
+        for(unsigned int robot_nr = 0; robot_nr < 2; ++robot_nr)
+        {
+            for(unsigned int task_i = 0; task_i < 3; ++task_i)
+            {
+                for(unsigned int task_j = 0; task_j < 3; ++task_j)
+                {
+                    matrix.setTransitionDuration(robot_nr, task_i, task_j, 100.0f * robot_nr + 10.0f * task_i + task_j);
+                }
+            }
+        }
+        for(unsigned int robot_nr = 0; robot_nr < 3; ++robot_nr)
+        {
+            // Robot 2 shares the transitions of its species with robot 0
+            const unsigned int species_nr = matrix.speciesIndex(robot_nr);
+            for(unsigned int task_i = 0; task_i < 3; ++task_i)
+            {
+                for(unsigned int task_j = 0; task_j < 3; ++task_j)
+                {
+                    const std::optional<float> duration = matrix.transitionDuration(robot_nr, task_i, task_j);
+                    ASSERT_TRUE(duration.has_value());
+                    ASSERT_EQ(*duration, 100.0f * species_nr + 10.0f * task_i + task_j);
+                }
+            }
+        }
+
+        // Initial transitions have their own slots per robot
+        for(unsigned int task_nr = 0; task_nr < 3; ++task_nr)
+        {
+            ASSERT_FALSE(matrix.initialTransitionDuration(0, task_nr).has_value());
+        }
+        matrix.setInitialTransitionDuration(0, 1, 7.0f);
+        ASSERT_EQ(matrix.initialTransitionDuration(0, 1), 7.0f);
+        ASSERT_FALSE(matrix.initialTransitionDuration(2, 1).has_value());
+        ASSERT_FALSE(matrix.initialTransitionDuration(0, 0).has_value());
+        ASSERT_EQ(matrix.transitionDuration(0, 0, 1), 1.0f);
+
+        // Motion planning failures are cached as well
+        matrix.setInitialTransitionDuration(2, 1, -1.0f);
+        ASSERT_EQ(matrix.initialTransitionDuration(2, 1), -1.0f);
+        matrix.setTransitionDuration(1, 2, 0, -1.0f);
+        ASSERT_EQ(matrix.transitionDuration(1, 2, 0), -1.0f);
+        ASSERT_EQ(matrix.transitionDuration(0, 2, 0), 20.0f);
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file
@@ -0,0 +1,111 @@
+/*
+ * Graphically Recursive Simultaneous Task Allocation, Planning,
+ * Scheduling, and Execution
+ *
+ * Copyright (C) 2020-2022
+ *
+ * Author: Andrew Messing
+ * Author: Glen Neville
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Global
+#include <algorithm>
+#include <filesystem>
+#include <limits>
+// External
+#include <gtest/gtest.h>
+#include <ompl/base/ScopedState.h>
+#include <ompl/base/spaces/SE3StateSpace.h>
+// Project
+#include <grstapse/common/utilities/custom_json_conversions.hpp>
+#include <grstapse/common/utilities/voxel_grid.hpp>
+#include <grstapse/geometric_planning/ompl/voxel_environment.hpp>
+#include <grstapse/species.hpp>
+
+namespace grstapse::unittests
+{
+    namespace
+    {
+        //! A 20x10x10 grid (0.1m voxels) with a wall at x = 10 that has a hole around (y, z) = (5, 5)
+        VoxelGrid wallGrid()
+        {
+            const std::array<unsigned int, 3> dimensions{20, 10, 10};
+            std::vector<uint8_t> occupancy(20 * 10 * 10, 0);
+            for(unsigned int z = 0; z < 10; ++z)
+            {
+                for(unsigned int y = 0; y < 10; ++y)
+                {
+                    if(y < 4 || y > 6 || z < 4 || z > 6)
+                    {
+                        occupancy[(z * 10 + y) * 20 + 10] = 1;
+                    }
+                }
+            }
+            return VoxelGrid(dimensions, 0.1f, {0.0f, 0.0f, 0.0f}, std::move(occupancy));
+        }
+    }  // namespace
+
+    TEST(VoxelGrid, SaveRoundTrip)
+    {
+        VoxelGrid grid             = wallGrid();
+        const std::string filepath = (std::filesystem::temp_directory_path() / "grstapse_test_voxels.gvox").string();
+        grid.saveFile(filepath);
+
+        VoxelGrid loaded(filepath);
+        ASSERT_EQ(loaded.dimensions(), grid.dimensions());
+        ASSERT_EQ(loaded.origin(), grid.origin());
+        ASSERT_EQ(loaded.resolution(), grid.resolution());
+        ASSERT_TRUE(std::equal(grid.occupancy().begin(), grid.occupancy().end(), loaded.occupancy().begin()));
+        // Uniform octants collapse
+        ASSERT_LT(std::filesystem::file_size(filepath), grid.occupancy().size() / 4);
+        std::filesystem::remove(filepath);
+    }
+
+    TEST(VoxelEnvironment, Clearance)
+    {
+        const std::string filepath = (std::filesystem::temp_directory_path() / "grstapse_test_voxels.gvox").string();
+        wallGrid().saveFile(filepath);
+        nlohmann::json j = {{"voxel_filepath", filepath}, {"environment_type", "voxel"}};
+        auto environment = j.get<std::shared_ptr<VoxelEnvironment>>();
+        std::filesystem::remove(filepath);
+
+        // Voxel centers
+        ASSERT_FLOAT_EQ(environment->clearance(0.05f, 0.05f, 0.05f), 1.0f);
+        ASSERT_FLOAT_EQ(environment->clearance(1.05f, 0.05f, 0.05f), 0.0f);
+        ASSERT_FLOAT_EQ(environment->clearance(1.05f, 0.55f, 0.55f), 0.2f);
+        ASSERT_EQ(environment->clearance(-1.0f, 0.0f, 0.0f), std::numeric_limits<float>::infinity());
+
+        Species small("small", Eigen::VectorXf{}, 0.15f, 0.2f, nullptr);
+        Species large("large", Eigen::VectorXf{}, 0.25f, 0.2f, nullptr);
+        ompl::base::ScopedState<ompl::base::SE3StateSpace> from(environment->stateSpace());
+        ompl::base::ScopedState<ompl::base::SE3StateSpace> to(environment->stateSpace());
+        from->rotation().setIdentity();
+        to->rotation().setIdentity();
+
+        // Through the hole
+        from->setXYZ(1.05, 0.55, 0.55);
+        ASSERT_TRUE(environment->isValid(from.get(), small));
+        ASSERT_FALSE(environment->isValid(from.get(), large));
+
+        // Far from the wall
+        from->setXYZ(0.15, 0.55, 0.55);
+        to->setXYZ(0.15, 0.15, 0.55);
+        ASSERT_TRUE(environment->isMotionFree(from.get(), to.get(), small));
+        // Across the wall
+        to->setXYZ(1.85, 0.55, 0.55);
+        ASSERT_FALSE(environment->isMotionFree(from.get(), to.get(), small));
+    }
+}  // namespace grstapse::unittests
\ No newline at end of file